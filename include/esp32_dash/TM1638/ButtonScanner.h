@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "esp32_dash/util/RingBuffer.h"
+
+struct ButtonEvent {
+    enum class Type : uint8_t {
+        Press,
+        Release,
+        LongPress,
+        Chord,   // a press that left two or more keys held
+    };
+
+    Type type = Type::Press;
+    uint8_t mask = 0;         // the key's bit, or every held key for Chord
+    uint32_t timestampMs = 0;
+};
+
+/**
+ * Debounces raw TM1638 key masks sampled at a fixed rate and turns them into
+ * events. Each key has an integrator that counts up while the raw bit is set
+ * and down while it is clear; the debounced state only flips when it hits
+ * either end, so a bounce has to persist for \c integratorSamples samples.
+ *
+ * \c sample is called by the scanning task and \c poll by the main loop;
+ * the event queue between them is lock-free.
+ */
+class ButtonScanner {
+public:
+    struct Config {
+        uint8_t integratorSamples;
+        uint32_t longPressMs;
+    };
+
+    static constexpr size_t kEventQueueSize = 16;
+
+    explicit ButtonScanner(const Config &config);
+
+    void sample(uint8_t rawMask, uint32_t nowMs);
+    bool poll(ButtonEvent &out);
+
+    uint8_t heldMask() const { return debounced_; }
+    uint32_t droppedEvents() const { return droppedEvents_; }
+
+private:
+    void emit(ButtonEvent::Type type, uint8_t mask, uint32_t nowMs);
+
+    const Config config_;
+    uint8_t integrators_[8] = {};
+    uint8_t debounced_ = 0;
+    uint8_t longPressReported_ = 0;
+    uint32_t pressedAtMs_[8] = {};
+    RingBuffer<ButtonEvent, kEventQueueSize> events_;
+    volatile uint32_t droppedEvents_ = 0;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+// Segment bits: 0=a (top), 1=b, 2=c, 3=d (bottom), 4=e, 5=f, 6=g (middle), 7=dp
+namespace SevenSegmentFont {
+
+constexpr uint8_t kDecimalPoint = 0x80;
+
+constexpr uint8_t kDigits[10] = {
+        0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F,
+};
+
+// Upper- and lower-case letters share one glyph; letters a 7-segment cell
+// cannot show (K, M, V, W, X) render blank.
+constexpr uint8_t kLetters[26] = {
+        0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71, 0x3D, 0x76, 0x30, 0x1E,  // A-J
+        0x00, 0x38, 0x00, 0x54, 0x5C, 0x73, 0x67, 0x50, 0x6D, 0x78,  // K-T
+        0x3E, 0x00, 0x00, 0x00, 0x6E, 0x5B,                          // U-Z
+};
+
+constexpr uint8_t glyph(char c) {
+    return (c >= '0' && c <= '9') ? kDigits[c - '0']
+         : (c >= 'A' && c <= 'Z') ? kLetters[c - 'A']
+         : (c >= 'a' && c <= 'z') ? kLetters[c - 'a']
+         : c == '-' ? 0x40
+         : c == '_' ? 0x08
+         : c == '*' ? 0x63   // degree sign
+         : 0x00;
+}
+
+static_assert(glyph('8') == 0x7F, "digit lookup");
+static_assert(glyph('c') == glyph('C'), "case-insensitive letters");
+
+}  // namespace SevenSegmentFont
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Maps engine speed onto the eight TM1638 LEDs as a progressive shift light.
+ *
+ * LEDs fill left to right in equal steps between \c startRpm and
+ * \c redlineRpm; at or above redline all LEDs flash with \c flashPeriodMs.
+ * Stateless, so it can be evaluated from any task at any rate.
+ */
+class ShiftLight {
+public:
+    struct Config {
+        float startRpm;
+        float redlineRpm;
+        uint32_t flashPeriodMs;
+    };
+
+    static constexpr uint8_t kLedCount = 8;
+
+    explicit ShiftLight(const Config &config);
+
+    bool isActive(float rpm) const { return rpm >= config_.startRpm; }
+    uint8_t ledMask(float rpm, uint32_t nowMs) const;
+
+private:
+    const Config config_;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Three-wire (STB/CLK/DIO) transport used by \c TM1638LedAndKeyModule.
+ *
+ * Bytes go out LSB first. \c readBytes releases DIO for the duration of the
+ * read and drives it again afterwards, so callers never touch pin modes.
+ */
+class TM1638Bus {
+public:
+    virtual ~TM1638Bus() = default;
+
+    virtual void begin() = 0;
+    virtual void select() = 0;      // STB low
+    virtual void deselect() = 0;    // STB high
+    virtual void writeByte(uint8_t value) = 0;
+    virtual void readBytes(uint8_t *out, uint8_t count) = 0;
+};
+
+// Reference backend built on digitalWrite/shiftOut/shiftIn.
+class ArduinoTM1638Bus : public TM1638Bus {
+public:
+    ArduinoTM1638Bus(uint8_t strobePin, uint8_t clkPin, uint8_t dataPin);
+
+    void begin() override;
+    void select() override;
+    void deselect() override;
+    void writeByte(uint8_t value) override;
+    void readBytes(uint8_t *out, uint8_t count) override;
+
+private:
+    uint8_t strobe;
+    uint8_t clk;
+    uint8_t data;
+};
+
+/**
+ * Backend that bit-bangs through the ESP32 GPIO set/clear and output-enable
+ * registers. Register addresses and pin masks are resolved in the
+ * constructor; timing is held to the TM1638 datasheet (1 MHz CLK, >=1 us
+ * STB high time and >=1 us wait before reading key data) by spinning on the
+ * CPU cycle counter.
+ */
+class DirectGpioTM1638Bus : public TM1638Bus {
+public:
+    DirectGpioTM1638Bus(uint8_t strobePin, uint8_t clkPin, uint8_t dataPin);
+
+    void begin() override;
+    void select() override;
+    void deselect() override;
+    void writeByte(uint8_t value) override;
+    void readBytes(uint8_t *out, uint8_t count) override;
+
+private:
+    struct Pin {
+        uint8_t number;
+        uint32_t mask;
+        volatile uint32_t *setReg;
+        volatile uint32_t *clearReg;
+        volatile uint32_t *enableSetReg;
+        volatile uint32_t *enableClearReg;
+        volatile uint32_t *inReg;
+    };
+
+    static Pin resolvePin(uint8_t pin);
+    void waitCycles(uint32_t cycles) const;
+
+    static inline void high(const Pin &pin) { *pin.setReg = pin.mask; }
+    static inline void low(const Pin &pin) { *pin.clearReg = pin.mask; }
+
+    Pin strobe;
+    Pin clk;
+    Pin data;
+    uint32_t halfClockCycles = 0;
+    uint32_t strobeCycles = 0;
+};
@@ -2,20 +2,60 @@
 
 #include <Arduino.h>
 
+#include "esp32_dash/TM1638/TM1638Bus.h"
+
+/**
+ * Driver for the TM1638 "LED&KEY" board.
+ *
+ * LED and digit writes only touch a 16-byte shadow of the chip's display RAM.
+ * Call \c flush once per frame to push the changed cells, either as one
+ * auto-increment burst or as individual fixed-address writes, whichever puts
+ * fewer bytes on the bus; it is a no-op when nothing changed.
+ */
 class TM1638LedAndKeyModule {
 public:
+    static constexpr uint8_t kDisplayRamSize = 16;
+
+    enum class Backend : uint8_t {
+        ArduinoGpio,     // digitalWrite/shiftOut reference path
+        DirectRegister,  // ESP32 GPIO set/clear registers (default)
+    };
+
+    struct BenchmarkResult {
+        uint32_t readButtonsMicros;  // average per readButtons()
+        uint32_t fullFlushMicros;    // average per 16-byte burst
+    };
+
     TM1638LedAndKeyModule(uint8_t strobePin, uint8_t clkPin, uint8_t dataPin);
 
     void begin();
 
     uint8_t readButtons();               // Returns 8-bit mask of all buttons
     void setLed(uint8_t value, uint8_t position);  // value: 0 or 1, position: 0–7
+    void setLeds(uint8_t mask);          // Bit n drives LED n
+    void setSegments(uint8_t position, uint8_t segments);  // raw segment bits, position: 0–7
+    void setDigit(uint8_t position, char c, bool decimalPoint = false);
+    void showText(const char *text);     // 8 cells, '.' lights the previous cell's DP
+    void flush();                        // Sends pending shadow changes
+    bool hasPendingChanges() const { return dirtyCells != 0; }
     void reset();
 
+    void setBackend(Backend backend);
+    Backend backend() const { return activeBackend; }
+
+    // Times both transactions on the given backend, then restores the
+    // previously active one. Display contents are preserved.
+    BenchmarkResult benchmark(Backend backend, uint16_t iterations);
+
 private:
     void sendCommand(uint8_t value);
+    void writeCell(uint8_t address, uint8_t value);
+
+    ArduinoTM1638Bus arduinoBus;
+    DirectGpioTM1638Bus directBus;
+    TM1638Bus *bus;
+    Backend activeBackend = Backend::DirectRegister;
 
-    uint8_t strobe;
-    uint8_t clk;
-    uint8_t data;
+    uint8_t displayRam[kDisplayRamSize] = {};
+    uint16_t dirtyCells = 0;  // bit n set when displayRam[n] differs from the chip
 };
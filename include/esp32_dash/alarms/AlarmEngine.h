@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Arduino.h>
+
+enum class AlarmSignal : uint8_t {
+    Rpm,
+    CoolantC,
+    SpeedKmh,
+    Count
+};
+
+enum class AlarmKind : uint8_t {
+    Above,         // value >= trip, clears at value <= clear
+    Below,         // value <= trip, clears at value >= clear
+    RisingFaster,  // units per second over kRateWindowMs >= trip, clears at <= clear
+    Stale,         // no sample for trip ms, clears on the next sample
+};
+
+enum class AlarmSeverity : uint8_t {
+    Warning,
+    Critical,
+};
+
+/**
+ * One row of the alarm table. Rows are meant to live in a constexpr array;
+ * earlier rows outrank later ones of the same severity.
+ */
+struct AlarmRule {
+    const char *message;
+    AlarmSignal signal;
+    AlarmKind kind;
+    AlarmSeverity severity;
+    float trip;
+    float clear;
+    bool latching;    // stays active after clearing until acknowledge()
+    uint8_t ledMask;  // TM1638 LEDs lit while active
+};
+
+/**
+ * Evaluates a fixed rule table against incoming sensor samples.
+ *
+ * \c sample() only walks the rules bound to that signal, so the per-sample
+ * cost is a short loop over flash-resident rows and a few bytes of state per
+ * rule. Stale rules are checked by \c checkStale(), which the caller runs
+ * once per loop. Callers poll \c takeChanged() and then present
+ * \c highestActive() and \c ledMask().
+ */
+class AlarmEngine {
+public:
+    static constexpr size_t kMaxRules = 16;
+    // Rates are measured against a sample at least this old, which keeps
+    // ADC noise and quantised readings from looking like fast movement.
+    static constexpr uint32_t kRateWindowMs = 5000;
+
+    template<size_t N>
+    explicit AlarmEngine(const AlarmRule (&rules)[N]) : AlarmEngine(rules, N) {
+        static_assert(N <= kMaxRules, "AlarmEngine: too many rules");
+    }
+
+    AlarmEngine(const AlarmRule *rules, size_t count);
+
+    // Restarts stale timers (and forgets rates) as if every signal had just
+    // been sampled. Active alarms are dropped.
+    void reset(uint32_t nowMs);
+
+    void sample(AlarmSignal signal, float value, uint32_t nowMs);
+    void checkStale(uint32_t nowMs);
+
+    // Drops latched alarms whose condition has cleared and hides the
+    // overlay for the ones still tripping; LEDs stay lit for those.
+    void acknowledge();
+
+    // True once after any alarm became active, cleared or was acknowledged.
+    bool takeChanged();
+
+    const AlarmRule *highestActive() const;
+    bool isActive(size_t rule) const { return rule < count_ && (state_[rule] & kActive); }
+    // True while a threshold or rate alarm on \c signal is active.
+    bool isValueAlarming(AlarmSignal signal) const;
+    uint8_t ledMask() const;
+    // LEDs of the active rules of one severity.
+    uint8_t ledMask(AlarmSeverity severity) const;
+
+private:
+    static constexpr uint8_t kActive = 0x01;
+    static constexpr uint8_t kTripping = 0x02;
+    static constexpr uint8_t kAcknowledged = 0x04;
+
+    struct SignalState {
+        float anchorValue;
+        uint32_t anchorMs;
+        uint32_t sampledAtMs;
+        bool hasAnchor;
+    };
+
+    void update(size_t index, bool trip, bool clear);
+
+    const AlarmRule *rules_;
+    size_t count_;
+    uint8_t state_[kMaxRules] = {};
+    SignalState signals_[static_cast<size_t>(AlarmSignal::Count)] = {};
+    bool changed_ = false;
+};
+
+/**
+ * What the TM1638 LEDs show: a critical alarm takes all of them over, while
+ * warnings only add their LEDs to \c baseLeds (shift light or page marker)
+ * so a long-standing warning does not hide the shift light.
+ */
+uint8_t composeAlarmLeds(uint8_t baseLeds, uint8_t warningLeds, uint8_t criticalLeds);
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+
+class AlarmEngine;
+struct AlarmRule;
+class DisplayManager;
+
+/**
+ * Puts the engine's highest alarm on the display's transient overlay and
+ * arbitrates it against ordinary status messages.
+ *
+ * Warnings show for a fixed time and may be replaced by a status message.
+ * An unacknowledged critical alarm owns the overlay: status messages are
+ * refused while it is up, and \c update() puts it back if anything else
+ * (a sleep/wake cycle, say) took it down.
+ */
+class AlarmOverlay {
+public:
+    struct Config {
+        uint32_t warningMs;
+        uint32_t statusMs;
+        uint16_t criticalBackground;
+        uint16_t warningBackground;
+    };
+
+    AlarmOverlay(const Config &config, AlarmEngine &engine, DisplayManager &displayManager);
+
+    // Runs every loop; \c alarmsChanged is the engine's takeChanged().
+    void update(bool alarmsChanged);
+
+    // Shows \c message for Config::statusMs unless a critical alarm holds the
+    // overlay. Returns false when the message was held back.
+    bool showStatus(const String &message);
+
+    bool criticalShown() const { return critical_ != nullptr; }
+
+private:
+    void present(const AlarmRule &alarm);
+
+    const Config config_;
+    AlarmEngine &engine_;
+    DisplayManager &displayManager_;
+    const AlarmRule *critical_ = nullptr;
+    bool shown_ = false;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <Arduino.h>
+
+enum class BootMilestone : uint8_t {
+    SetupStart,
+    SensorsReady,
+    DisplayReady,
+    GaugesLive,
+    BleReady,
+    Count
+};
+
+/**
+ * Records the first time each boot milestone is reached, in micros() since
+ * reset. Milestones may be marked from any task; each slot is written once.
+ */
+class BootTimeline {
+public:
+    static constexpr size_t kMilestoneCount = static_cast<size_t>(BootMilestone::Count);
+
+    void mark(BootMilestone milestone);
+    bool reached(BootMilestone milestone) const;
+    uint32_t microsAt(BootMilestone milestone) const;
+
+    size_t format(char *buffer, size_t size) const;
+
+    static const char *milestoneName(BootMilestone milestone);
+
+private:
+    volatile uint32_t _micros[kMilestoneCount] = {};
+    volatile bool _reached[kMilestoneCount] = {};
+};
+
+BootTimeline &bootTimeline();
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Build with -DDASH_PROFILING=1 to instrument the main loop. When disabled the
+// DASH_PROFILE_ZONE macro expands to nothing, so zones cost no code or time.
+#ifndef DASH_PROFILING
+#define DASH_PROFILING 0
+#endif
+
+enum class ProfileZone : uint8_t {
+    Loop,
+    DisplayLoop,
+    TachUpdate,
+    WaterUpdate,
+    WaterRead,
+    Buttons,
+    Leds,
+    Count
+};
+
+/**
+ * Collects per-zone execution times into fixed log2-scale histograms.
+ *
+ * Bucket 0 holds durations below 1 µs and bucket \c i holds durations in
+ * [2^(i-1), 2^i) µs, so 24 buckets cover everything up to ~8 s without any
+ * allocation. Percentiles are resolved to the upper bound of their bucket.
+ *
+ * Zones are recorded from both loop() and the TM1638 task; \c record,
+ * \c reset and \c format take a spinlock so a zone's stats never tear.
+ */
+class LoopProfiler {
+public:
+    static constexpr uint8_t kBucketCount = 24;
+    static constexpr size_t kZoneCount = static_cast<size_t>(ProfileZone::Count);
+
+    struct ZoneStats {
+        uint32_t count = 0;
+        uint32_t maxMicros = 0;
+        uint64_t totalMicros = 0;
+        uint32_t buckets[kBucketCount] = {};
+    };
+
+    void record(ProfileZone zone, uint32_t elapsedMicros);
+    void reset();
+
+    // Copy taken under the lock.
+    ZoneStats stats(ProfileZone zone) const;
+    uint32_t percentileMicros(ProfileZone zone, uint8_t percentile) const;
+
+    // Writes one line per zone that has samples, returns the characters written.
+    size_t format(char *buffer, size_t size) const;
+
+    static const char *zoneName(ProfileZone zone);
+    static uint8_t bucketFor(uint32_t elapsedMicros);
+    static uint32_t bucketUpperBoundMicros(uint8_t bucket);
+
+private:
+    static uint32_t percentileOf(const ZoneStats &zoneStats, uint8_t percentile);
+
+    ZoneStats _zones[kZoneCount];
+    mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+};
+
+LoopProfiler &loopProfiler();
+
+class ScopedProfileZone {
+public:
+    explicit ScopedProfileZone(ProfileZone zone) : _zone(zone), _start(micros()) {}
+    ~ScopedProfileZone() { loopProfiler().record(_zone, micros() - _start); }
+
+    ScopedProfileZone(const ScopedProfileZone &) = delete;
+    ScopedProfileZone &operator=(const ScopedProfileZone &) = delete;
+
+private:
+    ProfileZone _zone;
+    uint32_t _start;
+};
+
+#define DASH_PROFILE_CONCAT_INNER(a, b) a##b
+#define DASH_PROFILE_CONCAT(a, b) DASH_PROFILE_CONCAT_INNER(a, b)
+
+#if DASH_PROFILING
+#define DASH_PROFILE_ZONE(zone) \
+    ScopedProfileZone DASH_PROFILE_CONCAT(dashProfileZone_, __LINE__)(ProfileZone::zone)
+#else
+#define DASH_PROFILE_ZONE(zone) do {} while (0)
+#endif
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Fixed-size byte FIFO. Not thread safe; \c SerialConsole locks around it.
+ */
+template<size_t Capacity>
+class ByteRing {
+public:
+    size_t used() const { return _used; }
+    size_t freeSpace() const { return Capacity - _used; }
+
+    // Appends all of \c data or, if it does not fit, nothing.
+    bool push(const uint8_t *data, size_t length) {
+        if (length > freeSpace()) {
+            return false;
+        }
+        append(data, length);
+        return true;
+    }
+
+    // Appends, discarding the oldest bytes to make room.
+    void pushOverwrite(const uint8_t *data, size_t length) {
+        if (length > Capacity) {
+            data += length - Capacity;
+            length = Capacity;
+        }
+        if (length > freeSpace()) {
+            pop(length - freeSpace());
+        }
+        append(data, length);
+    }
+
+    // Longest run of queued bytes, starting \c offset bytes in, that is
+    // contiguous in memory.
+    size_t peek(const uint8_t *&chunk, size_t offset = 0) const {
+        if (offset >= _used) {
+            chunk = nullptr;
+            return 0;
+        }
+        const size_t start = (_head + offset) % Capacity;
+        chunk = _bytes + start;
+        const size_t toEnd = Capacity - start;
+        const size_t remaining = _used - offset;
+        return remaining < toEnd ? remaining : toEnd;
+    }
+
+    void pop(size_t length) {
+        if (length > _used) {
+            length = _used;
+        }
+        _head = (_head + length) % Capacity;
+        _used -= length;
+    }
+
+    void clear() {
+        _head = 0;
+        _used = 0;
+    }
+
+private:
+    void append(const uint8_t *data, size_t length) {
+        size_t tail = (_head + _used) % Capacity;
+        for (size_t i = 0; i < length; ++i) {
+            _bytes[tail] = data[i];
+            tail = (tail + 1) % Capacity;
+        }
+        _used += length;
+    }
+
+    uint8_t _bytes[Capacity] = {};
+    size_t _head = 0;
+    size_t _used = 0;
+};
+
+/**
+ * A command line split into words, pointing into the console's line buffer.
+ * Valid until the next call to \c SerialConsole::feed.
+ */
+struct ConsoleArgs {
+    static constexpr size_t kMaxWords = 6;
+
+    size_t count = 0;
+    const char *words[kMaxWords] = {};
+
+    // True when the line is exactly the words of \c command (compared
+    // without case) followed by \c extraArgs more words.
+    bool matches(const char *command, size_t extraArgs = 0) const;
+    // Parses word \c index as a decimal number.
+    bool uintAt(size_t index, uint32_t &value) const;
+};
+
+/**
+ * USB serial console that never blocks the caller.
+ *
+ * Text and telemetry frames go into a TX ring that the loop drains into
+ * whatever space the UART has (\c peekTx / \c consumeTx); output that does
+ * not fit is dropped and counted instead of waiting. Text is also kept in a
+ * small log ring for \c dumpLog. While streaming, text only goes to the log
+ * so the binary stream stays parseable.
+ *
+ * Input is assembled into a fixed line buffer and split in place, so
+ * reading commands allocates nothing. Output calls may come from any task.
+ */
+class SerialConsole {
+public:
+    static constexpr size_t kTxBytes = 2048;
+    static constexpr size_t kLogBytes = 1024;
+    static constexpr size_t kLineLength = 48;
+    static constexpr size_t kFormatBytes = 160;  // longest single printf; the rest counts as dropped
+
+    void print(const char *text);
+    void print(const __FlashStringHelper *text) { print(reinterpret_cast<const char *>(text)); }
+    void println(const char *text);
+    void println(const __FlashStringHelper *text) { println(reinterpret_cast<const char *>(text)); }
+    void printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+    void write(const char *text, size_t length);
+
+    // Queues a whole binary frame, or drops it if the ring is short of room.
+    bool writeFrame(const uint8_t *frame, size_t length);
+
+    void setStreaming(bool streaming) { _streaming = streaming; }
+    bool isStreaming() const { return _streaming; }
+
+    // Copies the log ring to the TX ring, oldest first.
+    void dumpLog();
+
+    size_t peekTx(const uint8_t *&chunk);
+    void consumeTx(size_t length);
+    uint32_t droppedBytes() const { return _droppedBytes; }
+    uint32_t droppedFrames() const { return _droppedFrames; }
+
+    // Takes one received character; true once a full non-empty line has
+    // been split into \c args.
+    bool feed(char c, ConsoleArgs &args);
+
+private:
+    // Queues \c text then \c suffix as one unit.
+    void queueText(const char *text, size_t length, const char *suffix, size_t suffixLength);
+
+    ByteRing<kTxBytes> _tx;
+    ByteRing<kLogBytes> _log;
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+    char _line[kLineLength] = {};
+    size_t _lineLength = 0;
+    volatile uint32_t _droppedBytes = 0;
+    volatile uint32_t _droppedFrames = 0;
+    volatile bool _streaming = false;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * One live-data sample for the binary serial stream.
+ *
+ * Wire format, little-endian:
+ *   0xA5 0x5A | type 0x01 | payload length | payload | CRC-8 (poly 0x07)
+ * The CRC covers type, length and payload. Payload, 15 bytes:
+ *   u32 ms, u16 rpm, i16 coolant 0.1 C (INT16_MIN when unknown),
+ *   u16 speed 0.1 km/h, u8 page, u8 vehicle input bits, u8 alarm LED mask,
+ *   u16 console bytes dropped (saturating)
+ * tools/decode_telemetry.py reads it back.
+ */
+struct TelemetrySample {
+    uint32_t ms;
+    float rpm;
+    float coolantC;  // NaN when there is no reading
+    float speedKmh;
+    uint8_t page;
+    uint8_t inputs;
+    uint8_t alarmLeds;
+    uint32_t droppedBytes;
+};
+
+constexpr uint8_t kTelemetrySync0 = 0xA5;
+constexpr uint8_t kTelemetrySync1 = 0x5A;
+constexpr uint8_t kTelemetryTypeSample = 0x01;
+constexpr size_t kTelemetryPayloadBytes = 15;
+constexpr size_t kTelemetryFrameBytes = 4 + kTelemetryPayloadBytes + 1;
+
+uint8_t telemetryCrc8(const uint8_t *data, size_t length);
+
+// Writes one frame into \c out; returns its length, or 0 if \c size is short.
+size_t encodeTelemetryFrame(const TelemetrySample &sample, uint8_t *out, size_t size);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+// 4-bit anti-aliased font atlas, produced by tools/generate_alpha_font.py.
+// Coverage is packed two pixels per byte (high nibble first) and every glyph
+// row starts on a byte boundary.
+
+struct AlphaGlyph {
+    uint8_t code;
+    uint16_t offset;   // into AlphaFont::bitmap
+    uint8_t width;
+    uint8_t height;
+    int8_t xOffset;    // ink left edge relative to the pen
+    int8_t yOffset;    // ink top relative to the line top
+    uint8_t xAdvance;
+};
+
+struct AlphaKerning {
+    uint8_t left;
+    uint8_t right;
+    int8_t adjust;
+};
+
+struct AlphaFont {
+    const uint8_t *bitmap;
+    const AlphaGlyph *glyphs;   // sorted by code
+    uint8_t glyphCount;
+    const AlphaKerning *kerning;
+    uint16_t kerningCount;
+    uint8_t lineHeight;
+    uint8_t baseline;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Adafruit_GC9A01A.h"
+#include "esp32_dash/display/AlphaFont.h"
+
+// Width in pixels of \c text set in \c font, kerning included.
+int16_t alphaTextWidth(const AlphaFont &font, const char *text);
+
+/**
+ * Draws \c text with its line top at (\c x, \c top), blending coverage
+ * between \c color and \c backgroundColor.
+ *
+ * The whole string is one opaque box of alphaTextWidth x lineHeight pixels
+ * streamed through a single address window, one row at a time, so it costs
+ * one SPI transaction instead of a fillRect per scaled classic-font pixel.
+ * Ink that overhangs its kerned cell is clipped.
+ */
+void drawAlphaText(Adafruit_GC9A01A &display,
+                   const AlphaFont &font,
+                   const char *text,
+                   int16_t x,
+                   int16_t top,
+                   uint16_t color,
+                   uint16_t backgroundColor);
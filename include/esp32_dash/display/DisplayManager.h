@@ -6,6 +6,9 @@
 #include <vector>
 
 #include "DisplayPage.h"
+#include "PageRotation.h"
+#include "PageSet.h"
+#include "RleImage.h"
 
 struct DisplayConfig {
     int8_t csPin = 5;
@@ -17,6 +20,9 @@ struct DisplayConfig {
     uint8_t rotation = 0;
     uint16_t backgroundColor = 0xffff;  // white
     uint32_t refreshIntervalMs = 1000;
+    uint32_t animationFrameIntervalMs = 33;  // page tick() cadence, ~30 FPS
+    bool dmaTransfers = true;  // queue SPI traffic to DMA instead of blocking writes
+    uint32_t spiClockHz = 40000000;
     uint16_t width = 240;
     uint16_t height = 240;
 };
@@ -29,32 +35,62 @@ public:
     void loop();
 
     void addPage(DisplayPage *page);
+
+    // Drive a compile-time PageSet instead of pages added with addPage.
+    // The set must outlive the manager.
+    template <typename... Pages>
+    void setPages(PageSet<Pages...> &pages) {
+        bindPageTable(&PageSet<Pages...>::table(), &pages);
+    }
+
     void nextPage();
     void previousPage();
     void showPage(size_t index);
 
     void requestRefresh();
+    // Lets \c rotation move between pages on its own; nullptr turns it off.
+    void setPageRotation(PageRotation *rotation) { _pageRotation = rotation; }
     void setSuspended(bool suspended);
     bool isSuspended() const { return _suspended; }
+    // Sends the GC9A01A sleep-in/display-off pair, or sleep-out/display-on.
+    // Pair with setSuspended so nothing draws to a sleeping panel.
+    void setPanelAsleep(bool asleep);
 
     void showTransientMessage(const String &message,
                               uint32_t durationMs = 1000,
                               uint16_t textColor = 0xFFFF,
                               uint16_t backgroundColor = 0x0000);
 
+    // Like showTransientMessage, but shows \c image centred on \c backgroundColor.
+    void showTransientImage(const RleImage &image,
+                            uint32_t durationMs = 1000,
+                            uint16_t backgroundColor = 0x0000);
+
     Adafruit_GC9A01A *display();
     bool isReady() const { return _initialized; }
+    bool hasTransient() const { return _transientMessage.active; }
     uint8_t currentPageIndex() const { return _currentPage; }
+    // Counts frames drawn by loop(); lets callers see when a frame went out.
+    uint32_t framesDrawn() const { return _framesDrawn; }
 
 private:
     void drawPlaceholder();
     void drawTransientOverlay();
+    void sendPanelCommand(uint8_t command);
     void resetCurrentPageLayout();
+    void bindPageTable(const PageTable *table, void *pages);
+
+    size_t pageCount() const;
+    void enterPage(size_t index);
+    void exitPage(size_t index);
+    void renderPage(size_t index);
+    bool tickPage(size_t index, uint32_t nowMs);
 
     struct TransientMessage {
         bool active = false;
         bool requiresPageReset = false;
         String text;
+        const RleImage *image = nullptr;
         uint32_t shownAt = 0;
         uint32_t durationMs = 0;
         uint16_t textColor = 0xFFFF;
@@ -64,8 +100,13 @@ private:
     DisplayConfig _config;
     std::unique_ptr<Adafruit_GC9A01A> _display;
     std::vector<DisplayPage *> _pages;
+    const PageTable *_pageTable = nullptr;
+    PageRotation *_pageRotation = nullptr;
+    void *_pageSet = nullptr;
     size_t _currentPage = 0;
     uint32_t _lastRender = 0;
+    uint32_t _lastAnimationTick = 0;
+    uint32_t _framesDrawn = 0;
     bool _initialized = false;
     bool _dirty = true;
     bool _suspended = false;
@@ -8,7 +8,9 @@
  *
  * Extend this class to implement custom pages. Override \c render to draw
  * your page and optionally \c onEnter / \c onExit to perform setup or cleanup
- * whenever the page becomes active or inactive.
+ * whenever the page becomes active or inactive. Animated pages override
+ * \c tick, which the manager calls at its frame rate; return true when the
+ * next \c render would change pixels.
  */
 class DisplayPage {
 public:
@@ -16,5 +18,23 @@ public:
 
     virtual void onEnter(Adafruit_GC9A01A &display) { (void) display; }
     virtual void onExit(Adafruit_GC9A01A &display) { (void) display; }
+    virtual bool tick(uint32_t nowMs) {
+        (void) nowMs;
+        return false;
+    }
     virtual void render(Adafruit_GC9A01A &display) = 0;
 };
+
+/**
+ * Base of the built-in pages. Runtime builds register them by pointer and
+ * need the DisplayPage vtable. Static-page builds only reach them through
+ * PageSet, so the base is empty and the vtables are dropped; the benchmark
+ * build keeps them so it can time both paths.
+ */
+#if DASH_STATIC_PAGES && !DASH_BENCHMARK
+struct DashPageBase {};
+#define DASH_PAGE_OVERRIDE
+#else
+using DashPageBase = DisplayPage;
+#define DASH_PAGE_OVERRIDE override
+#endif
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Adafruit_GC9A01A.h"
+
+#include "esp32_dash/display/SpiDmaQueue.h"
+
+/**
+ * Writes \c count pixels into the window opened by the last setAddrWindow().
+ *
+ * Adafruit_SPITFT::writePixels is not virtual, so streaming helpers (RLE
+ * images, alpha text) call this instead: it goes through the DMA queue when
+ * \c display is the active DmaGC9A01A and through writePixels otherwise.
+ */
+void writePixelBlock(Adafruit_GC9A01A &display, uint16_t *pixels, uint32_t count);
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+struct DmaDisplayConfig {
+    int8_t sclkPin = 18;
+    int8_t mosiPin = 23;
+    uint32_t clockHz = 40000000;
+    uint16_t linePixels = 1920;  // per line buffer, 8 rows of the panel
+};
+
+/**
+ * GC9A01A driver that hands pixel traffic to the ESP32 SPI DMA engine.
+ *
+ * The Adafruit base still runs the panel init sequence over Arduino SPI;
+ * beginDma() then releases that bus and reopens it through spi_master. From
+ * there every primitive a page can reach (fills, lines, pixels, text and
+ * address windows) is handed to an SpiDmaQueue: large ones are queued and
+ * return at once, with pixel data alternating between two DMA-capable line
+ * buffers so the CPU fills one while the other is on the wire; single pixels
+ * and short lines are sent by polling. Until beginDma() succeeds the class
+ * behaves exactly like Adafruit_GC9A01A.
+ */
+class DmaGC9A01A final : public Adafruit_GC9A01A {
+public:
+    DmaGC9A01A(int8_t csPin, int8_t dcPin, int8_t rstPin, const DmaDisplayConfig &config = {});
+    ~DmaGC9A01A();
+
+    bool beginDma();
+    bool dmaActive() const { return _queue.attached(); }
+    void setTransferMode(SpiTransferMode mode) { _queue.setMode(mode); }
+    const SpiDmaQueue &transfers() const { return _queue; }
+
+    // Blocks until every queued transaction has been clocked out.
+    void flush();
+
+    void queueCommand(uint8_t command, const uint8_t *data = nullptr, uint8_t length = 0);
+    void pushPixels(const uint16_t *pixels, uint32_t count);
+
+    static DmaGC9A01A *active() { return s_active; }
+
+    void startWrite() override;
+    void endWrite() override;
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+private:
+    bool clip(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+    void fillWindow(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void releaseBus();
+
+    static DmaGC9A01A *s_active;
+
+    DmaDisplayConfig _config;
+    int8_t _csPin;
+    int8_t _dcPin;
+    spi_device_handle_t _device = nullptr;
+    uint16_t *_buffers[2] = {nullptr, nullptr};
+    SpiDmaQueue _queue;
+};
+
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Decides when DisplayManager should move on to the next data page.
+ *
+ * A page is held for at least \c dwellMs. It is held for longer, up to
+ * \c maxDwellMs, while its value is still changing, and for as long as it
+ * is flagged as alarming. Pages whose data has gone stale are skipped.
+ * Button input pauses rotation for \c userPauseMs. A page that was never
+ * added is not rotated away from.
+ *
+ * Once a switch is due it waits for a frame the display was going to draw
+ * anyway, so rotating never adds a full redraw. It waits at most
+ * \c maxSwitchDelayMs.
+ */
+class PageRotation {
+public:
+    struct Config {
+        uint32_t dwellMs;
+        uint32_t maxDwellMs;
+        uint32_t settleMs;          // a value quiet this long counts as settled
+        uint32_t staleAfterMs;      // a page with no sample this long is skipped
+        uint32_t userPauseMs;
+        uint32_t maxSwitchDelayMs;
+    };
+
+    static constexpr size_t kMaxPages = 8;
+
+    explicit PageRotation(const Config &config);
+
+    // Pages rotate in the order they are added. A change of at least
+    // \c changeThreshold between samples counts as the value moving.
+    void addPage(size_t pageIndex, float changeThreshold);
+
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    bool isEnabled() const { return _enabled; }
+
+    void noteValue(size_t pageIndex, float value, uint32_t nowMs);
+    void setAlarming(size_t pageIndex, bool alarming);
+    void noteUserInput(uint32_t nowMs);
+
+    // Called once per display loop with the page on screen. \c frameDue says
+    // whether this loop renders anyway. Returns true with \c next set when
+    // the caller should switch now.
+    bool poll(size_t currentPage, uint32_t nowMs, bool frameDue, size_t &next);
+
+private:
+    struct Slot {
+        size_t page;
+        float changeThreshold;
+        float lastValue;
+        uint32_t sampledAtMs;
+        uint32_t changedAtMs;
+        bool sampled;
+        bool alarming;
+    };
+
+    Slot *find(size_t pageIndex);
+    bool isFresh(const Slot &slot, uint32_t nowMs) const;
+    bool shouldHold(const Slot &slot, uint32_t nowMs) const;
+    bool pickNext(size_t currentPage, uint32_t nowMs, size_t &next) const;
+
+    Config _config;
+    Slot _slots[kMaxPages];
+    size_t _count;
+    size_t _shownPage;
+    uint32_t _shownAtMs;
+    uint32_t _userInputAtMs;
+    uint32_t _dueSinceMs;
+    bool _userInput;
+    bool _due;
+    bool _enabled;
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stddef.h>
+#include <tuple>
+#include <utility>
+
+#include "Adafruit_GC9A01A.h"
+
+/**
+ * Type-erased view of a page collection handed to DisplayManager.
+ *
+ * One table exists per PageSet type (not per page) and lives in flash; each
+ * entry forwards an index to the set's static dispatch.
+ */
+struct PageTable {
+    size_t count;
+    void (*enter)(void *pages, size_t index, Adafruit_GC9A01A &display);
+    void (*exit)(void *pages, size_t index, Adafruit_GC9A01A &display);
+    void (*render)(void *pages, size_t index, Adafruit_GC9A01A &display);
+    bool (*tick)(void *pages, size_t index, uint32_t nowMs);
+};
+
+/**
+ * Compile-time page registry.
+ *
+ * Pages are stored by value in a tuple, so the set needs no heap and calls
+ * resolve to the concrete page type. Page types only need \c render and, if
+ * they care, \c onEnter / \c onExit / \c tick; they do not have to derive from
+ * DisplayPage, in which case they carry no vtable at all.
+ *
+ * \code
+ * PageSet<StaticTextPage, WaterTempPage, TachPage> pages(
+ *         StaticTextPage("Miata", "Booting"), WaterTempPage(), TachPage());
+ * displayManager.setPages(pages);
+ * \endcode
+ */
+template <typename... Pages>
+class PageSet {
+public:
+    static constexpr size_t kCount = sizeof...(Pages);
+    static_assert(kCount > 0, "PageSet needs at least one page");
+
+    PageSet() = default;
+
+    template <typename... Args>
+    explicit PageSet(Args &&...pages) : _pages(std::forward<Args>(pages)...) {}
+
+    template <size_t Index>
+    auto &get() { return std::get<Index>(_pages); }
+
+    template <typename Page>
+    Page &get() { return std::get<Page>(_pages); }
+
+    void enter(size_t index, Adafruit_GC9A01A &display) {
+        visit(index, [&display](auto &page) { callEnter(page, display, 0); });
+    }
+
+    void exit(size_t index, Adafruit_GC9A01A &display) {
+        visit(index, [&display](auto &page) { callExit(page, display, 0); });
+    }
+
+    void render(size_t index, Adafruit_GC9A01A &display) {
+        visit(index, [&display](auto &page) { page.render(display); });
+    }
+
+    bool tick(size_t index, uint32_t nowMs) {
+        bool changed = false;
+        visit(index, [nowMs, &changed](auto &page) { changed = callTick(page, nowMs, 0); });
+        return changed;
+    }
+
+    template <typename Fn>
+    void visit(size_t index, Fn &&fn) {
+        visitImpl(index, fn, std::index_sequence_for<Pages...>{});
+    }
+
+    static const PageTable &table() {
+        static constexpr PageTable kTable = {
+                kCount,
+                [](void *pages, size_t index, Adafruit_GC9A01A &display) {
+                    static_cast<PageSet *>(pages)->enter(index, display);
+                },
+                [](void *pages, size_t index, Adafruit_GC9A01A &display) {
+                    static_cast<PageSet *>(pages)->exit(index, display);
+                },
+                [](void *pages, size_t index, Adafruit_GC9A01A &display) {
+                    static_cast<PageSet *>(pages)->render(index, display);
+                },
+                [](void *pages, size_t index, uint32_t nowMs) {
+                    return static_cast<PageSet *>(pages)->tick(index, nowMs);
+                },
+        };
+        return kTable;
+    }
+
+private:
+    template <typename Fn, size_t... I>
+    void visitImpl(size_t index, Fn &fn, std::index_sequence<I...>) {
+        (void) ((index == I ? (fn(std::get<I>(_pages)), true) : false) || ...);
+    }
+
+    // Prefer the page's own hook, fall back to a no-op when it has none.
+    template <typename Page>
+    static auto callEnter(Page &page, Adafruit_GC9A01A &display, int)
+            -> decltype(page.onEnter(display), void()) {
+        page.onEnter(display);
+    }
+    template <typename Page>
+    static void callEnter(Page &, Adafruit_GC9A01A &, long) {}
+
+    template <typename Page>
+    static auto callExit(Page &page, Adafruit_GC9A01A &display, int)
+            -> decltype(page.onExit(display), void()) {
+        page.onExit(display);
+    }
+    template <typename Page>
+    static void callExit(Page &, Adafruit_GC9A01A &, long) {}
+
+    template <typename Page>
+    static auto callTick(Page &page, uint32_t nowMs, int) -> decltype(bool(page.tick(nowMs))) {
+        return page.tick(nowMs);
+    }
+    template <typename Page>
+    static bool callTick(Page &, uint32_t, long) { return false; }
+
+    std::tuple<Pages...> _pages;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "Adafruit_GC9A01A.h"
+
+/**
+ * Run-length encoded RGB565 image, produced by tools/convert_rle_image.py.
+ *
+ * Tokens: a header byte with the top bit set is a run of (low 7 bits + 1)
+ * copies of one value; otherwise it is followed by (header + 1) literal
+ * values. A value is a palette index when \c palette is set, else a
+ * little-endian RGB565 word. Runs continue across rows.
+ */
+struct RleImage {
+    uint16_t width;
+    uint16_t height;
+    const uint16_t *palette;
+    uint16_t paletteSize;
+    const uint8_t *data;
+    uint32_t dataSize;
+};
+
+// Expands an RleImage a slice at a time; keeps no more state than the
+// current token, so images never need a framebuffer.
+class RleDecoder {
+public:
+    explicit RleDecoder(const RleImage &image);
+
+    // Writes up to \c count pixels; returns how many were produced.
+    size_t read(uint16_t *out, size_t count);
+    bool done() const { return _remaining == 0 && _position >= _image.dataSize; }
+
+private:
+    uint16_t readValue();
+
+    const RleImage &_image;
+    uint32_t _position;
+    uint8_t _remaining;
+    bool _isRun;
+    uint16_t _runColor;
+};
+
+// Produces the raw-RGB565 flavour of the token stream from pixels pushed in
+// scan order. Used to compress layers rendered on the device.
+class RleEncoder {
+public:
+    explicit RleEncoder(std::vector<uint8_t> &out);
+
+    void push(uint16_t color);
+    void finish();
+
+private:
+    void flushLiteral(size_t count);
+    void emitRun();
+    void emitValue(uint16_t color);
+
+    static constexpr size_t kMaxToken = 128;
+
+    std::vector<uint8_t> &_out;
+    uint16_t _pending[kMaxToken];
+    size_t _pendingCount;
+    uint16_t _runColor;
+    size_t _runLength;
+};
+
+// Streams \c image to (\c x, \c y) through one address window and a line
+// buffer. Images wider than the line buffer or off the panel are skipped.
+void drawRleImage(Adafruit_GC9A01A &display, const RleImage &image, int16_t x, int16_t y);
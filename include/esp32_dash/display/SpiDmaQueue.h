@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(UNIT_TEST)
+#include "driver/spi_master.h"
+
+enum class SpiTransferMode : uint8_t {
+    Auto,     // polling below SpiDmaQueue::kPollingPixels, queued DMA above
+    Queued,   // every transaction through the DMA queue
+    Polling,  // every transaction blocks until it is on the wire
+};
+
+/**
+ * Transaction bookkeeping behind DmaGC9A01A: a ring of queued spi_master
+ * transactions, two line buffers shared between the CPU and the DMA engine,
+ * and the last address window sent to the panel.
+ *
+ * Small primitives (single pixels, short lines) go out as polling
+ * transactions instead: for a few bytes the queue and completion interrupt
+ * cost more than the transfer. spi_master cannot interleave the two kinds,
+ * so switching to polling first drains the queue.
+ *
+ * Kept apart from the Adafruit driver so host tests can run it against a
+ * fake spi_master.
+ */
+class SpiDmaQueue {
+public:
+    static constexpr uint8_t kQueueDepth = 16;
+    static constexpr uint32_t kPollingPixels = 64;
+
+    // \c buffers must be DMA-capable and hold \c linePixels pixels each.
+    void attach(spi_device_handle_t device, int8_t dcPin, uint16_t *const (&buffers)[2], uint16_t linePixels);
+    // Waits for everything queued, then forgets the device.
+    void detach();
+    bool attached() const { return _device != nullptr; }
+
+    void setMode(SpiTransferMode mode) { _mode = mode; }
+    SpiTransferMode mode() const { return _mode; }
+
+    // Chooses polling or queued transfers for a primitive of \c pixels.
+    void prepare(uint32_t pixels);
+
+    void command(uint8_t command, const uint8_t *data = nullptr, uint8_t length = 0);
+    // CASET/PASET go out only when the range changed; RAMWR always does.
+    void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+    void pushPixels(const uint16_t *pixels, uint32_t count);
+    void fill(uint16_t color, uint32_t count);
+    // Blocks until every queued transaction has been clocked out.
+    void flush();
+
+    uint8_t inFlight() const { return _inFlight; }
+    uint8_t bufferUsers(uint8_t index) const { return _bufferUsers[index]; }
+    uint32_t queuedTransactions() const { return _queued; }
+    uint32_t polledTransactions() const { return _polled; }
+
+private:
+    static constexpr int8_t kNoBuffer = -1;
+
+    struct Slot {
+        spi_transaction_t transaction;
+        int8_t buffer;
+    };
+
+    void send(bool data, const void *bytes, size_t length, int8_t buffer);
+    void reapOne();
+    uint16_t *acquireBuffer(int8_t &index);
+
+    spi_device_handle_t _device = nullptr;
+    int8_t _dcPin = -1;
+    uint16_t *_buffers[2] = {nullptr, nullptr};
+    uint16_t _linePixels = 0;
+    uint8_t _bufferUsers[2] = {0, 0};
+    uint8_t _nextBuffer = 0;
+    Slot _slots[kQueueDepth] = {};
+    uint8_t _head = 0;
+    uint8_t _inFlight = 0;
+    SpiTransferMode _mode = SpiTransferMode::Auto;
+    bool _polling = false;
+    uint32_t _queued = 0;
+    uint32_t _polled = 0;
+    uint16_t _windowX0 = 0xFFFF;
+    uint16_t _windowX1 = 0xFFFF;
+    uint16_t _windowY0 = 0xFFFF;
+    uint16_t _windowY1 = 0xFFFF;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+#include "Adafruit_GC9A01A.h"
+#include "esp32_dash/display/RleImage.h"
+
+/**
+ * Compressed off-screen copies of page backgrounds.
+ *
+ * A page hands over the code that draws its static layer (background, dial,
+ * fixed labels). On the first request the cache runs it into a small band
+ * canvas, RLE-encodes the bands into RAM and blits the result; later page
+ * switches restore the layer in a single address-window burst instead of
+ * redrawing it. Entries are evicted least-recently-used to stay inside the
+ * byte budget.
+ */
+class StaticLayerCache {
+public:
+    struct Config {
+        uint32_t budgetBytes;
+        uint16_t bandRows;
+    };
+
+    static constexpr size_t kMaxEntries = 4;
+
+    using DrawFn = void (*)(void *context, Adafruit_GFX &gfx);
+
+    explicit StaticLayerCache(const Config &config);
+
+    // Blits the cached layer for \c owner; false when it is not cached.
+    bool restore(const void *owner, Adafruit_GC9A01A &display);
+
+    // Renders the layer off-screen, keeps it if it fits the budget and blits
+    // it. Returns false when it could not be cached; the caller then draws
+    // directly.
+    bool capture(const void *owner, Adafruit_GC9A01A &display, DrawFn draw, void *context);
+
+    template <typename Fn>
+    bool restoreOrCapture(const void *owner, Adafruit_GC9A01A &display, Fn &&draw) {
+        if (restore(owner, display)) {
+            return true;
+        }
+        using Callable = typename std::remove_reference<Fn>::type;
+        return capture(owner, display, [](void *context, Adafruit_GFX &gfx) {
+            (*static_cast<Callable *>(context))(gfx);
+        }, &draw);
+    }
+
+    // Drop \c owner's layer after its static content changed.
+    void invalidate(const void *owner);
+    void clear();
+
+    uint32_t bytesUsed() const { return _bytesUsed; }
+    size_t entryCount() const;
+    uint32_t hits() const { return _hits; }
+    uint32_t misses() const { return _misses; }
+
+private:
+    struct Entry {
+        const void *owner = nullptr;
+        std::vector<uint8_t> data;
+        uint32_t lastUsed = 0;
+    };
+
+    Entry *find(const void *owner);
+    Entry *makeRoom(uint32_t bytes);
+    void release(Entry &entry);
+    void blit(Entry &entry, Adafruit_GC9A01A &display);
+
+    Config _config;
+    Entry _entries[kMaxEntries];
+    uint32_t _bytesUsed;
+    uint32_t _useClock;
+    uint32_t _hits;
+    uint32_t _misses;
+};
+
+// Shared cache used by pages with a static layer.
+StaticLayerCache &staticLayerCache();
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Critically damped follower for displayed values.
+ *
+ * Sensors hand in samples whenever they have them; the display steps the
+ * tween at its own frame rate and reads back a smoothed value that reaches
+ * the latest sample without overshoot. Once within \c settleEpsilon the value
+ * snaps to the target and \c step reports no motion, so an idle readout
+ * costs no frames.
+ */
+class ValueTween {
+public:
+    struct Config {
+        float timeConstantMs;   // larger follows more lazily
+        float settleEpsilon;    // in display units
+    };
+
+    explicit ValueTween(const Config &config);
+
+    // The first sample is shown as-is; later ones are animated towards.
+    void setTarget(float target, uint32_t timestampMs);
+    void snapTo(float value, uint32_t timestampMs);
+
+    // Advances to \c nowMs. Returns true when the value moved.
+    bool step(uint32_t nowMs);
+
+    float value() const { return _value; }
+    float target() const { return _target; }
+    bool isSettled() const { return _settled; }
+
+private:
+    Config _config;
+    float _value;
+    float _velocity;  // units per ms
+    float _target;
+    uint32_t _lastStepMs;
+    bool _hasValue;
+    bool _settled;
+};
@@ -0,0 +1,851 @@
+#pragma once
+
+// Generated by tools/convert_rle_image.py from boot_logo.png.
+// Do not edit by hand; re-run the script instead.
+
+#include "esp32_dash/display/RleImage.h"
+
+namespace images {
+
+inline constexpr uint16_t kBootLogoPalette[] = {
+        0xFFFF, 0xFFFF, 0xCE59, 0x4A69, 0x0020, 0x0000, 0xD000, 0xC800,
+        0xC800, 0xC000, 0xC000, 0xA000, 0x3000, 0x0000, 0x0000, 0x0000,
+};
+
+inline constexpr uint8_t kBootLogoData[] = {
+        0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F,
+        0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F,
+        0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xC2, 0x0F, 0x89, 0x0E, 0xFF, 0x0F,
+        0xDB, 0x0F, 0x00, 0x0E, 0x88, 0x0D, 0x89, 0x0F, 0x00, 0x0E, 0x87, 0x0D, 0x00, 0x0E, 0xFF, 0x0F,
+        0xCB, 0x0F, 0x00, 0x0E, 0x83, 0x0D, 0x8A, 0x0F, 0x89, 0x0D, 0x8A, 0x0F, 0x83, 0x0D, 0x00, 0x0E,
+        0xFF, 0x0F, 0xC0, 0x0F, 0x00, 0x0E, 0x82, 0x0D, 0x00, 0x0E, 0x85, 0x0F, 0x00, 0x0D, 0x84, 0x0C,
+        0x83, 0x0B, 0x89, 0x0A, 0x83, 0x0B, 0x84, 0x0C, 0x01, 0x0D, 0x0D, 0x85, 0x0F, 0x82, 0x0D, 0x00,
+        0x0E, 0xFF, 0x0F, 0xB8, 0x0F, 0x02, 0x0E, 0x0D, 0x0D, 0x84, 0x0F, 0x00, 0x0D, 0x82, 0x0C, 0x03,
+        0x0B, 0x0B, 0x0A, 0x09, 0x87, 0x06, 0x8A, 0x07, 0x86, 0x06, 0x01, 0x07, 0x0A, 0x82, 0x0B, 0x02,
+        0x0C, 0x0C, 0x04, 0x84, 0x0F, 0x82, 0x0D, 0x00, 0x0E, 0xFF, 0x0F, 0xB1, 0x0F, 0x02, 0x0D, 0x0D,
+        0x0E, 0x82, 0x0F, 0x06, 0x0D, 0x0C, 0x0C, 0x0B, 0x0B, 0x0A, 0x07, 0x82, 0x06, 0x04, 0x07, 0x07,
+        0x08, 0x09, 0x09, 0x82, 0x0A, 0x90, 0x09, 0x82, 0x0A, 0x03, 0x09, 0x08, 0x07, 0x07, 0x82, 0x06,
+        0x06, 0x07, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x83, 0x0F, 0x02, 0x0D, 0x0D, 0x0E, 0xFF, 0x0F,
+        0xAB, 0x0F, 0x01, 0x0D, 0x0D, 0x83, 0x0F, 0x04, 0x04, 0x0C, 0x0B, 0x0B, 0x08, 0x82, 0x06, 0x03,
+        0x07, 0x09, 0x0A, 0x0A, 0x82, 0x09, 0x88, 0x08, 0x89, 0x09, 0x88, 0x08, 0x82, 0x09, 0x0C, 0x0A,
+        0x0A, 0x09, 0x07, 0x07, 0x06, 0x06, 0x07, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x82, 0x0F, 0x02, 0x0D,
+        0x0D, 0x0E, 0xFF, 0x0F, 0xA5, 0x0F, 0x01, 0x0D, 0x0D, 0x82, 0x0F, 0x0C, 0x0D, 0x0C, 0x0C, 0x0B,
+        0x0A, 0x06, 0x06, 0x07, 0x08, 0x0A, 0x0A, 0x09, 0x09, 0x84, 0x08, 0x83, 0x09, 0x82, 0x0A, 0x82,
+        0x09, 0x89, 0x07, 0x83, 0x09, 0x82, 0x0A, 0x82, 0x09, 0x84, 0x08, 0x0C, 0x09, 0x09, 0x0A, 0x0A,
+        0x09, 0x07, 0x06, 0x06, 0x08, 0x0B, 0x0C, 0x0C, 0x0D, 0x82, 0x0F, 0x01, 0x0D, 0x0D, 0xFF, 0x0F,
+        0xA0, 0x0F, 0x0F, 0x0E, 0x0D, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x0B, 0x07, 0x06, 0x07, 0x08,
+        0x09, 0x0A, 0x09, 0x84, 0x08, 0x06, 0x09, 0x09, 0x0A, 0x0A, 0x09, 0x08, 0x07, 0x84, 0x06, 0x82,
+        0x07, 0x89, 0x0A, 0x02, 0x07, 0x06, 0x07, 0x84, 0x06, 0x04, 0x07, 0x07, 0x09, 0x09, 0x0A, 0x82,
+        0x09, 0x83, 0x08, 0x0F, 0x09, 0x0A, 0x0A, 0x08, 0x07, 0x06, 0x07, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F,
+        0x0F, 0x0E, 0x0D, 0x0E, 0xFF, 0x0F, 0x9B, 0x0F, 0x01, 0x0E, 0x0D, 0x82, 0x0F, 0x09, 0x0C, 0x0C,
+        0x0B, 0x07, 0x06, 0x07, 0x09, 0x0A, 0x09, 0x09, 0x82, 0x08, 0x05, 0x09, 0x09, 0x0A, 0x0A, 0x08,
+        0x07, 0x83, 0x06, 0x03, 0x0A, 0x0A, 0x0B, 0x0B, 0x85, 0x0C, 0x89, 0x0D, 0x85, 0x0C, 0x82, 0x0B,
+        0x01, 0x0A, 0x07, 0x82, 0x06, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x09, 0x09, 0x83, 0x08, 0x08, 0x09,
+        0x0A, 0x09, 0x07, 0x06, 0x06, 0x0B, 0x0B, 0x0C, 0x82, 0x0F, 0x01, 0x0D, 0x0D, 0xFF, 0x0F, 0x97,
+        0x0F, 0x0C, 0x0D, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x0A, 0x06, 0x07, 0x09, 0x0A, 0x09, 0x83,
+        0x08, 0x07, 0x09, 0x0A, 0x09, 0x08, 0x07, 0x06, 0x06, 0x08, 0x82, 0x0B, 0x03, 0x0C, 0x0C, 0x04,
+        0x0D, 0x99, 0x0F, 0x01, 0x0D, 0x04, 0x82, 0x0C, 0x02, 0x0B, 0x0B, 0x0A, 0x82, 0x06, 0x03, 0x07,
+        0x09, 0x0A, 0x09, 0x83, 0x08, 0x0C, 0x09, 0x0A, 0x09, 0x07, 0x06, 0x07, 0x0B, 0x0C, 0x04, 0x0F,
+        0x0F, 0x0E, 0x0D, 0xFF, 0x0F, 0x93, 0x0F, 0x0B, 0x0D, 0x0D, 0x0F, 0x0F, 0x04, 0x0C, 0x0B, 0x06,
+        0x06, 0x08, 0x0A, 0x09, 0x83, 0x08, 0x0B, 0x09, 0x0A, 0x09, 0x07, 0x06, 0x06, 0x0A, 0x0B, 0x0B,
+        0x0C, 0x0C, 0x0D, 0x85, 0x0F, 0x00, 0x0E, 0x86, 0x0D, 0x89, 0x0E, 0x87, 0x0D, 0x85, 0x0F, 0x0C,
+        0x0D, 0x04, 0x0C, 0x0C, 0x0B, 0x0A, 0x07, 0x06, 0x07, 0x08, 0x0A, 0x0A, 0x09, 0x82, 0x08, 0x0C,
+        0x09, 0x0A, 0x09, 0x07, 0x06, 0x0A, 0x0B, 0x0C, 0x0F, 0x0F, 0x0E, 0x0D, 0x0E, 0xFF, 0x0F, 0x8E,
+        0x0F, 0x0A, 0x0D, 0x0E, 0x0F, 0x0F, 0x0C, 0x0B, 0x0A, 0x06, 0x07, 0x09, 0x0A, 0x83, 0x08, 0x09,
+        0x09, 0x0A, 0x08, 0x07, 0x06, 0x07, 0x0B, 0x0B, 0x0C, 0x04, 0x84, 0x0F, 0x83, 0x0D, 0x01, 0x0E,
+        0x0E, 0x99, 0x0F, 0x01, 0x0E, 0x0E, 0x83, 0x0D, 0x84, 0x0F, 0x0A, 0x0D, 0x0C, 0x0C, 0x0B, 0x09,
+        0x06, 0x06, 0x08, 0x0A, 0x0A, 0x09, 0x82, 0x08, 0x06, 0x09, 0x0A, 0x07, 0x06, 0x08, 0x0B, 0x0C,
+        0x82, 0x0F, 0x00, 0x0D, 0xFF, 0x0F, 0x8B, 0x0F, 0x0A, 0x0D, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x09,
+        0x06, 0x08, 0x0A, 0x09, 0x82, 0x08, 0x09, 0x09, 0x0A, 0x08, 0x07, 0x06, 0x08, 0x0B, 0x0C, 0x0C,
+        0x0D, 0x83, 0x0F, 0x82, 0x0D, 0x00, 0x0E, 0xA6, 0x0F, 0x00, 0x0E, 0x82, 0x0D, 0x83, 0x0F, 0x08,
+        0x0C, 0x0C, 0x0B, 0x0A, 0x06, 0x06, 0x08, 0x0A, 0x09, 0x82, 0x08, 0x0A, 0x09, 0x0A, 0x08, 0x06,
+        0x07, 0x0B, 0x0C, 0x0D, 0x0F, 0x0D, 0x0D, 0xFF, 0x0F, 0x87, 0x0F, 0x0A, 0x0E, 0x0D, 0x0F, 0x0F,
+        0x0C, 0x0B, 0x07, 0x06, 0x08, 0x0A, 0x09, 0x82, 0x08, 0x07, 0x09, 0x0A, 0x07, 0x06, 0x08, 0x0B,
+        0x0C, 0x0C, 0x83, 0x0F, 0x02, 0x0D, 0x0D, 0x0E, 0xAF, 0x0F, 0x02, 0x0E, 0x0D, 0x0D, 0x83, 0x0F,
+        0x08, 0x04, 0x0C, 0x0B, 0x0A, 0x06, 0x07, 0x09, 0x0A, 0x09, 0x82, 0x08, 0x09, 0x0A, 0x09, 0x06,
+        0x06, 0x0B, 0x0C, 0x0F, 0x0F, 0x0E, 0x0D, 0xFF, 0x0F, 0x84, 0x0F, 0x08, 0x0D, 0x0F, 0x0F, 0x0C,
+        0x0B, 0x08, 0x06, 0x09, 0x0A, 0x82, 0x08, 0x07, 0x09, 0x0A, 0x08, 0x06, 0x06, 0x0B, 0x0B, 0x0C,
+        0x82, 0x0F, 0x02, 0x0E, 0x0D, 0x0D, 0xB7, 0x0F, 0x82, 0x0D, 0x82, 0x0F, 0x07, 0x04, 0x0C, 0x0B,
+        0x07, 0x06, 0x08, 0x0A, 0x09, 0x82, 0x08, 0x09, 0x09, 0x0A, 0x07, 0x06, 0x0B, 0x0C, 0x0F, 0x0F,
+        0x0D, 0x0E, 0xFF, 0x0F, 0x09, 0x0F, 0x0D, 0x0F, 0x0F, 0x04, 0x0B, 0x08, 0x06, 0x08, 0x0A, 0x82,
+        0x08, 0x0C, 0x09, 0x0A, 0x08, 0x06, 0x08, 0x0B, 0x0C, 0x0D, 0x0F, 0x0F, 0x0E, 0x0D, 0x0D, 0xBD,
+        0x0F, 0x0C, 0x0E, 0x0D, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x0A, 0x06, 0x07, 0x0A, 0x09, 0x82,
+        0x08, 0x08, 0x09, 0x09, 0x06, 0x07, 0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0xFD, 0x0F, 0x08, 0x0E, 0x0D,
+        0x0F, 0x0D, 0x0C, 0x0A, 0x06, 0x08, 0x0A, 0x82, 0x08, 0x06, 0x09, 0x0A, 0x07, 0x06, 0x0A, 0x0B,
+        0x0C, 0x82, 0x0F, 0x01, 0x0D, 0x0D, 0xC3, 0x0F, 0x01, 0x0E, 0x0D, 0x82, 0x0F, 0x06, 0x04, 0x0C,
+        0x0A, 0x06, 0x07, 0x0A, 0x09, 0x82, 0x08, 0x08, 0x0A, 0x09, 0x06, 0x08, 0x0B, 0x04, 0x0F, 0x0E,
+        0x0D, 0xFA, 0x0F, 0x07, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x06, 0x07, 0x0A, 0x82, 0x08, 0x0B, 0x09,
+        0x0A, 0x07, 0x06, 0x0A, 0x0C, 0x04, 0x0F, 0x0F, 0x0E, 0x0D, 0x0E, 0xC8, 0x0F, 0x0A, 0x0D, 0x0D,
+        0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x06, 0x07, 0x0A, 0x09, 0x82, 0x08, 0x07, 0x0A, 0x08, 0x06, 0x0A,
+        0x0C, 0x0F, 0x0F, 0x0D, 0xF7, 0x0F, 0x08, 0x0E, 0x0D, 0x0F, 0x0D, 0x0B, 0x07, 0x07, 0x0A, 0x09,
+        0x82, 0x08, 0x09, 0x0A, 0x07, 0x06, 0x0A, 0x0C, 0x04, 0x0F, 0x0F, 0x0D, 0x0D, 0xCD, 0x0F, 0x0A,
+        0x0E, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x06, 0x07, 0x0A, 0x09, 0x82, 0x08, 0x07, 0x0A, 0x07,
+        0x06, 0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0xF4, 0x0F, 0x07, 0x0D, 0x0F, 0x0F, 0x0C, 0x0A, 0x06, 0x09,
+        0x09, 0x82, 0x08, 0x09, 0x0A, 0x08, 0x06, 0x0A, 0x0C, 0x04, 0x0F, 0x0F, 0x0D, 0x0E, 0xD1, 0x0F,
+        0x09, 0x0E, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x06, 0x07, 0x0A, 0x82, 0x08, 0x07, 0x09, 0x0A,
+        0x06, 0x08, 0x0C, 0x0D, 0x0F, 0x0D, 0xF2, 0x0F, 0x06, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 0x07, 0x0A,
+        0x82, 0x08, 0x09, 0x09, 0x09, 0x06, 0x08, 0x0B, 0x04, 0x0F, 0x0F, 0x0D, 0x0E, 0xD6, 0x0F, 0x08,
+        0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0A, 0x06, 0x08, 0x0A, 0x82, 0x08, 0x07, 0x0A, 0x08, 0x06, 0x0B,
+        0x0C, 0x0F, 0x0D, 0x0E, 0xEE, 0x0F, 0x07, 0x0E, 0x0D, 0x0F, 0x0C, 0x0B, 0x06, 0x0A, 0x09, 0x82,
+        0x08, 0x08, 0x0A, 0x07, 0x06, 0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0x0E, 0xDA, 0x0F, 0x12, 0x0D, 0x0F,
+        0x0F, 0x04, 0x0B, 0x07, 0x06, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x06, 0x0A, 0x0C, 0x0F, 0x0F,
+        0x0D, 0xEC, 0x0F, 0x06, 0x0D, 0x0F, 0x0F, 0x0C, 0x07, 0x07, 0x0A, 0x82, 0x08, 0x08, 0x09, 0x08,
+        0x06, 0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0x0E, 0xDE, 0x0F, 0x07, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x06,
+        0x07, 0x0A, 0x82, 0x08, 0x06, 0x0A, 0x08, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xEA, 0x0F, 0x06, 0x0D,
+        0x0F, 0x04, 0x0B, 0x06, 0x09, 0x09, 0x82, 0x08, 0x07, 0x0A, 0x07, 0x07, 0x0B, 0x0D, 0x0F, 0x0D,
+        0x0D, 0xE1, 0x0F, 0x12, 0x0E, 0x0D, 0x0F, 0x0F, 0x0C, 0x0A, 0x06, 0x09, 0x09, 0x08, 0x08, 0x09,
+        0x0A, 0x06, 0x0B, 0x0C, 0x0F, 0x0D, 0x0E, 0xE6, 0x0F, 0x06, 0x0E, 0x0D, 0x0F, 0x0C, 0x0A, 0x06,
+        0x0A, 0x82, 0x08, 0x07, 0x09, 0x09, 0x06, 0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0xE5, 0x0F, 0x07, 0x0D,
+        0x0E, 0x0F, 0x04, 0x0B, 0x06, 0x07, 0x0A, 0x82, 0x08, 0x06, 0x0A, 0x07, 0x07, 0x0C, 0x0F, 0x0F,
+        0x0D, 0xE4, 0x0F, 0x06, 0x0E, 0x0E, 0x0F, 0x0C, 0x07, 0x07, 0x0A, 0x82, 0x08, 0x07, 0x0A, 0x07,
+        0x07, 0x0C, 0x0D, 0x0F, 0x0D, 0x0E, 0xE8, 0x0F, 0x06, 0x0D, 0x0F, 0x0F, 0x0C, 0x0A, 0x06, 0x0A,
+        0x82, 0x08, 0x06, 0x09, 0x08, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xE2, 0x0F, 0x10, 0x0D, 0x0F, 0x0D,
+        0x0B, 0x06, 0x09, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x06, 0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0xEB, 0x0F,
+        0x10, 0x0E, 0x0D, 0x0F, 0x04, 0x0B, 0x06, 0x09, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x06, 0x0B, 0x04,
+        0x0F, 0x0D, 0xE0, 0x0F, 0x0F, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x08,
+        0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xEF, 0x0F, 0x06, 0x0D, 0x0F, 0x0F, 0x0C, 0x07, 0x07, 0x0A, 0x82,
+        0x08, 0x05, 0x0A, 0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xDE, 0x0F, 0x05, 0x0D, 0x0F, 0x0C, 0x0B, 0x06,
+        0x0A, 0x82, 0x08, 0x06, 0x0A, 0x07, 0x07, 0x0C, 0x0F, 0x0F, 0x0D, 0xF1, 0x0F, 0x06, 0x0D, 0x0D,
+        0x0F, 0x0C, 0x0A, 0x06, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xDC, 0x0F,
+        0x05, 0x0D, 0x0F, 0x0C, 0x0A, 0x06, 0x0A, 0x82, 0x08, 0x06, 0x0A, 0x06, 0x0B, 0x0C, 0x0F, 0x0D,
+        0x0E, 0xF4, 0x0F, 0x0E, 0x0D, 0x0F, 0x04, 0x0B, 0x06, 0x09, 0x09, 0x08, 0x08, 0x0A, 0x07, 0x06,
+        0x0C, 0x0F, 0x0D, 0xDA, 0x0F, 0x0E, 0x0D, 0x0F, 0x0C, 0x0A, 0x07, 0x0A, 0x08, 0x08, 0x09, 0x0A,
+        0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xF7, 0x0F, 0x0E, 0x0D, 0x0F, 0x0F, 0x0B, 0x06, 0x09, 0x09, 0x08,
+        0x08, 0x09, 0x08, 0x06, 0x0C, 0x0F, 0x0D, 0xD8, 0x0F, 0x0E, 0x0D, 0x0F, 0x0C, 0x0A, 0x07, 0x0A,
+        0x08, 0x08, 0x09, 0x09, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xF9, 0x0F, 0x0F, 0x0E, 0x0D, 0x0F, 0x0C,
+        0x06, 0x07, 0x09, 0x08, 0x08, 0x09, 0x08, 0x07, 0x0C, 0x0F, 0x0D, 0x0E, 0xD5, 0x0F, 0x0E, 0x0D,
+        0x0F, 0x0C, 0x06, 0x07, 0x09, 0x08, 0x08, 0x09, 0x08, 0x07, 0x0C, 0x0F, 0x0E, 0x0E, 0xFC, 0x0F,
+        0x0E, 0x0D, 0x0F, 0x0C, 0x0A, 0x07, 0x0A, 0x08, 0x08, 0x09, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x0E,
+        0xD3, 0x0F, 0x0E, 0x0D, 0x0F, 0x0C, 0x06, 0x08, 0x09, 0x08, 0x08, 0x09, 0x07, 0x06, 0x0C, 0x0F,
+        0x0D, 0x0E, 0xFE, 0x0F, 0x05, 0x0D, 0x0F, 0x0C, 0x0A, 0x06, 0x0A, 0x82, 0x08, 0x04, 0x0A, 0x06,
+        0x0B, 0x0F, 0x0D, 0xD2, 0x0F, 0x0D, 0x0D, 0x0F, 0x0C, 0x06, 0x08, 0x09, 0x08, 0x08, 0x0A, 0x07,
+        0x0A, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x07, 0x0F, 0x0F, 0x0D, 0x0F, 0x04, 0x0B, 0x06, 0x0A, 0x82,
+        0x08, 0x04, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xD0, 0x0F, 0x0D, 0x0D, 0x0F, 0x0C, 0x0A, 0x07, 0x09,
+        0x08, 0x08, 0x0A, 0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x83, 0x0F, 0x05, 0x0D, 0x0F, 0x0D,
+        0x0B, 0x06, 0x0A, 0x82, 0x08, 0x04, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xCE, 0x0F, 0x0D, 0x0D, 0x0F,
+        0x0C, 0x0A, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x85, 0x0F,
+        0x0D, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x08, 0x06, 0x0C, 0x0F, 0x0D, 0xCC,
+        0x0F, 0x0D, 0x0D, 0x0F, 0x0C, 0x0A, 0x07, 0x0A, 0x08, 0x08, 0x0A, 0x07, 0x0A, 0x0C, 0x0F, 0x0D,
+        0xFF, 0x0F, 0x87, 0x0F, 0x0D, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x08, 0x06,
+        0x0C, 0x0F, 0x0D, 0xCA, 0x0F, 0x0D, 0x0E, 0x0D, 0x0D, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x07,
+        0x0A, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x89, 0x0F, 0x0D, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 0x0A, 0x08,
+        0x08, 0x09, 0x07, 0x09, 0x0C, 0x0F, 0x0D, 0xC8, 0x0F, 0x0D, 0x0E, 0x0D, 0x0F, 0x0B, 0x06, 0x0A,
+        0x08, 0x08, 0x09, 0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x8B, 0x0F, 0x0D, 0x0D, 0x0F, 0x0D,
+        0x0B, 0x07, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x0A, 0x04, 0x0F, 0x0D, 0xC7, 0x0F, 0x0C, 0x0D, 0x0F,
+        0x0B, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x08, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x8D, 0x0F, 0x0D,
+        0x0D, 0x0F, 0x0D, 0x0A, 0x07, 0x0A, 0x08, 0x08, 0x0A, 0x07, 0x0B, 0x0D, 0x0E, 0x0E, 0xC5, 0x0F,
+        0x04, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x82, 0x08, 0x04, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F,
+        0x8F, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x0A, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D,
+        0xC4, 0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x82, 0x08, 0x04, 0x0A, 0x06, 0x0C, 0x0F, 0x0D,
+        0xFF, 0x0F, 0x91, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x07, 0x08, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xC2, 0x0F, 0x0C, 0x0E, 0x0E, 0x04, 0x0A, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0B,
+        0x0F, 0x0D, 0xFF, 0x0F, 0x93, 0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x82, 0x08, 0x04, 0x09,
+        0x07, 0x0C, 0x0F, 0x0D, 0xC1, 0x0F, 0x0C, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06,
+        0x0B, 0x0F, 0x0D, 0x0E, 0xFF, 0x0F, 0x94, 0x0F, 0x0C, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08,
+        0x09, 0x07, 0x0A, 0x04, 0x0E, 0x0E, 0xBF, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08,
+        0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x0E, 0xFF, 0x0F, 0x96, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A,
+        0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0E, 0x0D, 0xBE, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08,
+        0x08, 0x09, 0x08, 0x07, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x97, 0x0F, 0x0C, 0x0E, 0x0E, 0x0D, 0x0B,
+        0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xBC, 0x0F, 0x0C, 0x0E, 0x0D, 0x0D, 0x0B,
+        0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x99, 0x0F, 0x0C, 0x0D, 0x0F,
+        0x0C, 0x07, 0x08, 0x09, 0x08, 0x09, 0x08, 0x07, 0x0C, 0x0F, 0x0D, 0xBB, 0x0F, 0x0B, 0x0D, 0x0F,
+        0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xFF, 0x0F, 0x9B, 0x0F, 0x0C, 0x0D,
+        0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0x0E, 0xB9, 0x0F, 0x0C, 0x0D,
+        0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x0E, 0xFF, 0x0F, 0x9C, 0x0F,
+        0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xB8, 0x0F, 0x0C,
+        0x0E, 0x0E, 0x0D, 0x0A, 0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x9D,
+        0x0F, 0x0C, 0x0E, 0x0E, 0x0D, 0x0A, 0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xB7,
+        0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F,
+        0x9F, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0x0E,
+        0xB5, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0x0E,
+        0xFF, 0x0F, 0xA0, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F,
+        0x0D, 0xB4, 0x0F, 0x05, 0x0E, 0x0D, 0x0D, 0x0B, 0x07, 0x09, 0x82, 0x08, 0x03, 0x07, 0x0C, 0x0F,
+        0x0D, 0xFF, 0x0F, 0xA1, 0x0F, 0x0C, 0x0E, 0x0D, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x08, 0x0A,
+        0x04, 0x0E, 0x0E, 0xB3, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B,
+        0x0F, 0x0D, 0xFF, 0x0F, 0xA3, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06,
+        0x0B, 0x0F, 0x0D, 0xB2, 0x0F, 0x0C, 0x0E, 0x0E, 0x0D, 0x0A, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0B,
+        0x0D, 0x0D, 0x0E, 0xFF, 0x0F, 0xA4, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A,
+        0x06, 0x0C, 0x0F, 0x0D, 0xB1, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x06,
+        0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xA5, 0x0F, 0x0B, 0x0E, 0x0E, 0x04, 0x0A, 0x08, 0x09, 0x08, 0x09,
+        0x07, 0x0B, 0x0D, 0x0D, 0xB0, 0x0F, 0x02, 0x0D, 0x0E, 0x0C, 0x83, 0x08, 0x04, 0x09, 0x06, 0x0B,
+        0x0F, 0x0D, 0xFF, 0x0F, 0xA7, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06,
+        0x0C, 0x0F, 0x0D, 0xAF, 0x0F, 0x04, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x83, 0x08, 0x02, 0x0C, 0x0E,
+        0x0D, 0xFF, 0x0F, 0xA7, 0x0F, 0x0C, 0x0E, 0x0D, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0B,
+        0x0D, 0x0D, 0x0E, 0xAD, 0x0F, 0x02, 0x0D, 0x0F, 0x0C, 0x83, 0x08, 0x04, 0x0A, 0x06, 0x0B, 0x0F,
+        0x0D, 0xFF, 0x0F, 0xA9, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xAD, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0A, 0x04, 0x0E,
+        0x0E, 0xFF, 0x0F, 0xAA, 0x0F, 0x0B, 0x0D, 0x0D, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0A, 0x0D,
+        0x0E, 0x0E, 0xAB, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F,
+        0x0D, 0xFF, 0x0F, 0xAB, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xAB, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0A, 0x0D, 0x0E,
+        0x0E, 0xFF, 0x0F, 0xAC, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D,
+        0x0E, 0xAA, 0x0F, 0x03, 0x0D, 0x0F, 0x0C, 0x09, 0x82, 0x08, 0x04, 0x0A, 0x06, 0x0C, 0x0F, 0x0D,
+        0xFF, 0x0F, 0xAD, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F,
+        0x0D, 0xA9, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0A, 0x0D, 0x0E, 0x0E,
+        0xFF, 0x0F, 0xAE, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E,
+        0xA8, 0x0F, 0x0B, 0x0E, 0x0F, 0x04, 0x0A, 0x08, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF,
+        0x0F, 0xAF, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D,
+        0xA7, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x08, 0x0A, 0x04, 0x0E, 0x0E, 0xFF,
+        0x0F, 0xB0, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0xA7,
+        0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xFF, 0x0F, 0xB1,
+        0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x83, 0x08, 0x02, 0x0C, 0x0F, 0x0D, 0xA5, 0x0F, 0x04,
+        0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x83, 0x08, 0x02, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xB2, 0x0F, 0x0A,
+        0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xA5, 0x0F, 0x0A, 0x0D, 0x0F,
+        0x0B, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0E, 0x0D, 0xFF, 0x0F, 0xB3, 0x0F, 0x0B, 0x0D, 0x0F,
+        0x0C, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x0E, 0xA3, 0x0F, 0x03, 0x0E, 0x0F, 0x04,
+        0x0A, 0x82, 0x08, 0x04, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xB3, 0x0F, 0x03, 0x0E, 0x0F,
+        0x04, 0x0A, 0x82, 0x08, 0x04, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xA3, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C,
+        0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x0E, 0xFF, 0x0F, 0xB4, 0x0F, 0x0A, 0x0D, 0x0F,
+        0x0B, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0xA3, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07,
+        0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xB5, 0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x06,
+        0x0A, 0x82, 0x08, 0x03, 0x0A, 0x04, 0x0F, 0x0E, 0xA1, 0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x07, 0x09,
+        0x83, 0x08, 0x02, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xB6, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09,
+        0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xA1, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09,
+        0x06, 0x0B, 0x0F, 0x0D, 0x95, 0x0F, 0x00, 0x0E, 0x85, 0x05, 0x9F, 0x0F, 0x85, 0x05, 0x00, 0x0E,
+        0x85, 0x0F, 0x86, 0x05, 0x95, 0x0F, 0x00, 0x0E, 0x85, 0x05, 0x9D, 0x0F, 0x00, 0x0E, 0x93, 0x05,
+        0x00, 0x0E, 0x95, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0E, 0x0D,
+        0xA1, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x9C, 0x0F,
+        0x00, 0x0E, 0x9D, 0x0F, 0x00, 0x0E, 0x8B, 0x0F, 0x00, 0x0E, 0x86, 0x0F, 0x00, 0x0E, 0x9B, 0x0F,
+        0x00, 0x0E, 0xC8, 0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x83, 0x08, 0x02, 0x0C, 0x0F, 0x0E,
+        0x9F, 0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x83, 0x08, 0x02, 0x0C, 0x0F, 0x0E, 0x93, 0x0F,
+        0x02, 0x05, 0x0F, 0x03, 0x84, 0x02, 0x02, 0x03, 0x0F, 0x05, 0x9B, 0x0F, 0x02, 0x05, 0x0F, 0x03,
+        0x84, 0x02, 0x06, 0x03, 0x0F, 0x05, 0x0F, 0x0E, 0x0F, 0x04, 0x85, 0x02, 0x02, 0x03, 0x0F, 0x05,
+        0x91, 0x0F, 0x02, 0x05, 0x0E, 0x04, 0x85, 0x02, 0x02, 0x04, 0x0F, 0x0E, 0x98, 0x0F, 0x02, 0x0E,
+        0x0F, 0x04, 0x93, 0x02, 0x02, 0x03, 0x0F, 0x05, 0x94, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09,
+        0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x9F, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09,
+        0x06, 0x0B, 0x0E, 0x0D, 0x94, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x85, 0x00, 0x02, 0x03, 0x0E, 0x05,
+        0x99, 0x0F, 0x03, 0x05, 0x05, 0x04, 0x01, 0x84, 0x00, 0x07, 0x03, 0x0F, 0x04, 0x0F, 0x0F, 0x05,
+        0x0F, 0x03, 0x85, 0x00, 0x02, 0x03, 0x0F, 0x05, 0x90, 0x0F, 0x02, 0x05, 0x0F, 0x02, 0x84, 0x00,
+        0x02, 0x02, 0x0E, 0x05, 0x99, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x93, 0x00, 0x02, 0x03, 0x0F, 0x04,
+        0x94, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x9F, 0x0F,
+        0x0A, 0x0D, 0x0D, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x94, 0x0F, 0x02, 0x05,
+        0x0F, 0x03, 0x84, 0x01, 0x03, 0x00, 0x02, 0x0F, 0x05, 0x99, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x00,
+        0x84, 0x01, 0x02, 0x03, 0x0F, 0x04, 0x82, 0x0F, 0x03, 0x05, 0x0F, 0x02, 0x00, 0x84, 0x01, 0x02,
+        0x04, 0x05, 0x05, 0x8E, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x00, 0x83, 0x01, 0x03, 0x02, 0x05, 0x0E,
+        0x0E, 0x99, 0x0F, 0x02, 0x04, 0x0F, 0x03, 0x93, 0x01, 0x02, 0x03, 0x0F, 0x04, 0x94, 0x0F, 0x0B,
+        0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0x9D, 0x0F, 0x0B, 0x0E,
+        0x0F, 0x04, 0x0A, 0x08, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x94, 0x0F, 0x04, 0x05, 0x0F,
+        0x03, 0x00, 0x01, 0x82, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x97, 0x0F, 0x02, 0x05, 0x0E,
+        0x04, 0x82, 0x01, 0x06, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x82, 0x0F, 0x02, 0x05, 0x0E,
+        0x04, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x04, 0x8D, 0x0F, 0x02, 0x05, 0x0F, 0x04,
+        0x85, 0x01, 0x02, 0x03, 0x0F, 0x05, 0x9A, 0x0F, 0x05, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x8E,
+        0x01, 0x04, 0x00, 0x00, 0x03, 0x0F, 0x05, 0x94, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0B, 0x07, 0x09,
+        0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x9D, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x09,
+        0x07, 0x0B, 0x0D, 0x0E, 0x95, 0x0F, 0x04, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x82, 0x00, 0x05, 0x01,
+        0x00, 0x02, 0x04, 0x05, 0x0E, 0x96, 0x0F, 0x04, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x82, 0x00, 0x04,
+        0x01, 0x00, 0x03, 0x0F, 0x04, 0x83, 0x0F, 0x0B, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01,
+        0x00, 0x03, 0x0F, 0x05, 0x8C, 0x0F, 0x0A, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03,
+        0x0F, 0x04, 0x9B, 0x0F, 0x04, 0x0E, 0x0F, 0x02, 0x00, 0x01, 0x8F, 0x00, 0x03, 0x01, 0x03, 0x0F,
+        0x05, 0x96, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x9D,
+        0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x95, 0x0F, 0x04,
+        0x05, 0x0F, 0x03, 0x00, 0x01, 0x83, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x95, 0x0F, 0x04,
+        0x05, 0x0F, 0x03, 0x01, 0x01, 0x83, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x84, 0x0F, 0x0B,
+        0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x04, 0x05, 0x0E, 0x8A, 0x0F, 0x0A, 0x04,
+        0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x05, 0x9B, 0x0F, 0x07, 0x0E, 0x0F, 0x04,
+        0x02, 0x00, 0x01, 0x00, 0x02, 0x8D, 0x03, 0x00, 0x04, 0x99, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06,
+        0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x9D, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08,
+        0x09, 0x06, 0x0C, 0x0F, 0x0D, 0x95, 0x0F, 0x04, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x83, 0x00, 0x82,
+        0x01, 0x02, 0x04, 0x05, 0x0E, 0x94, 0x0F, 0x04, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x83, 0x00, 0x04,
+        0x01, 0x00, 0x03, 0x0F, 0x04, 0x84, 0x0F, 0x02, 0x05, 0x05, 0x04, 0x82, 0x01, 0x05, 0x00, 0x01,
+        0x00, 0x02, 0x0F, 0x05, 0x89, 0x0F, 0x02, 0x05, 0x0F, 0x0C, 0x85, 0x01, 0x02, 0x04, 0x0E, 0x05,
+        0x9B, 0x0F, 0x07, 0x05, 0x0F, 0x04, 0x01, 0x00, 0x01, 0x00, 0x03, 0x8E, 0x0F, 0x00, 0x05, 0x98,
+        0x0F, 0x05, 0x0E, 0x0F, 0x04, 0x0A, 0x08, 0x09, 0x82, 0x08, 0x02, 0x0C, 0x0F, 0x0E, 0x9B, 0x0F,
+        0x02, 0x0D, 0x0F, 0x0C, 0x82, 0x08, 0x05, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0x95, 0x0F, 0x04,
+        0x05, 0x0F, 0x03, 0x00, 0x01, 0x82, 0x00, 0x06, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x93,
+        0x0F, 0x06, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x82, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0F,
+        0x04, 0x85, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x82, 0x01, 0x02, 0x03, 0x0F, 0x05,
+        0x87, 0x0F, 0x0B, 0x0E, 0x05, 0x0E, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x9C,
+        0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x03, 0x05, 0x04, 0x8C, 0x05, 0x9A, 0x0F,
+        0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x9B, 0x0F, 0x0A, 0x0D,
+        0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x96, 0x0F, 0x09, 0x05, 0x0F, 0x03,
+        0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x82, 0x01, 0x02, 0x04, 0x0E, 0x05, 0x91, 0x0F, 0x05,
+        0x0E, 0x05, 0x04, 0x02, 0x01, 0x01, 0x84, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x86, 0x0F,
+        0x0B, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x04, 0x05, 0x0E, 0x86, 0x0F, 0x0A,
+        0x04, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x04, 0x9D, 0x0F, 0x09, 0x04, 0x0F,
+        0x03, 0x00, 0x01, 0x00, 0x01, 0x04, 0x0F, 0x05, 0xA7, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x0A,
+        0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x9B, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x0A,
+        0x06, 0x0B, 0x0F, 0x0D, 0x96, 0x0F, 0x08, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x02,
+        0x82, 0x01, 0x03, 0x00, 0x02, 0x0F, 0x05, 0x91, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x00, 0x83, 0x01,
+        0x07, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x86, 0x0F, 0x0B, 0x05, 0x05, 0x04, 0x02,
+        0x01, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x85, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x85, 0x01,
+        0x02, 0x04, 0x05, 0x05, 0x9D, 0x0F, 0x09, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x02, 0x04, 0x0F,
+        0x0E, 0xA7, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x9B,
+        0x0F, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x96, 0x0F, 0x10,
+        0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x03, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x0F,
+        0x05, 0x8F, 0x0F, 0x03, 0x0E, 0x05, 0x04, 0x02, 0x82, 0x01, 0x09, 0x00, 0x03, 0x02, 0x00, 0x01,
+        0x01, 0x00, 0x03, 0x0F, 0x04, 0x87, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x82, 0x01,
+        0x02, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x0B, 0x0E, 0x05, 0x05, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x03, 0x0F, 0x05, 0x9E, 0x0F, 0x08, 0x0E, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x05, 0xA8,
+        0x0F, 0x02, 0x0D, 0x0F, 0x0C, 0x82, 0x08, 0x05, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0x99, 0x0F,
+        0x05, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x82, 0x08, 0x02, 0x0C, 0x0F, 0x0E, 0x96, 0x0F, 0x10,
+        0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0E, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F,
+        0x05, 0x8F, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x00, 0x83, 0x01, 0x08, 0x04, 0x02, 0x00, 0x01, 0x01,
+        0x00, 0x03, 0x0F, 0x04, 0x88, 0x0F, 0x0B, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02,
+        0x04, 0x05, 0x0E, 0x82, 0x0F, 0x0A, 0x04, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F,
+        0x04, 0x9E, 0x0F, 0x09, 0x0E, 0x0F, 0x04, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x04, 0xA9, 0x0F,
+        0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x99, 0x0F, 0x0B, 0x0D,
+        0x0F, 0x0C, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x0E, 0x96, 0x0F, 0x11, 0x05, 0x0F,
+        0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05,
+        0x8D, 0x0F, 0x02, 0x05, 0x0E, 0x04, 0x83, 0x01, 0x0A, 0x00, 0x03, 0x0F, 0x02, 0x00, 0x01, 0x01,
+        0x00, 0x03, 0x0F, 0x04, 0x88, 0x0F, 0x10, 0x0E, 0x05, 0x04, 0x02, 0x01, 0x01, 0x00, 0x01, 0x00,
+        0x03, 0x0F, 0x04, 0x0F, 0x0F, 0x05, 0x0F, 0x03, 0x83, 0x01, 0x04, 0x00, 0x02, 0x04, 0x05, 0x0E,
+        0x9E, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x82, 0x01, 0x03, 0x00, 0x03, 0x0F, 0x04, 0xA9, 0x0F, 0x0A,
+        0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x99, 0x0F, 0x0A, 0x0D, 0x0F,
+        0x0C, 0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x97, 0x0F, 0x0B, 0x05, 0x0F, 0x03, 0x00,
+        0x01, 0x01, 0x00, 0x02, 0x0E, 0x0F, 0x02, 0x00, 0x82, 0x01, 0x03, 0x02, 0x04, 0x05, 0x0E, 0x8C,
+        0x0F, 0x03, 0x05, 0x0F, 0x02, 0x00, 0x82, 0x01, 0x0A, 0x02, 0x04, 0x0E, 0x02, 0x00, 0x01, 0x01,
+        0x00, 0x03, 0x0F, 0x04, 0x89, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x82, 0x01, 0x07,
+        0x03, 0x0F, 0x05, 0x0E, 0x05, 0x04, 0x02, 0x00, 0x82, 0x01, 0x03, 0x00, 0x03, 0x0F, 0x05, 0x9F,
+        0x0F, 0x09, 0x04, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x85, 0x05, 0x00, 0x0E,
+        0xA2, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x99, 0x0F,
+        0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x97, 0x0F, 0x0A, 0x05,
+        0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x03, 0x83, 0x01, 0x03, 0x00, 0x03, 0x0F,
+        0x04, 0x8B, 0x0F, 0x02, 0x05, 0x0E, 0x03, 0x83, 0x01, 0x0B, 0x00, 0x03, 0x0F, 0x0F, 0x02, 0x00,
+        0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8A, 0x0F, 0x15, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01,
+        0x00, 0x02, 0x0E, 0x05, 0x04, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x04, 0xA0,
+        0x0F, 0x07, 0x04, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x04, 0x88, 0x0F, 0x02, 0x05, 0x04, 0x0E,
+        0x9F, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0E, 0x0D, 0x99, 0x0F,
+        0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x97, 0x0F, 0x0C, 0x05,
+        0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x04, 0x0F, 0x02, 0x00, 0x83, 0x01, 0x02, 0x04,
+        0x0E, 0x05, 0x8A, 0x0F, 0x12, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x05, 0x04, 0x0F,
+        0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8A, 0x0F, 0x0C, 0x0E, 0x05, 0x04, 0x02, 0x00,
+        0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x0E, 0x03, 0x83, 0x01, 0x04, 0x00, 0x02, 0x04, 0x05, 0x0E,
+        0xA0, 0x0F, 0x0A, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x0F, 0x04, 0x04, 0x83, 0x03,
+        0x01, 0x04, 0x04, 0x82, 0x0F, 0x01, 0x05, 0x0E, 0x9D, 0x0F, 0x0B, 0x0E, 0x0F, 0x04, 0x0A, 0x08,
+        0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x98, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08,
+        0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x97, 0x0F, 0x0B, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02,
+        0x0F, 0x05, 0x0E, 0x04, 0x83, 0x01, 0x03, 0x00, 0x02, 0x0F, 0x05, 0x89, 0x0F, 0x13, 0x05, 0x0F,
+        0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03,
+        0x0F, 0x04, 0x8B, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x85, 0x01, 0x03, 0x04, 0x0F, 0x02, 0x00, 0x83,
+        0x01, 0x02, 0x03, 0x0F, 0x05, 0xA1, 0x0F, 0x05, 0x0E, 0x0E, 0x02, 0x00, 0x01, 0x00, 0x82, 0x02,
+        0x01, 0x01, 0x01, 0x83, 0x00, 0x07, 0x01, 0x02, 0x02, 0x03, 0x04, 0x0F, 0x0F, 0x05, 0x9C, 0x0F,
+        0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0x97, 0x0F, 0x0B,
+        0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0x97, 0x0F, 0x0D, 0x05,
+        0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x04, 0x0F, 0x03, 0x00, 0x83, 0x01, 0x02,
+        0x03, 0x0E, 0x05, 0x88, 0x0F, 0x13, 0x05, 0x0E, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x05,
+        0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8C, 0x0F, 0x11, 0x04, 0x0F, 0x03,
+        0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x04, 0xA1,
+        0x0F, 0x05, 0x0E, 0x0F, 0x04, 0x01, 0x00, 0x01, 0x85, 0x00, 0x82, 0x01, 0x84, 0x00, 0x04, 0x02,
+        0x03, 0x04, 0x0F, 0x05, 0x9C, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0C,
+        0x0F, 0x0D, 0x97, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x09, 0x08, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F,
+        0x0E, 0x97, 0x0F, 0x0D, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x0E, 0x05,
+        0x04, 0x02, 0x82, 0x01, 0x03, 0x00, 0x02, 0x0F, 0x05, 0x87, 0x0F, 0x14, 0x05, 0x0F, 0x03, 0x00,
+        0x01, 0x00, 0x01, 0x01, 0x03, 0x0F, 0x05, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F,
+        0x04, 0x8C, 0x0F, 0x11, 0x0E, 0x05, 0x04, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+        0x01, 0x00, 0x02, 0x0E, 0x05, 0x0E, 0xA1, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x82, 0x01, 0x00, 0x00,
+        0x8C, 0x01, 0x05, 0x00, 0x00, 0x02, 0x03, 0x0F, 0x05, 0x9B, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06,
+        0x09, 0x08, 0x09, 0x06, 0x0C, 0x0F, 0x0D, 0x97, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08,
+        0x09, 0x06, 0x0B, 0x0E, 0x0D, 0x98, 0x0F, 0x15, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02,
+        0x0F, 0x0E, 0x0F, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x85, 0x0F,
+        0x03, 0x0E, 0x05, 0x04, 0x02, 0x82, 0x01, 0x0E, 0x00, 0x02, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x02,
+        0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8D, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x82, 0x01, 0x83,
+        0x00, 0x82, 0x01, 0x02, 0x04, 0x0F, 0x05, 0xA2, 0x0F, 0x05, 0x04, 0x0F, 0x03, 0x00, 0x00, 0x01,
+        0x8B, 0x00, 0x08, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x03, 0x0F, 0x05, 0x9A, 0x0F, 0x0A, 0x0D,
+        0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x97, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C,
+        0x06, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x98, 0x0F, 0x15, 0x05, 0x0F, 0x03, 0x00, 0x01,
+        0x01, 0x00, 0x02, 0x0F, 0x0E, 0x0F, 0x0F, 0x05, 0x05, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x04,
+        0x05, 0x85, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x00, 0x83, 0x01, 0x0D, 0x04, 0x0E, 0x05, 0x0F, 0x05,
+        0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8E, 0x0F, 0x0D, 0x04, 0x0F, 0x03, 0x00,
+        0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x8E, 0x0F, 0x8E, 0x0E, 0x85, 0x0F,
+        0x08, 0x05, 0x0E, 0x03, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x86, 0x03, 0x0B, 0x02, 0x01, 0x00,
+        0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x0E, 0x05, 0x99, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06,
+        0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x97, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08,
+        0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x98, 0x0F, 0x16, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02,
+        0x0F, 0x0E, 0x0F, 0x0F, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x83,
+        0x0F, 0x02, 0x05, 0x0E, 0x04, 0x83, 0x01, 0x0F, 0x00, 0x03, 0x0F, 0x05, 0x0F, 0x0F, 0x05, 0x0F,
+        0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8E, 0x0F, 0x04, 0x05, 0x0F, 0x03, 0x01, 0x01,
+        0x83, 0x00, 0x04, 0x01, 0x00, 0x03, 0x0F, 0x04, 0xA7, 0x0F, 0x03, 0x04, 0x03, 0x03, 0x05, 0x88,
+        0x0F, 0x0A, 0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x05, 0x99, 0x0F, 0x0A,
+        0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x97, 0x0F, 0x0A, 0x0D, 0x0F,
+        0x0C, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00,
+        0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x82, 0x0F, 0x03, 0x05, 0x0F, 0x02, 0x00, 0x82, 0x01, 0x03,
+        0x02, 0x04, 0x05, 0x0E, 0x82, 0x0F, 0x03, 0x05, 0x0F, 0x02, 0x00, 0x83, 0x01, 0x0E, 0x04, 0x05,
+        0x05, 0x0F, 0x0F, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8D, 0x0F, 0x09,
+        0x0E, 0x05, 0x04, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x02, 0x03, 0x0F, 0x05,
+        0x8D, 0x0F, 0x8E, 0x04, 0x00, 0x05, 0x86, 0x0F, 0x01, 0x05, 0x05, 0x83, 0x0F, 0x02, 0x05, 0x04,
+        0x04, 0x83, 0x05, 0x04, 0x04, 0x05, 0x0F, 0x0F, 0x03, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x03,
+        0x0F, 0x05, 0x98, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D,
+        0x97, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0C, 0x0F, 0x0D, 0x98, 0x0F,
+        0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x82, 0x0F, 0x02, 0x05, 0x0E,
+        0x0C, 0x83, 0x01, 0x08, 0x00, 0x03, 0x0F, 0x05, 0x0F, 0x0F, 0x05, 0x0E, 0x04, 0x83, 0x01, 0x03,
+        0x00, 0x03, 0x0F, 0x04, 0x82, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F,
+        0x04, 0x8D, 0x0F, 0x04, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x85, 0x00, 0x05, 0x01, 0x00, 0x02, 0x04,
+        0x05, 0x0E, 0x8A, 0x0F, 0x02, 0x05, 0x0F, 0x02, 0x8D, 0x01, 0x02, 0x04, 0x0F, 0x05, 0x86, 0x0F,
+        0x03, 0x0E, 0x05, 0x05, 0x0E, 0x88, 0x0F, 0x0B, 0x05, 0x04, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01,
+        0x01, 0x02, 0x0F, 0x05, 0x98, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x09, 0x08, 0x08, 0x09, 0x07, 0x0B,
+        0x0D, 0x0E, 0x0E, 0x96, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F,
+        0x0D, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x83, 0x0F,
+        0x03, 0x05, 0x0F, 0x02, 0x00, 0x83, 0x01, 0x07, 0x04, 0x0E, 0x05, 0x0F, 0x05, 0x0F, 0x02, 0x00,
+        0x82, 0x01, 0x03, 0x02, 0x04, 0x05, 0x0E, 0x82, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01,
+        0x00, 0x03, 0x0F, 0x04, 0x8C, 0x0F, 0x11, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02,
+        0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8A, 0x0F, 0x02, 0x05, 0x0F, 0x02, 0x8C,
+        0x00, 0x03, 0x01, 0x04, 0x0F, 0x05, 0x95, 0x0F, 0x0A, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00,
+        0x01, 0x04, 0x0F, 0x05, 0x97, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A,
+        0x0D, 0x0F, 0x0E, 0x96, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F,
+        0x0D, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x83, 0x0F,
+        0x02, 0x05, 0x0E, 0x04, 0x83, 0x01, 0x0E, 0x00, 0x02, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x01, 0x01,
+        0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00,
+        0x03, 0x0F, 0x04, 0x8B, 0x0F, 0x0A, 0x05, 0x05, 0x04, 0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x03,
+        0x0C, 0x85, 0x01, 0x02, 0x03, 0x0F, 0x05, 0x89, 0x0F, 0x02, 0x05, 0x0F, 0x02, 0x8D, 0x01, 0x02,
+        0x04, 0x0F, 0x05, 0x95, 0x0F, 0x0A, 0x05, 0x0E, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F,
+        0x05, 0x97, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E,
+        0x96, 0x0F, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x98, 0x0F,
+        0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x84, 0x0F, 0x13, 0x05, 0x0F,
+        0x03, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x0F, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02,
+        0x0E, 0x05, 0x84, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x8B,
+        0x0F, 0x14, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x0F, 0x02, 0x00, 0x01,
+        0x00, 0x01, 0x00, 0x02, 0x05, 0x05, 0x0E, 0x88, 0x0F, 0x02, 0x05, 0x0F, 0x02, 0x8D, 0x00, 0x02,
+        0x04, 0x0F, 0x05, 0x95, 0x0F, 0x0A, 0x0E, 0x0F, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F,
+        0x04, 0x97, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E,
+        0x95, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x98,
+        0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x84, 0x0F, 0x03, 0x0E,
+        0x05, 0x04, 0x02, 0x82, 0x01, 0x0C, 0x00, 0x02, 0x05, 0x0E, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x03, 0x0F, 0x05, 0x84, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04,
+        0x8A, 0x0F, 0x15, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x04, 0x05, 0x05, 0x04,
+        0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x88, 0x0F, 0x01, 0x0E, 0x0F, 0x8E, 0x03,
+        0x02, 0x04, 0x0F, 0x0E, 0x98, 0x0F, 0x07, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x05, 0x98,
+        0x0F, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x95, 0x0F, 0x0B,
+        0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x98, 0x0F, 0x09, 0x05,
+        0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x85, 0x0F, 0x11, 0x05, 0x0F, 0x03, 0x00,
+        0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x05, 0x85, 0x0F,
+        0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x89, 0x0F, 0x11, 0x05, 0x05,
+        0x04, 0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00,
+        0x82, 0x01, 0x02, 0x03, 0x0F, 0x05, 0xB2, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00,
+        0x02, 0x0F, 0x05, 0x98, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F,
+        0x0D, 0x95, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E,
+        0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x86, 0x0F, 0x03,
+        0x05, 0x0F, 0x02, 0x00, 0x82, 0x01, 0x02, 0x02, 0x03, 0x00, 0x83, 0x01, 0x02, 0x03, 0x0E, 0x05,
+        0x85, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x89, 0x0F, 0x18,
+        0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x05, 0x0F, 0x0F, 0x04, 0x0F, 0x02,
+        0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x05, 0x05, 0x0E, 0x88, 0x0F, 0x00, 0x05, 0x8D, 0x04, 0x99,
+        0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x05, 0x98, 0x0F, 0x0A, 0x0D,
+        0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x95, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D,
+        0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00,
+        0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x86, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x82, 0x01, 0x02, 0x00,
+        0x01, 0x02, 0x82, 0x01, 0x03, 0x00, 0x02, 0x0F, 0x05, 0x86, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00,
+        0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x88, 0x0F, 0x10, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01,
+        0x01, 0x02, 0x04, 0x05, 0x0E, 0x0F, 0x0F, 0x05, 0x05, 0x04, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00,
+        0x03, 0x0F, 0x04, 0xB1, 0x0F, 0x09, 0x0E, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x04,
+        0x98, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x95, 0x0F,
+        0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x98, 0x0F, 0x09,
+        0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x87, 0x0F, 0x04, 0x05, 0x0F, 0x02,
+        0x00, 0x01, 0x83, 0x00, 0x82, 0x01, 0x02, 0x04, 0x0E, 0x05, 0x86, 0x0F, 0x09, 0x05, 0x0F, 0x02,
+        0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x87, 0x0F, 0x0B, 0x05, 0x05, 0x04, 0x02, 0x01, 0x01,
+        0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x82,
+        0x01, 0x02, 0x04, 0x0F, 0x05, 0xAF, 0x0F, 0x0A, 0x0E, 0x0F, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00,
+        0x03, 0x0F, 0x04, 0x98, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F,
+        0x0D, 0x95, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E,
+        0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x87, 0x0F, 0x02,
+        0x05, 0x0E, 0x04, 0x84, 0x01, 0x05, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x87, 0x0F, 0x09, 0x05,
+        0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x87, 0x0F, 0x0A, 0x04, 0x0F, 0x02, 0x00,
+        0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x05, 0x85, 0x0F, 0x0B, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x00,
+        0x01, 0x00, 0x02, 0x0F, 0x05, 0x0E, 0xAE, 0x0F, 0x03, 0x05, 0x0E, 0x03, 0x00, 0x82, 0x01, 0x03,
+        0x00, 0x03, 0x0F, 0x05, 0x98, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C,
+        0x0F, 0x0D, 0x95, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F,
+        0x0E, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x88, 0x0F,
+        0x06, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x00, 0x82, 0x01, 0x02, 0x04, 0x05, 0x0E, 0x87, 0x0F,
+        0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x86, 0x0F, 0x0B, 0x05, 0x0F,
+        0x03, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x04, 0x05, 0x0E, 0x85, 0x0F, 0x02, 0x05, 0x0E, 0x04,
+        0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0xAE, 0x0F, 0x0A, 0x04, 0x0F, 0x02, 0x00,
+        0x01, 0x01, 0x00, 0x01, 0x04, 0x0F, 0x0E, 0x98, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08,
+        0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x95, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07,
+        0x0A, 0x0D, 0x0F, 0x0E, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F,
+        0x0E, 0x88, 0x0F, 0x02, 0x05, 0x05, 0x04, 0x84, 0x01, 0x03, 0x00, 0x03, 0x0F, 0x04, 0x88, 0x0F,
+        0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x85, 0x0F, 0x02, 0x05, 0x05,
+        0x04, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x87, 0x0F, 0x05, 0x04, 0x0F, 0x03,
+        0x00, 0x01, 0x00, 0x82, 0x01, 0x02, 0x04, 0x0E, 0x05, 0x9B, 0x0F, 0x04, 0x0E, 0x05, 0x0E, 0x05,
+        0x0E, 0x8B, 0x0F, 0x02, 0x05, 0x0E, 0x04, 0x83, 0x01, 0x03, 0x00, 0x02, 0x0F, 0x05, 0x99, 0x0F,
+        0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x95, 0x0F, 0x0B, 0x0E,
+        0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x98, 0x0F, 0x09, 0x05, 0x0F,
+        0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x89, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x83, 0x00,
+        0x03, 0x02, 0x04, 0x05, 0x0E, 0x88, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03,
+        0x0F, 0x04, 0x85, 0x0F, 0x0A, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x04,
+        0x88, 0x0F, 0x0B, 0x0E, 0x05, 0x05, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0F, 0x05, 0xA0,
+        0x0F, 0x01, 0x05, 0x0E, 0x88, 0x0F, 0x0B, 0x05, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01,
+        0x03, 0x0F, 0x05, 0x99, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F,
+        0x0D, 0x95, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E,
+        0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x8A, 0x0F, 0x08,
+        0x05, 0x05, 0x02, 0x01, 0x01, 0x02, 0x03, 0x0F, 0x05, 0x89, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00,
+        0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x84, 0x0F, 0x0B, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01,
+        0x01, 0x02, 0x04, 0x05, 0x0E, 0x89, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x82, 0x01, 0x05, 0x00, 0x01,
+        0x00, 0x03, 0x0F, 0x05, 0x98, 0x0F, 0x0A, 0x0E, 0x05, 0x04, 0x02, 0x02, 0x03, 0x04, 0x0F, 0x0F,
+        0x04, 0x05, 0x84, 0x0E, 0x0C, 0x05, 0x04, 0x0F, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02,
+        0x0F, 0x05, 0x9A, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0C, 0x0F, 0x0D,
+        0x96, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x98, 0x0F,
+        0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x8D, 0x0F, 0x82, 0x04, 0x01,
+        0x0F, 0x0E, 0x8A, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x83,
+        0x0F, 0x02, 0x05, 0x05, 0x04, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x8B, 0x0F,
+        0x05, 0x04, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x82, 0x01, 0x02, 0x04, 0x0E, 0x05, 0x97, 0x0F, 0x02,
+        0x05, 0x0F, 0x02, 0x82, 0x00, 0x02, 0x02, 0x03, 0x04, 0x88, 0x0F, 0x0A, 0x04, 0x02, 0x00, 0x01,
+        0x00, 0x01, 0x00, 0x01, 0x04, 0x05, 0x05, 0x99, 0x0F, 0x0B, 0x0E, 0x0E, 0x0D, 0x0B, 0x07, 0x09,
+        0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0x96, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09,
+        0x06, 0x0C, 0x0F, 0x0D, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F,
+        0x0E, 0x8C, 0x0F, 0x00, 0x05, 0x82, 0x0F, 0x00, 0x05, 0x8B, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00,
+        0x01, 0x01, 0x00, 0x03, 0x0F, 0x04, 0x83, 0x0F, 0x0A, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x01,
+        0x00, 0x02, 0x0F, 0x04, 0x8C, 0x0F, 0x0B, 0x0E, 0x05, 0x04, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x02, 0x0F, 0x05, 0x96, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x00, 0x82, 0x01, 0x0F, 0x00, 0x00, 0x02,
+        0x03, 0x03, 0x04, 0x04, 0x05, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x02,
+        0x03, 0x0F, 0x05, 0x9A, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D,
+        0x0F, 0x0E, 0x96, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D,
+        0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x8D, 0x0F, 0x02,
+        0x0E, 0x05, 0x0E, 0x8C, 0x0F, 0x09, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03, 0x0F, 0x04,
+        0x82, 0x0F, 0x0B, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x04, 0x05, 0x0E, 0x8D,
+        0x0F, 0x0B, 0x05, 0x0F, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05, 0x95, 0x0F,
+        0x04, 0x05, 0x0F, 0x03, 0x01, 0x00, 0x83, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x02, 0x00, 0x01,
+        0x82, 0x00, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0F, 0x04, 0x9B, 0x0F, 0x0B, 0x0E, 0x0F,
+        0x0D, 0x0A, 0x07, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x96, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B,
+        0x06, 0x09, 0x08, 0x09, 0x06, 0x0C, 0x0F, 0x0D, 0x98, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x00, 0x01,
+        0x01, 0x00, 0x02, 0x0F, 0x0E, 0x9D, 0x0F, 0x0E, 0x05, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x00, 0x03,
+        0x0F, 0x04, 0x0F, 0x0F, 0x05, 0x05, 0x04, 0x82, 0x01, 0x05, 0x00, 0x01, 0x00, 0x03, 0x0F, 0x05,
+        0x8F, 0x0F, 0x05, 0x04, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x82, 0x01, 0x02, 0x04, 0x0E, 0x05, 0x95,
+        0x0F, 0x05, 0x05, 0x0F, 0x03, 0x02, 0x00, 0x00, 0x84, 0x01, 0x84, 0x00, 0x83, 0x01, 0x05, 0x00,
+        0x00, 0x01, 0x03, 0x0F, 0x04, 0x9C, 0x0F, 0x0B, 0x0E, 0x0F, 0x04, 0x0A, 0x08, 0x09, 0x09, 0x07,
+        0x0A, 0x0D, 0x0F, 0x0E, 0x96, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0x98, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x83, 0x01, 0x02, 0x02, 0x0F, 0x0E, 0x9D, 0x0F,
+        0x02, 0x05, 0x0F, 0x02, 0x83, 0x01, 0x08, 0x03, 0x0F, 0x04, 0x0F, 0x0F, 0x05, 0x0F, 0x02, 0x00,
+        0x82, 0x01, 0x03, 0x00, 0x02, 0x0F, 0x04, 0x90, 0x0F, 0x04, 0x05, 0x05, 0x04, 0x01, 0x00, 0x82,
+        0x01, 0x03, 0x00, 0x02, 0x0F, 0x05, 0x96, 0x0F, 0x04, 0x05, 0x0F, 0x04, 0x03, 0x01, 0x82, 0x00,
+        0x88, 0x01, 0x06, 0x00, 0x00, 0x01, 0x02, 0x04, 0x0F, 0x05, 0x9D, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C,
+        0x06, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0E, 0x0D, 0x97, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A,
+        0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x98, 0x0F, 0x02, 0x05, 0x0F, 0x03, 0x83, 0x00, 0x02, 0x02,
+        0x0F, 0x0E, 0x9D, 0x0F, 0x02, 0x05, 0x0F, 0x02, 0x83, 0x00, 0x06, 0x03, 0x0F, 0x04, 0x0F, 0x05,
+        0x0F, 0x03, 0x84, 0x00, 0x03, 0x02, 0x04, 0x05, 0x0E, 0x91, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x01,
+        0x84, 0x00, 0x02, 0x03, 0x0F, 0x05, 0x96, 0x0F, 0x06, 0x05, 0x0F, 0x0F, 0x04, 0x03, 0x02, 0x01,
+        0x88, 0x00, 0x05, 0x02, 0x02, 0x03, 0x0F, 0x0F, 0x05, 0x9E, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x07,
+        0x09, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x97, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08,
+        0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x98, 0x0F, 0x02, 0x0E, 0x0F, 0x04, 0x84, 0x03, 0x9F, 0x0F, 0x01,
+        0x0E, 0x0F, 0x84, 0x03, 0x05, 0x04, 0x0F, 0x0E, 0x0F, 0x0E, 0x0F, 0x85, 0x03, 0x02, 0x04, 0x0F,
+        0x0E, 0x93, 0x0F, 0x02, 0x05, 0x0F, 0x0C, 0x85, 0x03, 0x01, 0x0F, 0x0E, 0x97, 0x0F, 0x01, 0x0E,
+        0x05, 0x82, 0x0F, 0x02, 0x04, 0x03, 0x03, 0x84, 0x02, 0x06, 0x03, 0x03, 0x04, 0x0F, 0x0F, 0x05,
+        0x0E, 0x9F, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x97,
+        0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0xD4, 0x0F, 0x00,
+        0x0E, 0x95, 0x0F, 0x00, 0x05, 0xA2, 0x0F, 0x02, 0x0E, 0x04, 0x0E, 0x8A, 0x0F, 0x01, 0x05, 0x05,
+        0xA1, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x97, 0x0F,
+        0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x0E, 0x99, 0x0F, 0x00,
+        0x0E, 0x84, 0x05, 0xA1, 0x0F, 0x84, 0x05, 0x00, 0x0E, 0x84, 0x0F, 0x85, 0x05, 0x00, 0x0E, 0x97,
+        0x0F, 0x86, 0x05, 0x9E, 0x0F, 0x02, 0x05, 0x04, 0x04, 0x83, 0x05, 0x03, 0x04, 0x04, 0x05, 0x0E,
+        0xA3, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x97, 0x0F,
+        0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0xFF, 0x0F, 0xC0,
+        0x0F, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0C, 0x0F, 0x0D, 0x97, 0x0F, 0x0B,
+        0x0E, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xBF, 0x0F,
+        0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x09, 0x08, 0x09, 0x0C, 0x0F, 0x0D, 0x98, 0x0F, 0x0A,
+        0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xBF, 0x0F, 0x0B,
+        0x0E, 0x0F, 0x04, 0x0A, 0x08, 0x09, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0x98, 0x0F, 0x0A, 0x0D,
+        0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xBF, 0x0F, 0x0A, 0x0D,
+        0x0F, 0x0C, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0x99, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C,
+        0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0xFF, 0x0F, 0xBF, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C,
+        0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x99, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x07, 0x09,
+        0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0xFF, 0x0F, 0xBF, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x0A,
+        0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x99, 0x0F, 0x0B, 0x0E, 0x0F, 0x04, 0x0A, 0x08, 0x09, 0x09,
+        0x08, 0x0A, 0x04, 0x0F, 0x0E, 0xFF, 0x0F, 0xBE, 0x0F, 0x0A, 0x0E, 0x0E, 0x0B, 0x07, 0x09, 0x08,
+        0x09, 0x06, 0x0C, 0x0F, 0x0D, 0x9A, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x06,
+        0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xBD, 0x0F, 0x0B, 0x0E, 0x0F, 0x04, 0x0A, 0x08, 0x09, 0x09, 0x08,
+        0x0A, 0x04, 0x0F, 0x0E, 0x9A, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xFF, 0x0F, 0xBD, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B,
+        0x0D, 0x0E, 0x9B, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D,
+        0xFF, 0x0F, 0xBD, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D,
+        0x9B, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0A, 0x0D, 0x0F, 0x0E, 0xFF,
+        0x0F, 0xBC, 0x0F, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x9B,
+        0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F,
+        0xBB, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0x9C,
+        0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0xBB,
+        0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0F, 0x0E, 0x9C, 0x0F,
+        0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0E, 0x0E, 0xFF, 0x0F, 0xBB, 0x0F,
+        0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x9D, 0x0F, 0x02, 0x0E,
+        0x0F, 0x0C, 0x84, 0x08, 0x03, 0x09, 0x0C, 0x0F, 0x0E, 0xFF, 0x0F, 0xBA, 0x0F, 0x0A, 0x0E, 0x0D,
+        0x0B, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x9E, 0x0F, 0x0A, 0x0E, 0x0D, 0x0B, 0x07,
+        0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xB6, 0x0F, 0x01, 0x0E, 0x05, 0x8E, 0x0F, 0x01, 0x0E,
+        0x05, 0x85, 0x0F, 0x01, 0x05, 0x0E, 0x89, 0x0F, 0x01, 0x05, 0x05, 0x86, 0x0F, 0x00, 0x0E, 0x8D,
+        0x05, 0x87, 0x0F, 0x01, 0x05, 0x05, 0xBB, 0x0F, 0x02, 0x0D, 0x0F, 0x0C, 0x85, 0x08, 0x02, 0x0C,
+        0x0F, 0x0E, 0x9E, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D,
+        0xFF, 0x0F, 0xB9, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0E, 0x0D,
+        0x9F, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0xB3,
+        0x0F, 0x05, 0x0E, 0x0F, 0x04, 0x03, 0x04, 0x0E, 0x8A, 0x0F, 0x03, 0x0E, 0x0F, 0x04, 0x03, 0x82,
+        0x0F, 0x06, 0x0E, 0x0F, 0x04, 0x03, 0x04, 0x0F, 0x0E, 0x87, 0x0F, 0x03, 0x03, 0x0C, 0x0F, 0x0E,
+        0x82, 0x0F, 0x02, 0x0E, 0x0F, 0x04, 0x8D, 0x03, 0x00, 0x04, 0x86, 0x0F, 0x03, 0x03, 0x0C, 0x0F,
+        0x0E, 0xB9, 0x0F, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0x9F,
+        0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xB3, 0x0F,
+        0x06, 0x05, 0x0F, 0x03, 0x02, 0x03, 0x0F, 0x05, 0x88, 0x0F, 0x0E, 0x0E, 0x05, 0x04, 0x02, 0x02,
+        0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x84, 0x0F, 0x05, 0x0E, 0x0F, 0x04,
+        0x02, 0x02, 0x04, 0x83, 0x0F, 0x02, 0x05, 0x0F, 0x04, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03,
+        0x0A, 0x04, 0x0F, 0x0E, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x02, 0x04, 0xB9, 0x0F, 0x02, 0x0E,
+        0x0F, 0x0C, 0x83, 0x08, 0x04, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xA0, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B,
+        0x06, 0x0A, 0x08, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0xB3, 0x0F, 0x07, 0x05, 0x0F, 0x03, 0x02, 0x02,
+        0x04, 0x0E, 0x0E, 0x87, 0x0F, 0x0E, 0x05, 0x0F, 0x03, 0x02, 0x03, 0x04, 0x0F, 0x0F, 0x0E, 0x0F,
+        0x04, 0x02, 0x03, 0x0F, 0x05, 0x84, 0x0F, 0x07, 0x05, 0x0F, 0x03, 0x03, 0x02, 0x03, 0x0F, 0x05,
+        0x8A, 0x0F, 0x01, 0x03, 0x03, 0x8A, 0x0F, 0x07, 0x05, 0x0F, 0x03, 0x03, 0x02, 0x03, 0x0F, 0x05,
+        0xB7, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0xA1, 0x0F,
+        0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0xB2, 0x0F, 0x01,
+        0x05, 0x0F, 0x83, 0x03, 0x01, 0x0F, 0x05, 0x86, 0x0F, 0x0F, 0x0E, 0x0E, 0x04, 0x02, 0x03, 0x03,
+        0x04, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x85, 0x0F, 0x01, 0x04, 0x02, 0x82,
+        0x03, 0x01, 0x0F, 0x0E, 0x84, 0x0F, 0x85, 0x05, 0x03, 0x03, 0x03, 0x05, 0x04, 0x82, 0x05, 0x00,
+        0x0E, 0x85, 0x0F, 0x01, 0x04, 0x02, 0x82, 0x03, 0x01, 0x0F, 0x0E, 0xB7, 0x0F, 0x0A, 0x0D, 0x0D,
+        0x0B, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xA1, 0x0F, 0x0B, 0x0E, 0x0F, 0x0D, 0x0B,
+        0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xB2, 0x0F, 0x08, 0x05, 0x0F, 0x03, 0x02, 0x04,
+        0x02, 0x03, 0x0F, 0x05, 0x85, 0x0F, 0x0F, 0x05, 0x0F, 0x03, 0x03, 0x04, 0x02, 0x05, 0x0F, 0x0F,
+        0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x02, 0x0F, 0x04,
+        0x02, 0x04, 0x0F, 0x0E, 0x87, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x87, 0x0F, 0x09,
+        0x05, 0x0F, 0x03, 0x02, 0x0F, 0x04, 0x02, 0x04, 0x0F, 0x0E, 0xB5, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C,
+        0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xA2, 0x0F, 0x0A, 0x0D, 0x0F, 0x0C, 0x06,
+        0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0xB2, 0x0F, 0x08, 0x05, 0x0F, 0x03, 0x02, 0x0F, 0x03,
+        0x02, 0x05, 0x05, 0x84, 0x0F, 0x10, 0x05, 0x0E, 0x04, 0x02, 0x04, 0x03, 0x02, 0x05, 0x0F, 0x0F,
+        0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x09, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x0F,
+        0x03, 0x03, 0x0F, 0x05, 0x87, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x87, 0x0F, 0x09,
+        0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0xB5, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B,
+        0x06, 0x0A, 0x08, 0x09, 0x07, 0x0B, 0x0E, 0x0D, 0xA3, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09,
+        0x08, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xB1, 0x0F, 0x09, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x04,
+        0x02, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x10, 0x05, 0x0F, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x05, 0x0F,
+        0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x82, 0x0F, 0x09, 0x05, 0x0F, 0x04, 0x02, 0x04,
+        0x0F, 0x0F, 0x03, 0x02, 0x04, 0x88, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x86, 0x0F,
+        0x09, 0x05, 0x0F, 0x04, 0x02, 0x04, 0x0F, 0x0F, 0x03, 0x02, 0x04, 0xB5, 0x0F, 0x0B, 0x0E, 0x0E,
+        0x0D, 0x0A, 0x07, 0x09, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xA4, 0x0F, 0x0A, 0x0D, 0x0E, 0x0B,
+        0x07, 0x09, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xB1, 0x0F, 0x1E, 0x05, 0x0F, 0x03, 0x02, 0x05,
+        0x0F, 0x03, 0x02, 0x04, 0x0E, 0x0E, 0x0F, 0x0F, 0x05, 0x0F, 0x03, 0x02, 0x04, 0x0E, 0x03, 0x02,
+        0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x82, 0x0F, 0x0B, 0x05, 0x0F, 0x03,
+        0x03, 0x0F, 0x05, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x86, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03,
+        0x0F, 0x05, 0x86, 0x0F, 0x0B, 0x05, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x0F, 0x04, 0x02, 0x03, 0x0F,
+        0x05, 0xB3, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E,
+        0xA4, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x09, 0x08, 0x0A, 0x04, 0x0F, 0x0E, 0xB0,
+        0x0F, 0x2D, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x0F, 0x0F, 0x05,
+        0x0E, 0x02, 0x03, 0x0F, 0x0F, 0x03, 0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F,
+        0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x03, 0x0F, 0x0E,
+        0x86, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x85, 0x0F, 0x0C, 0x0E, 0x0F, 0x04, 0x02,
+        0x03, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x03, 0x0F, 0x0E, 0xB3, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x07,
+        0x09, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xA5, 0x0F, 0x0B, 0x0E, 0x0E, 0x0D, 0x0A, 0x07, 0x09,
+        0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xB0, 0x0F, 0x2E, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x0E, 0x0F,
+        0x04, 0x02, 0x04, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x02, 0x04, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x0F,
+        0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x0F, 0x0F, 0x05, 0x0F, 0x03, 0x02, 0x04, 0x0F,
+        0x0F, 0x05, 0x0F, 0x04, 0x02, 0x04, 0x0F, 0x05, 0x85, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F,
+        0x05, 0x85, 0x0F, 0x0D, 0x05, 0x0F, 0x03, 0x02, 0x04, 0x0F, 0x0F, 0x05, 0x0F, 0x04, 0x02, 0x04,
+        0x0F, 0x05, 0xB1, 0x0F, 0x0B, 0x0D, 0x0E, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x09, 0x07, 0x0C, 0x0F,
+        0x0D, 0xA6, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0A, 0x0D, 0x0E, 0x0E,
+        0xAF, 0x0F, 0x26, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x0F, 0x05, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x0E,
+        0x04, 0x02, 0x03, 0x0F, 0x04, 0x0F, 0x03, 0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03,
+        0x0F, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x02, 0x03, 0x0E, 0x04, 0x82, 0x05, 0x04, 0x0F, 0x03, 0x03,
+        0x0F, 0x05, 0x85, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x85, 0x0F, 0x05, 0x0E, 0x0F,
+        0x02, 0x03, 0x0E, 0x04, 0x82, 0x05, 0x04, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0xB1, 0x0F, 0x0A, 0x0D,
+        0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0E, 0xA7, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C,
+        0x08, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xAF, 0x0F, 0x24, 0x05, 0x0F, 0x03, 0x02,
+        0x0E, 0x0F, 0x0E, 0x0E, 0x04, 0x02, 0x03, 0x0F, 0x0F, 0x03, 0x03, 0x0F, 0x0E, 0x05, 0x0F, 0x03,
+        0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x0C, 0x02,
+        0x04, 0x85, 0x0F, 0x04, 0x03, 0x02, 0x04, 0x0F, 0x0E, 0x84, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03,
+        0x0F, 0x05, 0x84, 0x0F, 0x04, 0x05, 0x0F, 0x0C, 0x02, 0x04, 0x85, 0x0F, 0x04, 0x03, 0x02, 0x04,
+        0x0F, 0x0E, 0xAF, 0x0F, 0x03, 0x0D, 0x0E, 0x0C, 0x09, 0x82, 0x08, 0x04, 0x0A, 0x06, 0x0C, 0x0F,
+        0x0D, 0xA8, 0x0F, 0x0A, 0x0D, 0x0E, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0xAF,
+        0x0F, 0x23, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x0F, 0x0F, 0x05, 0x0F, 0x03, 0x02, 0x0F, 0x04, 0x02,
+        0x04, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F,
+        0x05, 0x0F, 0x05, 0x0F, 0x03, 0x02, 0x87, 0x03, 0x03, 0x02, 0x03, 0x0F, 0x05, 0x84, 0x0F, 0x05,
+        0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x84, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x02, 0x87, 0x03, 0x03,
+        0x02, 0x03, 0x0F, 0x05, 0xAF, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0A,
+        0x0D, 0x0E, 0x0E, 0xA8, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xAE, 0x0F, 0x0A, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x0F, 0x0F, 0x0E, 0x05, 0x05, 0x02,
+        0x82, 0x03, 0x14, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04,
+        0x02, 0x03, 0x0F, 0x05, 0x0E, 0x0F, 0x04, 0x02, 0x8A, 0x03, 0x01, 0x0F, 0x0E, 0x84, 0x0F, 0x05,
+        0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x03, 0x0E, 0x0F, 0x04, 0x02, 0x8A, 0x03, 0x01,
+        0x0F, 0x0E, 0xAE, 0x0F, 0x02, 0x0D, 0x0E, 0x0C, 0x83, 0x08, 0x04, 0x0A, 0x06, 0x0C, 0x0F, 0x0D,
+        0xAA, 0x0F, 0x0A, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0xAE, 0x0F,
+        0x04, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x82, 0x0F, 0x1A, 0x05, 0x0F, 0x03, 0x02, 0x02, 0x04, 0x0E,
+        0x0E, 0x0F, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x05,
+        0x05, 0x0F, 0x03, 0x02, 0x88, 0x0F, 0x04, 0x04, 0x02, 0x0C, 0x0F, 0x05, 0x83, 0x0F, 0x05, 0x0E,
+        0x0F, 0x03, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x03, 0x05, 0x0F, 0x03, 0x02, 0x88, 0x0F, 0x04, 0x04,
+        0x02, 0x0C, 0x0F, 0x05, 0xAD, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x09, 0x07, 0x0A,
+        0x0D, 0x0E, 0x0E, 0xAA, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xAD, 0x0F, 0x04, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x83, 0x0F, 0x1B, 0x0E, 0x0F, 0x03,
+        0x03, 0x0F, 0x0E, 0x0F, 0x0F, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02,
+        0x03, 0x0F, 0x05, 0x0E, 0x05, 0x02, 0x03, 0x0E, 0x04, 0x86, 0x05, 0x04, 0x0F, 0x03, 0x03, 0x0F,
+        0x05, 0x83, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x83, 0x0F, 0x05, 0x0E, 0x05, 0x02,
+        0x03, 0x0E, 0x04, 0x86, 0x05, 0x04, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0xAC, 0x0F, 0x02, 0x0D, 0x0E,
+        0x0C, 0x83, 0x08, 0x04, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xAC, 0x0F, 0x0B, 0x0E, 0x0D, 0x0B, 0x07,
+        0x09, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0x0E, 0xAC, 0x0F, 0x04, 0x05, 0x0F, 0x03, 0x02, 0x0E,
+        0x84, 0x0F, 0x03, 0x0E, 0x0F, 0x0F, 0x0E, 0x82, 0x0F, 0x13, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x0F,
+        0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x04, 0x0F, 0x03, 0x02, 0x04, 0x0F, 0x0E, 0x85, 0x0F,
+        0x06, 0x05, 0x0F, 0x03, 0x02, 0x04, 0x0F, 0x0E, 0x82, 0x0F, 0x05, 0x0E, 0x0F, 0x03, 0x03, 0x0F,
+        0x05, 0x82, 0x0F, 0x06, 0x05, 0x0F, 0x03, 0x02, 0x04, 0x0F, 0x0E, 0x85, 0x0F, 0x06, 0x05, 0x0F,
+        0x03, 0x02, 0x04, 0x0F, 0x0E, 0xAB, 0x0F, 0x04, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x83, 0x08, 0x02,
+        0x0C, 0x0E, 0x0D, 0xAC, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xAC, 0x0F, 0x04, 0x05, 0x0F, 0x03, 0x02, 0x0E, 0x85, 0x0F, 0x01, 0x0E, 0x0E, 0x83,
+        0x0F, 0x12, 0x05, 0x0F, 0x03, 0x02, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x04,
+        0x0F, 0x03, 0x03, 0x0F, 0x05, 0x88, 0x0F, 0x04, 0x05, 0x02, 0x03, 0x0F, 0x05, 0x82, 0x0F, 0x05,
+        0x0E, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x82, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x03, 0x0F, 0x05, 0x88,
+        0x0F, 0x04, 0x05, 0x02, 0x03, 0x0F, 0x05, 0xAA, 0x0F, 0x0B, 0x0D, 0x0E, 0x0C, 0x07, 0x09, 0x08,
+        0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xAE, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08, 0x09,
+        0x07, 0x0A, 0x0D, 0x0D, 0x0E, 0xAB, 0x0F, 0x04, 0x05, 0x0F, 0x03, 0x03, 0x0E, 0x8B, 0x0F, 0x12,
+        0x05, 0x0F, 0x03, 0x03, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x03, 0x0F, 0x0F, 0x04, 0x02,
+        0x0C, 0x0E, 0x05, 0x87, 0x0F, 0x05, 0x05, 0x0F, 0x03, 0x03, 0x05, 0x0E, 0x82, 0x0F, 0x0E, 0x0E,
+        0x0F, 0x03, 0x03, 0x0F, 0x05, 0x0F, 0x0F, 0x0E, 0x0F, 0x04, 0x02, 0x0C, 0x0E, 0x05, 0x87, 0x0F,
+        0x05, 0x05, 0x0F, 0x03, 0x03, 0x05, 0x0E, 0xAA, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x08,
+        0x09, 0x07, 0x0A, 0x0D, 0x0E, 0x0E, 0xAE, 0x0F, 0x0B, 0x0D, 0x0E, 0x0C, 0x06, 0x09, 0x08, 0x08,
+        0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xAD, 0x0F, 0x01, 0x05, 0x04, 0x8E, 0x0F, 0x01, 0x05, 0x04, 0x84,
+        0x0F, 0x06, 0x0E, 0x04, 0x05, 0x0F, 0x0F, 0x04, 0x04, 0x8D, 0x0F, 0x01, 0x04, 0x0E, 0x85, 0x0F,
+        0x01, 0x04, 0x04, 0x85, 0x0F, 0x01, 0x04, 0x04, 0x8D, 0x0F, 0x01, 0x04, 0x0E, 0xAA, 0x0F, 0x0B,
+        0x0D, 0x0F, 0x0C, 0x06, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xB0, 0x0F, 0x04, 0x0D,
+        0x0F, 0x0B, 0x06, 0x0A, 0x82, 0x08, 0x03, 0x07, 0x0C, 0x0F, 0x0D, 0xCB, 0x0F, 0x00, 0x0E, 0x9E,
+        0x0F, 0x00, 0x0E, 0xB8, 0x0F, 0x0C, 0x0E, 0x0D, 0x0D, 0x0B, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0A,
+        0x0D, 0x0E, 0x0E, 0xB0, 0x0F, 0x02, 0x0D, 0x0F, 0x0C, 0x83, 0x08, 0x04, 0x0A, 0x06, 0x0B, 0x0F,
+        0x0D, 0xAD, 0x0F, 0x00, 0x0E, 0x8F, 0x0F, 0x00, 0x0E, 0x85, 0x0F, 0x00, 0x0E, 0x83, 0x0F, 0x00,
+        0x0E, 0x8D, 0x0F, 0x00, 0x0E, 0x86, 0x0F, 0x00, 0x0E, 0x87, 0x0F, 0x00, 0x0E, 0x8D, 0x0F, 0x00,
+        0x0E, 0xAA, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D,
+        0xB2, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF,
+        0x0F, 0xA3, 0x0F, 0x02, 0x0D, 0x0F, 0x0C, 0x83, 0x08, 0x04, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0xB3,
+        0x0F, 0x0C, 0x0E, 0x0E, 0x0D, 0x0A, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0A, 0x04, 0x0E, 0x0E, 0xFF,
+        0x0F, 0xA2, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x0C, 0x0F, 0x0D,
+        0xB4, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xFF,
+        0x0F, 0xA1, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D,
+        0xB6, 0x0F, 0x0B, 0x0D, 0x0D, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xFF,
+        0x0F, 0x9F, 0x0F, 0x0C, 0x0D, 0x0F, 0x04, 0x0A, 0x08, 0x09, 0x08, 0x09, 0x07, 0x0A, 0x04, 0x0E,
+        0x0E, 0xB6, 0x0F, 0x02, 0x0D, 0x0F, 0x0C, 0x83, 0x08, 0x05, 0x09, 0x07, 0x0A, 0x04, 0x0E, 0x0D,
+        0xFF, 0x0F, 0x9D, 0x0F, 0x0C, 0x0E, 0x0D, 0x0D, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xB8, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F,
+        0x0D, 0xFF, 0x0F, 0x9D, 0x0F, 0x0B, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B,
+        0x0D, 0x0D, 0xB9, 0x0F, 0x0C, 0x0E, 0x0D, 0x0D, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0C,
+        0x0F, 0x0D, 0xFF, 0x0F, 0x9B, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x08, 0x08, 0x09, 0x08,
+        0x0A, 0x04, 0x0F, 0x0E, 0xBA, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x09,
+        0x07, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x99, 0x0F, 0x0C, 0x0E, 0x0E, 0x04, 0x0A, 0x07, 0x09, 0x08,
+        0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xBC, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08,
+        0x09, 0x07, 0x0A, 0x04, 0x0E, 0x0E, 0xFF, 0x0F, 0x98, 0x0F, 0x0B, 0x0D, 0x0F, 0x0B, 0x06, 0x0A,
+        0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xBE, 0x0F, 0x0C, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08,
+        0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x0E, 0xFF, 0x0F, 0x96, 0x0F, 0x0C, 0x0D, 0x0F, 0x0C, 0x06,
+        0x0A, 0x08, 0x08, 0x09, 0x07, 0x0B, 0x0D, 0x0D, 0x0E, 0xBE, 0x0F, 0x0C, 0x0E, 0x0E, 0x0D, 0x0B,
+        0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xFF, 0x0F, 0x95, 0x0F, 0x0C, 0x0D, 0x0F,
+        0x0C, 0x07, 0x09, 0x08, 0x08, 0x09, 0x08, 0x07, 0x0C, 0x0F, 0x0D, 0xC0, 0x0F, 0x0C, 0x0D, 0x0F,
+        0x0C, 0x07, 0x08, 0x09, 0x08, 0x08, 0x09, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x93, 0x0F, 0x0C,
+        0x0D, 0x0F, 0x0C, 0x09, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0C, 0x0F, 0x0D, 0xC2, 0x0F, 0x0C,
+        0x0D, 0x0F, 0x0C, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x09, 0x06, 0x0C, 0x0F, 0x0D, 0xFF, 0x0F, 0x91,
+        0x0F, 0x0C, 0x0D, 0x0F, 0x0D, 0x0A, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xC4,
+        0x0F, 0x0C, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xFF,
+        0x0F, 0x8F, 0x0F, 0x0D, 0x0E, 0x0D, 0x0D, 0x0B, 0x07, 0x0A, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0D,
+        0x0D, 0x0E, 0xC4, 0x0F, 0x0D, 0x0E, 0x0D, 0x0D, 0x0B, 0x07, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x0A,
+        0x04, 0x0F, 0x0D, 0xFF, 0x0F, 0x8D, 0x0F, 0x0D, 0x0E, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x08, 0x08,
+        0x09, 0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xC6, 0x0F, 0x0D, 0x0D, 0x0F, 0x0D, 0x0A, 0x07, 0x0A, 0x08,
+        0x08, 0x0A, 0x07, 0x0B, 0x0D, 0x0F, 0x0D, 0xFF, 0x0F, 0x8B, 0x0F, 0x0D, 0x0E, 0x0D, 0x0F, 0x0B,
+        0x06, 0x0A, 0x08, 0x08, 0x09, 0x08, 0x06, 0x0C, 0x0F, 0x0D, 0xC8, 0x0F, 0x0D, 0x0D, 0x0F, 0x0C,
+        0x0A, 0x07, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xFF, 0x0F, 0x89, 0x0F, 0x05,
+        0x0E, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x82, 0x08, 0x04, 0x09, 0x07, 0x0C, 0x0F, 0x0D, 0xCA, 0x0F,
+        0x0D, 0x0D, 0x0F, 0x0C, 0x06, 0x08, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xFF,
+        0x0F, 0x87, 0x0F, 0x05, 0x0E, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x82, 0x08, 0x04, 0x0A, 0x06, 0x0B,
+        0x0F, 0x0D, 0xCC, 0x0F, 0x0D, 0x0D, 0x0F, 0x0C, 0x06, 0x08, 0x09, 0x08, 0x08, 0x0A, 0x06, 0x0B,
+        0x0D, 0x0F, 0x0D, 0xFF, 0x0F, 0x85, 0x0F, 0x05, 0x0E, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x82, 0x08,
+        0x04, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0xCE, 0x0F, 0x04, 0x0D, 0x0F, 0x0C, 0x07, 0x09, 0x82, 0x08,
+        0x05, 0x0A, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xFF, 0x0F, 0x83, 0x0F, 0x05, 0x0E, 0x0E, 0x0F, 0x0B,
+        0x06, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x0E, 0xCF, 0x0F, 0x04, 0x0D, 0x0F,
+        0x0C, 0x06, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x06, 0x0B, 0x04, 0x0F, 0x0D, 0xFF, 0x0F, 0x07, 0x0F,
+        0x0F, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x06, 0x0B, 0x0F, 0x0D, 0x0E,
+        0xD1, 0x0F, 0x04, 0x0D, 0x0F, 0x0B, 0x06, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x07, 0x0A, 0x0C, 0x0F,
+        0x0D, 0xFF, 0x0F, 0x05, 0x0D, 0x0F, 0x0D, 0x0B, 0x06, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x06, 0x0B,
+        0x0D, 0x0D, 0x0E, 0xD2, 0x0F, 0x0E, 0x0E, 0x0D, 0x0F, 0x0B, 0x06, 0x09, 0x09, 0x08, 0x08, 0x0A,
+        0x07, 0x0A, 0x0C, 0x0F, 0x0D, 0xFD, 0x0F, 0x05, 0x0D, 0x0F, 0x04, 0x0B, 0x06, 0x0A, 0x82, 0x08,
+        0x05, 0x0A, 0x06, 0x0B, 0x0D, 0x0F, 0x0E, 0xD4, 0x0F, 0x0F, 0x0E, 0x0D, 0x0F, 0x0B, 0x07, 0x08,
+        0x09, 0x08, 0x08, 0x0A, 0x07, 0x07, 0x0C, 0x0F, 0x0D, 0x0E, 0xFA, 0x0F, 0x05, 0x0D, 0x0F, 0x0C,
+        0x0A, 0x07, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xD6, 0x0F, 0x0F, 0x0E,
+        0x0D, 0x0F, 0x0C, 0x06, 0x08, 0x09, 0x08, 0x08, 0x09, 0x08, 0x07, 0x0B, 0x0F, 0x0F, 0x0D, 0xF7,
+        0x0F, 0x06, 0x0E, 0x0D, 0x0F, 0x0C, 0x09, 0x07, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x06, 0x0B, 0x0F,
+        0x0F, 0x0E, 0xD9, 0x0F, 0x0E, 0x0D, 0x0F, 0x0C, 0x06, 0x07, 0x09, 0x08, 0x08, 0x09, 0x09, 0x06,
+        0x0B, 0x0D, 0x0F, 0x0D, 0xF5, 0x0F, 0x0F, 0x0D, 0x0F, 0x0F, 0x0C, 0x07, 0x07, 0x09, 0x08, 0x08,
+        0x09, 0x09, 0x06, 0x0B, 0x0F, 0x0D, 0x0E, 0xDB, 0x0F, 0x05, 0x0D, 0x0F, 0x0C, 0x09, 0x07, 0x0A,
+        0x82, 0x08, 0x06, 0x0A, 0x06, 0x0B, 0x0C, 0x0F, 0x0D, 0x0E, 0xF2, 0x0F, 0x0F, 0x0D, 0x0F, 0x04,
+        0x0B, 0x06, 0x09, 0x09, 0x08, 0x08, 0x09, 0x08, 0x07, 0x0B, 0x0F, 0x0D, 0x0E, 0xDD, 0x0F, 0x05,
+        0x0D, 0x0F, 0x0C, 0x0A, 0x06, 0x0A, 0x82, 0x08, 0x06, 0x0A, 0x07, 0x07, 0x0C, 0x0F, 0x0F, 0x0D,
+        0xEF, 0x0F, 0x06, 0x0D, 0x0F, 0x0F, 0x0C, 0x0A, 0x06, 0x0A, 0x82, 0x08, 0x06, 0x0A, 0x07, 0x06,
+        0x0C, 0x0F, 0x0D, 0x0E, 0xDF, 0x0F, 0x05, 0x0D, 0x0F, 0x04, 0x0B, 0x06, 0x0A, 0x82, 0x08, 0x07,
+        0x09, 0x08, 0x06, 0x0B, 0x04, 0x0F, 0x0D, 0x0E, 0xEC, 0x0F, 0x06, 0x0D, 0x0F, 0x0D, 0x0C, 0x07,
+        0x07, 0x0A, 0x82, 0x08, 0x05, 0x0A, 0x06, 0x0A, 0x0C, 0x0F, 0x0D, 0xE2, 0x0F, 0x10, 0x0D, 0x0F,
+        0x0D, 0x0B, 0x06, 0x09, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x06, 0x0A, 0x0C, 0x0F, 0x0F, 0x0D, 0xE9,
+        0x0F, 0x10, 0x0D, 0x0D, 0x0F, 0x0C, 0x0B, 0x06, 0x09, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x06, 0x0B,
+        0x0C, 0x0F, 0x0D, 0xE4, 0x0F, 0x06, 0x0D, 0x0F, 0x0F, 0x0C, 0x07, 0x07, 0x0A, 0x82, 0x08, 0x07,
+        0x0A, 0x07, 0x07, 0x0B, 0x0D, 0x0F, 0x0D, 0x0E, 0xE5, 0x0F, 0x07, 0x0E, 0x0D, 0x0F, 0x0F, 0x0C,
+        0x0A, 0x06, 0x0A, 0x82, 0x08, 0x06, 0x09, 0x08, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xE6, 0x0F, 0x11,
+        0x0E, 0x0D, 0x0F, 0x0C, 0x0A, 0x06, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x09, 0x06, 0x0B, 0x0C, 0x0F,
+        0x0F, 0x0D, 0xE3, 0x0F, 0x07, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x06, 0x08, 0x0A, 0x82, 0x08, 0x06,
+        0x0A, 0x07, 0x07, 0x0C, 0x0F, 0x0F, 0x0D, 0xE9, 0x0F, 0x06, 0x0D, 0x0F, 0x04, 0x0B, 0x06, 0x08,
+        0x09, 0x82, 0x08, 0x07, 0x0A, 0x07, 0x06, 0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0xDF, 0x0F, 0x12, 0x0D,
+        0x0D, 0x0F, 0x0D, 0x0C, 0x08, 0x06, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x06, 0x0B, 0x0C, 0x0F,
+        0x0D, 0x0E, 0xEB, 0x0F, 0x06, 0x0D, 0x0F, 0x0F, 0x0C, 0x08, 0x07, 0x0A, 0x82, 0x08, 0x08, 0x09,
+        0x0A, 0x06, 0x0A, 0x0C, 0x0D, 0x0F, 0x0E, 0x0D, 0xDB, 0x0F, 0x08, 0x0D, 0x0D, 0x0F, 0x0F, 0x0C,
+        0x0B, 0x06, 0x08, 0x0A, 0x82, 0x08, 0x06, 0x0A, 0x07, 0x06, 0x0B, 0x0D, 0x0F, 0x0D, 0xEE, 0x0F,
+        0x07, 0x0E, 0x0D, 0x0F, 0x0C, 0x0B, 0x06, 0x09, 0x09, 0x82, 0x08, 0x08, 0x0A, 0x08, 0x06, 0x0B,
+        0x0C, 0x0F, 0x0F, 0x0D, 0x0D, 0xD7, 0x0F, 0x08, 0x0D, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x06, 0x07,
+        0x0A, 0x82, 0x08, 0x07, 0x09, 0x0A, 0x06, 0x0A, 0x0C, 0x0F, 0x0F, 0x0D, 0xF1, 0x0F, 0x13, 0x0D,
+        0x0F, 0x0D, 0x0B, 0x07, 0x07, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x0A, 0x07, 0x06, 0x0B, 0x0C, 0x0F,
+        0x0F, 0x0E, 0x0D, 0xD3, 0x0F, 0x09, 0x0D, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x07, 0x06, 0x09, 0x09,
+        0x82, 0x08, 0x07, 0x0A, 0x07, 0x06, 0x0B, 0x04, 0x0F, 0x0D, 0x0E, 0xF3, 0x0F, 0x07, 0x0D, 0x0F,
+        0x0F, 0x0C, 0x0B, 0x06, 0x08, 0x0A, 0x82, 0x08, 0x0A, 0x09, 0x0A, 0x06, 0x07, 0x0B, 0x0C, 0x0F,
+        0x0F, 0x0E, 0x0D, 0x0E, 0xCE, 0x0F, 0x09, 0x0D, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x08, 0x06, 0x09,
+        0x0A, 0x82, 0x08, 0x07, 0x09, 0x09, 0x06, 0x0A, 0x0C, 0x0F, 0x0F, 0x0D, 0xF6, 0x0F, 0x08, 0x0E,
+        0x0D, 0x0F, 0x0D, 0x0C, 0x0A, 0x06, 0x09, 0x09, 0x82, 0x08, 0x05, 0x09, 0x09, 0x06, 0x07, 0x0B,
+        0x0C, 0x82, 0x0F, 0x01, 0x0D, 0x0E, 0xC9, 0x0F, 0x0A, 0x0E, 0x0D, 0x0E, 0x0F, 0x0F, 0x0C, 0x0B,
+        0x08, 0x06, 0x08, 0x0A, 0x82, 0x08, 0x08, 0x09, 0x0A, 0x07, 0x07, 0x0B, 0x04, 0x0F, 0x0E, 0x0E,
+        0xF9, 0x0F, 0x08, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x06, 0x07, 0x0A, 0x09, 0x82, 0x08, 0x0B, 0x0A,
+        0x09, 0x06, 0x07, 0x0B, 0x0C, 0x0D, 0x0F, 0x0F, 0x0D, 0x0D, 0x0E, 0xC4, 0x0F, 0x01, 0x0D, 0x0D,
+        0x82, 0x0F, 0x05, 0x0C, 0x0B, 0x09, 0x06, 0x08, 0x0A, 0x82, 0x08, 0x08, 0x09, 0x0A, 0x07, 0x06,
+        0x0B, 0x0C, 0x0F, 0x0F, 0x0D, 0xFD, 0x0F, 0x08, 0x0D, 0x0F, 0x0F, 0x0C, 0x0B, 0x06, 0x07, 0x0A,
+        0x09, 0x82, 0x08, 0x06, 0x0A, 0x09, 0x07, 0x06, 0x0B, 0x0C, 0x0C, 0x82, 0x0F, 0x01, 0x0D, 0x0D,
+        0xBF, 0x0F, 0x0B, 0x0D, 0x0D, 0x0E, 0x0F, 0x0F, 0x04, 0x0C, 0x0B, 0x07, 0x06, 0x08, 0x0A, 0x83,
+        0x08, 0x08, 0x0A, 0x07, 0x06, 0x0A, 0x0C, 0x0D, 0x0F, 0x0D, 0x0E, 0xFF, 0x0F, 0x09, 0x0E, 0x0D,
+        0x0F, 0x0D, 0x0C, 0x0B, 0x06, 0x07, 0x0A, 0x09, 0x82, 0x08, 0x07, 0x09, 0x0A, 0x07, 0x06, 0x0A,
+        0x0B, 0x0C, 0x0D, 0x82, 0x0F, 0x02, 0x0D, 0x0D, 0x0E, 0xB8, 0x0F, 0x02, 0x0D, 0x0D, 0x0E, 0x82,
+        0x0F, 0x06, 0x0C, 0x0B, 0x0A, 0x06, 0x07, 0x09, 0x0A, 0x82, 0x08, 0x09, 0x09, 0x0A, 0x08, 0x06,
+        0x0A, 0x0C, 0x04, 0x0F, 0x0F, 0x0D, 0xFF, 0x0F, 0x83, 0x0F, 0x09, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C,
+        0x0A, 0x06, 0x07, 0x0A, 0x09, 0x82, 0x08, 0x08, 0x09, 0x0A, 0x08, 0x06, 0x06, 0x0B, 0x0B, 0x0C,
+        0x0D, 0x82, 0x0F, 0x02, 0x0D, 0x0D, 0x0E, 0xB1, 0x0F, 0x02, 0x0E, 0x0D, 0x0D, 0x83, 0x0F, 0x07,
+        0x0C, 0x0C, 0x0B, 0x07, 0x06, 0x07, 0x0A, 0x09, 0x82, 0x08, 0x09, 0x09, 0x0A, 0x07, 0x06, 0x08,
+        0x0B, 0x04, 0x0F, 0x0F, 0x0D, 0xFF, 0x0F, 0x87, 0x0F, 0x09, 0x0D, 0x0F, 0x0F, 0x04, 0x0C, 0x0B,
+        0x06, 0x07, 0x0A, 0x09, 0x83, 0x08, 0x08, 0x0A, 0x09, 0x07, 0x06, 0x07, 0x0B, 0x0B, 0x0C, 0x0D,
+        0x83, 0x0F, 0x82, 0x0D, 0xA9, 0x0F, 0x00, 0x0E, 0x82, 0x0D, 0x82, 0x0F, 0x09, 0x0D, 0x0C, 0x0C,
+        0x0B, 0x08, 0x06, 0x07, 0x09, 0x0A, 0x09, 0x82, 0x08, 0x0A, 0x09, 0x0A, 0x07, 0x06, 0x0A, 0x0B,
+        0x0C, 0x0F, 0x0F, 0x0D, 0x0E, 0xFF, 0x0F, 0x8A, 0x0F, 0x0A, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B,
+        0x06, 0x06, 0x08, 0x0A, 0x09, 0x82, 0x08, 0x09, 0x09, 0x0A, 0x09, 0x07, 0x06, 0x07, 0x0B, 0x0B,
+        0x0C, 0x04, 0x84, 0x0F, 0x83, 0x0D, 0x00, 0x0E, 0x9D, 0x0F, 0x01, 0x0E, 0x0E, 0x82, 0x0D, 0x84,
+        0x0F, 0x09, 0x0D, 0x0C, 0x0B, 0x0B, 0x08, 0x06, 0x07, 0x08, 0x0A, 0x09, 0x82, 0x08, 0x0B, 0x09,
+        0x0A, 0x09, 0x07, 0x06, 0x0A, 0x0C, 0x04, 0x0F, 0x0F, 0x0D, 0x0E, 0xFF, 0x0F, 0x8D, 0x0F, 0x0B,
+        0x0E, 0x0D, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x08, 0x06, 0x07, 0x0A, 0x0A, 0x83, 0x08, 0x0B, 0x09,
+        0x0A, 0x09, 0x07, 0x06, 0x06, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x85, 0x0F, 0x85, 0x0D, 0x82,
+        0x0E, 0x89, 0x0F, 0x83, 0x0E, 0x84, 0x0D, 0x00, 0x0E, 0x85, 0x0F, 0x0A, 0x04, 0x0C, 0x0C, 0x0B,
+        0x0A, 0x07, 0x06, 0x07, 0x08, 0x0A, 0x09, 0x83, 0x08, 0x0B, 0x09, 0x0A, 0x08, 0x06, 0x07, 0x0B,
+        0x0C, 0x04, 0x0F, 0x0F, 0x0D, 0x0D, 0xFF, 0x0F, 0x92, 0x0F, 0x00, 0x0D, 0x82, 0x0F, 0x07, 0x0C,
+        0x0B, 0x0B, 0x06, 0x06, 0x08, 0x0A, 0x09, 0x83, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x08, 0x07, 0x06,
+        0x06, 0x08, 0x0B, 0x0B, 0x82, 0x0C, 0x00, 0x0D, 0x89, 0x0F, 0x89, 0x0D, 0x89, 0x0F, 0x06, 0x0D,
+        0x04, 0x0C, 0x0C, 0x0B, 0x0B, 0x0A, 0x82, 0x06, 0x03, 0x07, 0x09, 0x0A, 0x09, 0x83, 0x08, 0x0C,
+        0x09, 0x0A, 0x09, 0x07, 0x06, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x0F, 0x0D, 0x0E, 0xFF, 0x0F, 0x95,
+        0x0F, 0x0E, 0x0E, 0x0D, 0x0E, 0x0F, 0x0F, 0x0D, 0x0C, 0x0B, 0x0A, 0x06, 0x07, 0x08, 0x0A, 0x0A,
+        0x09, 0x82, 0x08, 0x05, 0x09, 0x09, 0x0A, 0x0A, 0x08, 0x07, 0x82, 0x06, 0x03, 0x09, 0x0A, 0x0B,
+        0x0B, 0x84, 0x0C, 0x82, 0x0D, 0x89, 0x0F, 0x82, 0x0D, 0x00, 0x04, 0x83, 0x0C, 0x03, 0x0B, 0x0B,
+        0x0A, 0x0A, 0x82, 0x06, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x09, 0x09, 0x83, 0x08, 0x08, 0x09, 0x0A,
+        0x09, 0x07, 0x06, 0x07, 0x0B, 0x0C, 0x04, 0x82, 0x0F, 0x01, 0x0D, 0x0E, 0xFF, 0x0F, 0x9A, 0x0F,
+        0x01, 0x0D, 0x0D, 0x82, 0x0F, 0x09, 0x0C, 0x0C, 0x0B, 0x08, 0x06, 0x06, 0x08, 0x0A, 0x0A, 0x09,
+        0x84, 0x08, 0x00, 0x09, 0x82, 0x0A, 0x02, 0x08, 0x07, 0x07, 0x82, 0x06, 0x02, 0x07, 0x06, 0x09,
+        0x82, 0x0A, 0x8A, 0x0B, 0x82, 0x0A, 0x01, 0x06, 0x07, 0x83, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A,
+        0x0A, 0x09, 0x09, 0x83, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x08, 0x07, 0x06, 0x07, 0x0B, 0x0B, 0x0C,
+        0x82, 0x0F, 0x01, 0x0D, 0x0D, 0xFF, 0x0F, 0x9F, 0x0F, 0x02, 0x0E, 0x0D, 0x0D, 0x82, 0x0F, 0x0B,
+        0x0C, 0x0C, 0x0B, 0x0A, 0x06, 0x06, 0x07, 0x08, 0x0A, 0x0A, 0x09, 0x09, 0x84, 0x08, 0x82, 0x09,
+        0x04, 0x0A, 0x0A, 0x09, 0x09, 0x08, 0x82, 0x07, 0x89, 0x06, 0x82, 0x07, 0x02, 0x08, 0x09, 0x09,
+        0x82, 0x0A, 0x82, 0x09, 0x83, 0x08, 0x11, 0x09, 0x09, 0x0A, 0x0A, 0x09, 0x07, 0x06, 0x06, 0x08,
+        0x0B, 0x0C, 0x0C, 0x0D, 0x0F, 0x0F, 0x0E, 0x0D, 0x0E, 0xFF, 0x0F, 0xA4, 0x0F, 0x02, 0x0D, 0x0D,
+        0x0E, 0x82, 0x0F, 0x0B, 0x04, 0x0C, 0x0B, 0x0B, 0x08, 0x06, 0x06, 0x07, 0x07, 0x09, 0x0A, 0x0A,
+        0x82, 0x09, 0x86, 0x08, 0x90, 0x09, 0x86, 0x08, 0x0D, 0x09, 0x09, 0x0A, 0x0A, 0x09, 0x08, 0x07,
+        0x06, 0x06, 0x07, 0x0B, 0x0B, 0x0C, 0x0C, 0x83, 0x0F, 0x01, 0x0D, 0x0D, 0xFF, 0x0F, 0xAA, 0x0F,
+        0x82, 0x0D, 0x82, 0x0F, 0x06, 0x0D, 0x0C, 0x0C, 0x0B, 0x0B, 0x0A, 0x07, 0x82, 0x06, 0x02, 0x07,
+        0x08, 0x09, 0x82, 0x0A, 0x85, 0x09, 0x89, 0x08, 0x85, 0x09, 0x82, 0x0A, 0x03, 0x09, 0x08, 0x07,
+        0x07, 0x82, 0x06, 0x05, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x82, 0x0F, 0x02, 0x0E, 0x0D, 0x0D,
+        0xFF, 0x0F, 0xB0, 0x0F, 0x02, 0x0E, 0x0D, 0x0D, 0x84, 0x0F, 0x06, 0x04, 0x0C, 0x0C, 0x0B, 0x0B,
+        0x0A, 0x0A, 0x85, 0x06, 0x83, 0x07, 0x89, 0x09, 0x00, 0x08, 0x82, 0x07, 0x85, 0x06, 0x07, 0x09,
+        0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x04, 0x0D, 0x83, 0x0F, 0x82, 0x0D, 0xFF, 0x0F, 0xB6, 0x0F, 0x00,
+        0x0E, 0x82, 0x0D, 0x85, 0x0F, 0x01, 0x0D, 0x04, 0x82, 0x0C, 0x83, 0x0B, 0x82, 0x0A, 0x88, 0x07,
+        0x00, 0x06, 0x83, 0x0A, 0x82, 0x0B, 0x83, 0x0C, 0x00, 0x0D, 0x85, 0x0F, 0x82, 0x0D, 0x00, 0x0E,
+        0xFF, 0x0F, 0xBE, 0x0F, 0x00, 0x0E, 0x82, 0x0D, 0x00, 0x0E, 0x87, 0x0F, 0x83, 0x0D, 0x89, 0x0C,
+        0x00, 0x04, 0x82, 0x0D, 0x88, 0x0F, 0x82, 0x0D, 0x00, 0x0E, 0xFF, 0x0F, 0xC8, 0x0F, 0x01, 0x0E,
+        0x0E, 0x85, 0x0D, 0x91, 0x0F, 0x86, 0x0D, 0x00, 0x0E, 0xFF, 0x0F, 0xD5, 0x0F, 0x83, 0x0E, 0x89,
+        0x0D, 0x83, 0x0E, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF,
+        0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF,
+        0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xBE, 0x0F,
+};
+
+inline constexpr RleImage kBootLogo = {
+        240,
+        240,
+        kBootLogoPalette,
+        16,
+        kBootLogoData,
+        13183,
+};
+
+}
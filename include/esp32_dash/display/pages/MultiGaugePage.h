@@ -0,0 +1,72 @@
+#pragma once
+
+#include "esp32_dash/display/DisplayPage.h"
+#include "esp32_dash/display/ValueTween.h"
+#include "esp32_dash/display/widgets/Label.h"
+#include "esp32_dash/display/widgets/NumericValue.h"
+
+/**
+ * RPM, coolant, road speed and link status on one screen.
+ *
+ * Each value lives in its own region with its own minimum redraw interval.
+ * A frame spends at most \c frameBudgetBytes of estimated SPI traffic. RPM is
+ * drawn first whenever it is due; the other regions follow in priority order
+ * and whatever does not fit is carried to the next frame ahead of them. Slow
+ * channels wait at most one frame as long as the budget covers RPM plus the
+ * largest other region. The first region of a frame is always drawn, and the
+ * full redraw on page entry ignores the budget.
+ */
+class MultiGaugePage final : public DashPageBase {
+public:
+    struct Config {
+        uint32_t frameBudgetBytes;
+        uint32_t rpmIntervalMs;
+        uint32_t speedIntervalMs;
+        uint32_t coolantIntervalMs;
+        uint32_t linkIntervalMs;
+    };
+
+    static constexpr size_t kRegionCount = 4;
+
+    explicit MultiGaugePage(const Config &config);
+
+    void setRpm(float rpm);
+    void setCoolantTemp(float tempC);
+    void setSpeed(float kmh);
+    void setLinkConnected(bool connected);
+
+    // Estimated bytes sent by the last render and regions it pushed back.
+    uint32_t lastFrameBytes() const { return _lastFrameBytes; }
+    size_t deferredRegions() const { return _deferredRegions; }
+
+    void onEnter(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
+    bool tick(uint32_t nowMs) DASH_PAGE_OVERRIDE;
+
+    void render(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
+
+private:
+    struct Region {
+        Widget *widget;
+        uint32_t intervalMs;
+        uint32_t costBytes;  // worst-case redraw, text box x height x 2
+        uint32_t drawnAtMs;
+        bool drawn;
+        bool carried;
+    };
+
+    bool isDue(const Region &region, uint32_t nowMs) const;
+    bool drawRegion(Region &region, Adafruit_GC9A01A &display, uint32_t nowMs, uint32_t &spent);
+
+    Config _config;
+    ValueTween _rpmTween;
+    Label _linkLabel;
+    NumericValue _rpmValue;
+    Label _rpmCaption;
+    NumericValue _coolantValue;
+    NumericValue _speedValue;
+    Region _regions[kRegionCount];
+    uint32_t _lastFrameBytes;
+    size_t _deferredRegions;
+    bool _linkConnected;
+    bool _layoutDirty;
+};
@@ -2,7 +2,7 @@
 
 #include "esp32_dash/display/DisplayPage.h"
 
-class StaticTextPage : public DisplayPage {
+class StaticTextPage final : public DashPageBase {
 public:
     StaticTextPage(String title, String body,
                    uint16_t titleColor = 0xFFFF,
@@ -12,7 +12,7 @@ public:
     void setTitle(const String &title);
     void setBody(const String &body);
 
-    void render(Adafruit_GC9A01A &display) override;
+    void render(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
 
 private:
     String _title;
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "esp32_dash/display/DisplayPage.h"
+#include "esp32_dash/display/ValueTween.h"
+#include "esp32_dash/display/widgets/Arc.h"
+#include "esp32_dash/display/widgets/Label.h"
+#include "esp32_dash/display/widgets/NumericValue.h"
+
+/**
+ * Analog sweep tachometer for the round panel.
+ *
+ * The dial (ticks, numerals, redline band) is the page's static layer: it is
+ * captured once into the StaticLayerCache and blitted back on enter. After
+ * that each frame only repaints the arc wedge between the previous and the
+ * current RPM plus the digital readout when it changes, so frame cost tracks
+ * the RPM delta rather than the dial size.
+ */
+class SweepTachPage final : public DashPageBase {
+public:
+    struct Config {
+        float maxRpm;
+        float redlineRpm;
+    };
+
+    explicit SweepTachPage(const Config &config);
+
+    void setRpm(float rpm);
+    float rpm() const { return _rpm; }
+
+    // True when the next render would change pixels.
+    bool needsRender() const;
+
+    void onEnter(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
+    bool tick(uint32_t nowMs) DASH_PAGE_OVERRIDE;
+
+    void render(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
+
+private:
+    void drawDial(Adafruit_GFX &gfx) const;
+    int16_t degreesFor(float rpm) const;
+
+    const Config _config;
+    float _rpm;
+    ValueTween _rpmTween;
+    Arc _sweep;
+    NumericValue _readout;
+    Label _unitLabel;
+    bool _layoutDirty;
+};
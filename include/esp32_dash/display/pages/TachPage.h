@@ -1,28 +1,38 @@
 #pragma once
 
 #include "esp32_dash/display/DisplayPage.h"
+#include "esp32_dash/display/ValueTween.h"
+#include "esp32_dash/display/widgets/Label.h"
+#include "esp32_dash/display/widgets/NumericValue.h"
 
-class TachPage : public DisplayPage {
+class TachPage final : public DashPageBase {
 public:
+    static constexpr size_t kTitleCapacity = 16;
+    static constexpr size_t kStatusCapacity = Label::kCapacity;
+
     TachPage();
 
-    void setTitle(const String &title);
+    void setTitle(const char *title);
     void setRpm(float rpm);
-    void setStatusMessage(const String &status);
+    void setStatusMessage(const char *status);
+    void setStatusMessage(const __FlashStringHelper *status) {
+        setStatusMessage(reinterpret_cast<const char *>(status));
+    }
 
-    void onEnter(Adafruit_GC9A01A &display) override;
+    float rpm() const { return _rpm; }
+    const char *statusMessage() const { return _statusLabel.text(); }
 
-    void render(Adafruit_GC9A01A &display) override;
+    void onEnter(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
+    bool tick(uint32_t nowMs) DASH_PAGE_OVERRIDE;
 
-private:
-    void drawBaseLayout(Adafruit_GC9A01A &display);
+    void render(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
 
-    String _title;
+private:
     float _rpm;
-    String _statusMessage;
+    ValueTween _rpmTween;
     uint16_t _backgroundColor;
-    uint16_t _titleColor;
-    uint16_t _rpmColor;
-    uint16_t _statusColor;
+    Label _titleLabel;
+    NumericValue _rpmValue;
+    Label _statusLabel;
     bool _layoutDirty;
 };
@@ -1,28 +1,40 @@
 #pragma once
 
 #include "esp32_dash/display/DisplayPage.h"
+#include "esp32_dash/display/ValueTween.h"
+#include "esp32_dash/display/widgets/Bar.h"
+#include "esp32_dash/display/widgets/Label.h"
+#include "esp32_dash/display/widgets/NumericValue.h"
 
-class WaterTempPage : public DisplayPage {
+class WaterTempPage final : public DashPageBase {
 public:
+    static constexpr size_t kTitleCapacity = 16;
+    static constexpr size_t kStatusCapacity = Label::kCapacity;
+
     WaterTempPage();
 
-    void setTitle(const String &title);
+    void setTitle(const char *title);
     void setWaterTemp(float tempC);
-    void setStatusMessage(const String &status);
+    void setStatusMessage(const char *status);
+    void setStatusMessage(const __FlashStringHelper *status) {
+        setStatusMessage(reinterpret_cast<const char *>(status));
+    }
 
-    void onEnter(Adafruit_GC9A01A &display) override;
+    float waterTemp() const { return _waterTempC; }
+    const char *statusMessage() const { return _statusLabel.text(); }
 
-    void render(Adafruit_GC9A01A &display) override;
+    void onEnter(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
+    bool tick(uint32_t nowMs) DASH_PAGE_OVERRIDE;
 
-private:
-    void drawBaseLayout(Adafruit_GC9A01A &display);
+    void render(Adafruit_GC9A01A &display) DASH_PAGE_OVERRIDE;
 
-    String _title;
+private:
     float _waterTempC;
-    String _statusMessage;
+    ValueTween _tempTween;
     uint16_t _backgroundColor;
-    uint16_t _titleColor;
-    uint16_t _tempColor;
-    uint16_t _statusColor;
+    Label _titleLabel;
+    NumericValue _tempValue;
+    Bar _tempBar;
+    Label _statusLabel;
     bool _layoutDirty;
 };
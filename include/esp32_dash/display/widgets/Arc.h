@@ -0,0 +1,44 @@
+#pragma once
+
+#include "esp32_dash/display/widgets/Widget.h"
+
+/**
+ * Ring segment that fills clockwise from \c startDeg over \c sweepDeg as the
+ * value moves from min to max (0° points up). After the first draw only the
+ * wedge between the old and new fill angle is repainted.
+ */
+class Arc : public Widget {
+public:
+    Arc(int16_t centerX, int16_t centerY, int16_t innerRadius, int16_t outerRadius,
+        int16_t startDeg, int16_t sweepDeg,
+        float minValue, float maxValue,
+        uint16_t fillColor, uint16_t trackColor);
+
+    void setValue(float value);
+    void setFillColor(uint16_t color);
+
+    void draw(Adafruit_GC9A01A &display) override;
+    void invalidate() override;
+
+    // Fills the ring segment between two absolute angles on any GFX surface.
+    static void fillRing(Adafruit_GFX &gfx, int16_t centerX, int16_t centerY,
+                         int16_t innerRadius, int16_t outerRadius,
+                         int16_t fromDeg, int16_t toDeg, uint16_t color);
+
+private:
+    int16_t fillDegreesFor(float value) const;
+    void fillWedge(Adafruit_GC9A01A &display, int16_t fromDeg, int16_t toDeg, uint16_t color) const;
+
+    int16_t _centerX;
+    int16_t _centerY;
+    int16_t _innerRadius;
+    int16_t _outerRadius;
+    int16_t _startDeg;
+    int16_t _sweepDeg;
+    float _minValue;
+    float _maxValue;
+    uint16_t _fillColor;
+    uint16_t _trackColor;
+    float _value;
+    int16_t _drawnDegrees;  // -1 until the track has been drawn
+};
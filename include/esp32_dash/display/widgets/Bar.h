@@ -0,0 +1,32 @@
+#pragma once
+
+#include "esp32_dash/display/widgets/Widget.h"
+
+// Horizontal fill bar. After the first draw only the span between the old
+// and new fill edge is repainted.
+class Bar : public Widget {
+public:
+    Bar(int16_t x, int16_t y, int16_t width, int16_t height,
+        float minValue, float maxValue,
+        uint16_t fillColor, uint16_t trackColor);
+
+    void setValue(float value);
+    void setFillColor(uint16_t color);
+
+    void draw(Adafruit_GC9A01A &display) override;
+    void invalidate() override;
+
+private:
+    int16_t fillWidthFor(float value) const;
+
+    int16_t _x;
+    int16_t _y;
+    int16_t _width;
+    int16_t _height;
+    float _minValue;
+    float _maxValue;
+    uint16_t _fillColor;
+    uint16_t _trackColor;
+    float _value;
+    int16_t _drawnFill;   // -1 until the track has been drawn
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "esp32_dash/display/AlphaFont.h"
+#include "esp32_dash/display/widgets/Widget.h"
+
+/**
+ * Single line of text centred horizontally with its top at a fixed y.
+ * Uses the scaled classic font unless an anti-aliased AlphaFont is set.
+ *
+ * Text bounds are measured once per change. New text is drawn with an opaque
+ * background and only the strips of the previous bounds that the new text
+ * does not cover are cleared.
+ */
+class Label : public Widget {
+public:
+    static constexpr size_t kCapacity = 32;
+
+    Label(int16_t y, uint8_t textSize, uint16_t color, uint16_t backgroundColor,
+          int16_t safeMargin = 24);
+
+    void setText(const char *text);
+    void setColor(uint16_t color);
+    void setFont(const AlphaFont *font);
+    const char *text() const { return _text; }
+
+    void draw(Adafruit_GC9A01A &display) override;
+    void invalidate() override;
+
+private:
+    struct Bounds {
+        int16_t x;
+        int16_t y;
+        int16_t w;
+        int16_t h;
+    };
+
+    Bounds measure(Adafruit_GC9A01A &display) const;
+    void clearUncovered(Adafruit_GC9A01A &display, const Bounds &next);
+
+    char _text[kCapacity];
+    int16_t _y;
+    uint8_t _textSize;
+    uint16_t _color;
+    uint16_t _backgroundColor;
+    int16_t _safeMargin;
+    const AlphaFont *_font;
+    Bounds _drawn;
+    bool _hasDrawn;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "esp32_dash/display/widgets/Label.h"
+
+// Integer readout with an optional unit suffix; only redraws when the
+// rounded value changes.
+class NumericValue : public Label {
+public:
+    NumericValue(int16_t y, uint8_t textSize, uint16_t color, uint16_t backgroundColor,
+                 const char *suffix = "");
+
+    void setValue(float value);
+    int32_t value() const { return _value; }
+
+private:
+    const char *_suffix;
+    int32_t _value;
+    bool _hasValue;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Adafruit_GC9A01A.h"
+
+/**
+ * Base for retained-mode widgets.
+ *
+ * A widget remembers what it last put on screen and \c draw only touches
+ * pixels when its value changed since then. Call \c invalidate after the
+ * area behind the widget was repainted (page enter, overlay) so the next
+ * \c draw starts from a clean background instead of erasing stale bounds.
+ */
+class Widget {
+public:
+    virtual ~Widget() = default;
+
+    virtual void draw(Adafruit_GC9A01A &display) = 0;
+    virtual void invalidate() { _dirty = true; }
+
+    bool isDirty() const { return _dirty; }
+
+protected:
+    bool _dirty = true;
+};
@@ -2,17 +2,31 @@
 
 #include <Arduino.h>
 
+#include "esp32_dash/diagnostics/SerialConsole.h"
+
 #define SERVICE_UUID        "6e400001-b5a3-f393-e0a9-e50e24dcca9e"
 #define CHARACTERISTIC_UUID "6e400002-b5a3-f393-e0a9-e50e24dcca9e"
 
 extern BLEServer *pServer;
 extern BLECharacteristic *pCharacteristic;
+extern SerialConsole console;
+
+const int LIGHTS_PIN = 2;        // lights relay output
+const int LIGHTS_SENSE_PIN = 36;  // lights circuit, conditioned to 3.3 V
+const int HANDBRAKE_PIN = 13;     // switch to ground when applied
+const int WINDOWS_PIN = 14;       // switch to ground; GPIO3 is the USB serial RX
 
-const int LIGHTS_PIN = 2;
-const int WINDOWS_PIN = 3;
+enum class VehicleInput : uint8_t {
+    Lights,
+    Handbrake,
+    Windows,
+    Count
+};
 
 void showTransientStatusMessage(const String &message);
 void showTransientStatusMessage(const __FlashStringHelper *message);
 void enterLowPowerMode();
 void exitLowPowerMode();
 bool isLowPowerMode();
+bool isVehicleInputActive(VehicleInput input);
+size_t formatLoopStats(char *buffer, size_t size);
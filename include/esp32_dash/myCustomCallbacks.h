@@ -12,21 +12,16 @@ public:
             return;
         }
 
-        Serial.print("Received: ");
-        Serial.println(rxValue.c_str());
+        console.print("Received: ");
+        console.println(rxValue.c_str());
 
         if (rxValue == "Lights") {
-            if (_lightsAreOff) {
-                digitalWrite(LIGHTS_PIN, HIGH);
-                showTransientStatusMessage(F("Lights ON"));
-                _lightsAreOff = false;
-            } else {
-                digitalWrite(LIGHTS_PIN, LOW);
-                showTransientStatusMessage(F("Lights OFF"));
-                _lightsAreOff = true;
-            }
+            // Toggle against what the lights circuit reports; the overlay
+            // follows once the sense input sees the change.
+            digitalWrite(LIGHTS_PIN, isVehicleInputActive(VehicleInput::Lights) ? LOW : HIGH);
         } else if (rxValue == "Start") {
-            // TODO: Write a sequence to start the engine, looking at the RPMS being 0 and the handbrake being enabled
+            // TODO: Write a sequence to start the engine, looking at the RPMS being 0 and
+            // isVehicleInputActive(VehicleInput::Handbrake)
 
         } else if (rxValue == "Sleep") {
             enterLowPowerMode();
@@ -34,13 +29,34 @@ public:
         } else if (rxValue == "Wake") {
             exitLowPowerMode();
 
+        } else if (rxValue == "Stats") {
+            static char stats[512];
+            size_t length = formatLoopStats(stats, sizeof(stats));
+            if (length >= sizeof(stats)) {
+                length = sizeof(stats) - 1;
+            }
+            notifyInChunks(characteristic, reinterpret_cast<uint8_t *>(stats), length);
+            console.print(stats);
+
         } else {
             showTransientStatusMessage(F("Unknown cmd"));
-            Serial.println("Unknown command");
+            console.println("Unknown command");
         }
     }
 
 private:
-    // TODO: get a digitalRead from the light switch
-    bool _lightsAreOff = false;
+    // The stack cuts a notification to MTU - 3 bytes without telling
+    // anyone, so long text goes out as consecutive notifications of that
+    // size. Afterwards the characteristic holds the whole text, so a read
+    // (which the stack serves in blobs) returns all of it.
+    static void notifyInChunks(BLECharacteristic *characteristic, uint8_t *text, size_t length) {
+        const uint16_t mtu = BLEDevice::getMTU();
+        const size_t chunkBytes = mtu > 3 ? mtu - 3 : 20;
+        for (size_t offset = 0; offset < length; offset += chunkBytes) {
+            const size_t chunk = length - offset < chunkBytes ? length - offset : chunkBytes;
+            characteristic->setValue(text + offset, chunk);
+            characteristic->notify();
+        }
+        characteristic->setValue(text, length);
+    }
 };
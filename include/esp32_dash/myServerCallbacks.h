@@ -12,12 +12,12 @@ public:
     void onConnect(BLEServer *server) override {
         (void) server;
         showTransientStatusMessage("Connected");
-        Serial.println("Client connected");
+        console.println("Client connected");
     }
 
     void onDisconnect(BLEServer *server) override {
         showTransientStatusMessage("Disconnected");
-        Serial.println("Client disconnected");
+        console.println("Client disconnected");
         server->getAdvertising()->start();
     }
 
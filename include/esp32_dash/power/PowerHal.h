@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+
+enum class WakeSource : uint8_t {
+    None,
+    Timer,      // sleep slice ran out
+    TachPulse,
+    Button,
+    Ble,
+};
+
+/**
+ * Hardware side of \c PowerManager: panel sleep, radio advertising, the light
+ * sleep itself and the clock used to time wake-ups. The firmware backend
+ * lives in main.cpp; tests substitute a fake.
+ */
+class PowerHal {
+public:
+    virtual ~PowerHal() = default;
+
+    virtual void setDisplayAsleep(bool asleep) = 0;
+    virtual void setSlowAdvertising(bool slow) = 0;
+
+    // Light-sleeps for at most \c maxMs with the wake sources armed and
+    // reports what ended it.
+    virtual WakeSource lightSleep(uint32_t maxMs) = 0;
+
+    // TM1638 keys have no interrupt line, so they are polled between slices.
+    virtual bool buttonsHeld() = 0;
+
+    virtual uint32_t micros() = 0;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "esp32_dash/power/PowerHal.h"
+
+enum class PowerState : uint8_t {
+    Active,
+    Sleeping,
+    Waking,  // hardware is back up, first frame not drawn yet
+};
+
+enum class PowerTransition : uint8_t {
+    None,
+    Slept,  // caller suspends sensors and the display
+    Woke,   // caller resumes them and draws a frame
+};
+
+/**
+ * Low-power state machine.
+ *
+ * \c requestSleep / \c requestWake may be called from any task (BLE
+ * callbacks); the transitions themselves happen in \c update, which the
+ * main loop calls first thing. While sleeping, each \c update light-sleeps
+ * for one slice, so a BLE wake request is seen within \c sleepSliceMs and
+ * TM1638 keys are polled at that rate. A tach pulse wakes immediately.
+ *
+ * Wake-to-first-frame is timed from the end of the light sleep to
+ * \c noteFrameDrawn. If no frame arrives within \c maxWakingMs (the panel
+ * failed to start, say) the manager goes Active anyway and counts a wake
+ * timeout, so the rest of the firmware is never held in Waking.
+ */
+class PowerManager {
+public:
+    struct Config {
+        uint32_t sleepSliceMs;
+        uint32_t minAwakeMs;  // GC9A01A needs 120 ms between sleep out and sleep in
+        uint32_t maxWakingMs;
+    };
+
+    PowerManager(const Config &config, PowerHal &hal);
+
+    void requestSleep() { sleepRequested_ = true; }
+    void requestWake() { wakeRequested_ = true; }
+
+    PowerTransition update();
+    void noteFrameDrawn();
+
+    PowerState state() const { return state_; }
+    WakeSource lastWakeSource() const { return lastWakeSource_; }
+    uint32_t lastWakeToFrameMicros() const { return lastWakeToFrameMicros_; }
+    uint32_t sleepSlices() const { return sleepSlices_; }
+    uint32_t wakeTimeouts() const { return wakeTimeouts_; }
+
+private:
+    PowerTransition wake(WakeSource source);
+
+    const Config config_;
+    PowerHal &hal_;
+    PowerState state_ = PowerState::Active;
+    WakeSource lastWakeSource_ = WakeSource::None;
+    uint32_t wokeAtMicros_ = 0;
+    uint32_t lastWakeToFrameMicros_ = 0;
+    uint32_t sleepSlices_ = 0;
+    uint32_t wakeTimeouts_ = 0;
+    bool hasWoken_ = false;
+    volatile bool sleepRequested_ = false;
+    volatile bool wakeRequested_ = false;
+};
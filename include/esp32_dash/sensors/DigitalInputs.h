@@ -0,0 +1,155 @@
+#pragma once
+
+#include <Arduino.h>
+#include <utility>
+
+struct DigitalInputConfig {
+    int pin;
+    int mode;                 // INPUT or INPUT_PULLUP
+    bool activeLow;           // the switch pulls the pin to ground
+    uint32_t debounceMicros;  // edges this soon after an accepted one are checked later
+};
+
+struct InputEvent {
+    uint8_t input;  // index into the config array
+    bool active;
+    uint32_t atMicros;
+};
+
+/**
+ * \c N switch inputs read through edge interrupts.
+ *
+ * The first edge of a burst is taken at once: the ISR reads the pin, updates
+ * a packed state word and queues an \c InputEvent, so \c isActive is a bit
+ * test that is never behind the wiring. Further edges inside the debounce
+ * window are only noted; \c poll re-reads those pins once the window has
+ * passed, which catches a bounce that ended on the other level.
+ *
+ * Each pin gets its own ISR trampoline, as in \c PulseCapture. Only one
+ * bank per input count may be started at a time.
+ */
+template<size_t N>
+class DigitalInputs {
+public:
+    static_assert(N > 0 && N <= 32, "DigitalInputs: 1 to 32 inputs");
+    static constexpr uint8_t kQueueDepth = 16;
+
+    explicit DigitalInputs(const DigitalInputConfig (&configs)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            configs_[i] = configs[i];
+        }
+    }
+
+    // Reads the starting levels without queueing events, then arms the ISRs.
+    void begin() {
+        instance_ = this;
+        uint32_t states = 0;
+        for (size_t i = 0; i < N; ++i) {
+            pinMode(configs_[i].pin, configs_[i].mode);
+            states |= readActive(i) ? maskOf(i) : 0;
+        }
+        states_ = states;
+        attachAll(std::make_index_sequence<N>{});
+    }
+
+    bool isActive(size_t input) const { return (states_ & maskOf(input)) != 0; }
+    uint32_t states() const { return states_; }
+    uint32_t droppedEvents() const { return dropped_; }
+
+    // Settles inputs whose debounce window has passed, then hands out the
+    // oldest queued change. Call from the loop until it returns false.
+    bool poll(InputEvent &out, uint32_t nowMicros) {
+        settle(nowMicros);
+        portENTER_CRITICAL(&mux_);
+        if (queued_ == 0) {
+            portEXIT_CRITICAL(&mux_);
+            return false;
+        }
+        out = queue_[(head_ + kQueueDepth - queued_) % kQueueDepth];
+        queued_ = queued_ - 1;
+        portEXIT_CRITICAL(&mux_);
+        return true;
+    }
+
+    void IRAM_ATTR onEdge(size_t input, uint32_t nowMicros) {
+        portENTER_CRITICAL_ISR(&mux_);
+        const uint32_t mask = maskOf(input);
+        if ((locked_ & mask) && (nowMicros - lockedAt_[input]) < configs_[input].debounceMicros) {
+            unsettled_ = unsettled_ | mask;
+            portEXIT_CRITICAL_ISR(&mux_);
+            return;
+        }
+        locked_ = locked_ | mask;
+        unsettled_ = unsettled_ & ~mask;
+        lockedAt_[input] = nowMicros;
+        commit(input, readActive(input), nowMicros);
+        portEXIT_CRITICAL_ISR(&mux_);
+    }
+
+private:
+    static constexpr uint32_t maskOf(size_t input) { return 1UL << input; }
+
+    bool readActive(size_t input) const {
+        const bool high = digitalRead(configs_[input].pin) == HIGH;
+        return high != configs_[input].activeLow;
+    }
+
+    // Caller holds mux_.
+    void commit(size_t input, bool active, uint32_t nowMicros) {
+        const uint32_t mask = maskOf(input);
+        if (((states_ & mask) != 0) == active) {
+            return;
+        }
+        states_ = active ? (states_ | mask) : (states_ & ~mask);
+        if (queued_ == kQueueDepth) {
+            dropped_ = dropped_ + 1;  // oldest change is overwritten
+        } else {
+            queued_ = queued_ + 1;
+        }
+        queue_[head_] = InputEvent{static_cast<uint8_t>(input), active, nowMicros};
+        head_ = (head_ + 1) % kQueueDepth;
+    }
+
+    void settle(uint32_t nowMicros) {
+        uint32_t pending = locked_;
+        while (pending) {
+            const size_t input = static_cast<size_t>(__builtin_ctz(pending));
+            pending &= pending - 1;
+            portENTER_CRITICAL(&mux_);
+            const uint32_t mask = maskOf(input);
+            if ((locked_ & mask) && (nowMicros - lockedAt_[input]) >= configs_[input].debounceMicros) {
+                locked_ = locked_ & ~mask;
+                if (unsettled_ & mask) {
+                    unsettled_ = unsettled_ & ~mask;
+                    commit(input, readActive(input), nowMicros);
+                }
+            }
+            portEXIT_CRITICAL(&mux_);
+        }
+    }
+
+    template<size_t... I>
+    void attachAll(std::index_sequence<I...>) {
+        (attachInterrupt(digitalPinToInterrupt(configs_[I].pin), &DigitalInputs::isr<I>, CHANGE), ...);
+    }
+
+    template<size_t I>
+    static void IRAM_ATTR isr() {
+        instance_->onEdge(I, micros());
+    }
+
+    DigitalInputConfig configs_[N] = {};
+    portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+    volatile uint32_t states_ = 0;
+    volatile uint32_t locked_ = 0;     // inside the debounce window
+    volatile uint32_t unsettled_ = 0;  // saw edges while locked
+    volatile uint32_t lockedAt_[N] = {};
+    InputEvent queue_[kQueueDepth] = {};
+    volatile uint8_t head_ = 0;
+    volatile uint8_t queued_ = 0;
+    volatile uint32_t dropped_ = 0;
+    static DigitalInputs *instance_;
+};
+
+template<size_t N>
+DigitalInputs<N> *DigitalInputs<N>::instance_ = nullptr;
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <utility>
+
+#include "esp32_dash/sensors/PulseChannel.h"
+
+/**
+ * Owns \c N pulse inputs and their interrupt wiring.
+ *
+ * Every channel gets its own ISR trampoline, instantiated from the channel
+ * index at compile time, so the hot path is a direct call with no lookup.
+ * Only one engine per channel count may be started at a time.
+ */
+template<size_t N>
+class PulseCapture {
+public:
+    explicit PulseCapture(const PulseChannelConfig (&configs)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            channels_[i].configure(configs[i]);
+        }
+    }
+
+    void begin() {
+        instance_ = this;
+        attachAll(std::make_index_sequence<N>{});
+    }
+
+    PulseChannel &channel(size_t index) { return channels_[index]; }
+    static constexpr size_t size() { return N; }
+
+private:
+    template<size_t... I>
+    void attachAll(std::index_sequence<I...>) {
+        (attach<I>(), ...);
+    }
+
+    template<size_t I>
+    void attach() {
+        PulseChannel &ch = channels_[I];
+        ch.reset();
+        if (ch.beginHardware(static_cast<uint8_t>(I))) {
+            return;
+        }
+        pinMode(ch.config().pin, INPUT);
+        attachInterrupt(digitalPinToInterrupt(ch.config().pin), &PulseCapture::isr<I>, ch.config().edge);
+    }
+
+    template<size_t I>
+    static void IRAM_ATTR isr() {
+        instance_->channels_[I].onEdge(micros());
+    }
+
+    PulseChannel channels_[N];
+    static PulseCapture *instance_;
+};
+
+template<size_t N>
+PulseCapture<N> *PulseCapture<N>::instance_ = nullptr;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arduino.h>
+
+enum class PulseBackend : uint8_t {
+    GpioInterrupt,  // timestamp every edge in an ISR
+    // ESP32 pulse counter, falls back to GpioInterrupt elsewhere. The counter
+    // only has a fixed glitch filter, so a channel whose debounceMicros is
+    // longer than PulseChannel::kHardwareFilterMicros keeps the interrupt.
+    Pcnt,
+};
+
+struct PulseChannelConfig {
+    int pin;
+    int edge;                   // RISING, FALLING or CHANGE
+    uint32_t debounceMicros;    // edges closer than this to the last one are ignored; see Pcnt below
+    PulseBackend backend;
+    uint32_t staleMicros = 0;   // period reads 0 once no edge arrives for this long; 0 never expires
+};
+
+/**
+ * State for one pulse input: debounce, a ring of recent edge timestamps and
+ * the period/frequency estimators built on it.
+ *
+ * \c onEdge runs in interrupt context; everything else may be called from
+ * tasks. Channels are owned and wired up by \c PulseCapture.
+ */
+class PulseChannel {
+public:
+    static constexpr uint8_t kHistory = 8;
+    // The estimators read a hardware counter at most this often so each
+    // sample spans enough pulses to give a usable mean.
+    static constexpr uint32_t kHardwareSampleMicros = 250000;
+    // Glitch filter of the pulse counter: 1023 APB cycles at 80 MHz.
+    static constexpr uint32_t kHardwareFilterMicros = 12;
+
+    struct Snapshot {
+        uint32_t lastEdgeMicros;    // 0 until the first accepted edge
+        uint32_t lastPeriodMicros;  // 0 until two accepted edges
+    };
+
+    void configure(const PulseChannelConfig &config);
+    // Claims a hardware counter when the backend asks for one and the
+    // counter can honour the debounce window. Returns false when the channel
+    // needs a GPIO interrupt instead.
+    bool beginHardware(uint8_t unit);
+    const PulseChannelConfig &config() const { return config_; }
+    bool usesHardwareCounter() const { return hardwareUnit_ >= 0; }
+
+    void IRAM_ATTR onEdge(uint32_t nowMicros);
+
+    uint32_t takePulseCount();
+    Snapshot snapshot();
+    // Mean of the last \c intervals periods (clamped to the history depth).
+    uint32_t periodMicros(uint8_t intervals = kHistory - 1);
+    float frequencyHz(uint8_t intervals = kHistory - 1);
+
+    uint32_t edgeCount() const { return edgeCount_; }
+    uint32_t rejectedCount() const { return rejectedCount_; }
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled_; }
+    void reset();
+
+private:
+    uint32_t readHardwareCount();
+    void sampleHardware(uint32_t nowMicros);
+    bool isStale(uint32_t nowMicros, uint32_t lastEdgeMicros) const;
+
+    PulseChannelConfig config_{};
+    portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+    volatile uint32_t timestamps_[kHistory] = {};
+    volatile uint8_t head_ = 0;
+    volatile uint8_t stored_ = 0;
+    volatile uint32_t pulseCount_ = 0;
+    volatile uint32_t lastPeriodMicros_ = 0;
+    volatile uint32_t edgeCount_ = 0;       // every ISR invocation
+    volatile uint32_t rejectedCount_ = 0;   // edges dropped by the debounce window
+    volatile bool enabled_ = true;
+    int8_t hardwareUnit_ = -1;
+    int16_t lastRawCount_ = 0;  // counter value at the previous read; the counter is never cleared
+    uint32_t lastTakeMicros_ = 0;
+};
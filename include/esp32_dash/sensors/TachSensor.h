@@ -3,19 +3,20 @@
 #include <Arduino.h>
 
 class DisplayManager;
+class PulseChannel;
 class TachPage;
 
 class TachSensor {
 public:
     struct Config {
-        int signalPin;
         uint32_t updateIntervalMs;
         float pulsesPerRevolution;
         float changeThresholdRpm;
-        uint32_t minPulseIntervalMicros;
     };
 
-    TachSensor(const Config &config, TachPage &page, DisplayManager &displayManager);
+    // Ignition pulses arrive on \c channel; its debounce window replaces the
+    // former minPulseIntervalMicros setting.
+    TachSensor(const Config &config, PulseChannel &channel, TachPage &page, DisplayManager &displayManager);
 
     void begin();
     void update();
@@ -24,20 +25,17 @@ public:
 
     float lastRpm() const { return lastRpm_; }
 
-private:
-    static void IRAM_ATTR handlePulse();
-    void recordPulse();
+    // RPM from the most recent pulse period, for consumers that cannot wait
+    // for the next update window. Decays toward zero as pulses stop.
+    float instantRpm();
 
+private:
     const Config config_;
+    PulseChannel &channel_;
     TachPage &page_;
     DisplayManager &displayManager_;
 
-    volatile uint32_t pulseCount_ = 0;
-    portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
     uint32_t lastUpdateMs_ = 0;
     float lastRpm_ = 0.0f;
-    volatile uint32_t lastPulseMicros_ = 0;
     volatile bool enabled_ = true;
-
-    static TachSensor *instance_;
 };
@@ -30,6 +30,8 @@ public:
     bool isEnabled() const { return enabled_; }
 
     float lastTempC() const { return lastTempC_; }
+    // millis() of the latest valid reading, whether or not it changed lastTempC().
+    uint32_t lastReadingMs() const { return lastReadingMs_; }
 
 private:
 
@@ -42,13 +44,14 @@ public:
 private:
 #endif
     static float interpolateWaterTemp(float resistance);
-    static String describeWaterStatus(float tempC);
+    static const char *describeWaterStatus(float tempC);
 
     const Config config_;
     WaterTempPage &page_;
     DisplayManager &displayManager_;
 
     uint32_t lastSampleMs_ = 0;
+    uint32_t lastReadingMs_ = 0;
     float lastTempC_ = NAN;
     bool enabled_ = true;
 };
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+
+/**
+ * Fixed-capacity single-producer / single-consumer queue.
+ *
+ * One task (or ISR) may \c push while another \c pop s without locking.
+ * \c Capacity must be a power of two; one slot is never used so that the
+ * full and empty states can be told apart.
+ */
+template<typename T, size_t Capacity>
+class RingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "RingBuffer capacity must be a power of two");
+
+public:
+    bool push(const T &item) {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t next = (head + 1) & (Capacity - 1);
+        if (next == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        _items[head] = item;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &out) {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = _items[tail];
+        _tail.store((tail + 1) & (Capacity - 1), std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        return (_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire)) & (Capacity - 1);
+    }
+
+    static constexpr size_t capacity() { return Capacity - 1; }
+
+    void clear() {
+        _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    T _items[Capacity] = {};
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+};
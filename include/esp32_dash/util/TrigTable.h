@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+// Whole-degree sine/cosine from a quarter-wave table built at compile time,
+// so gauge geometry never calls sinf/cosf at runtime. Values are Q14
+// (16384 == 1.0).
+namespace trig {
+
+constexpr int32_t kOne = 1 << 14;
+
+namespace detail {
+// Taylor series on [0, pi/2]; accurate well past Q14 resolution there.
+constexpr double sineRadians(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; ++n) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+struct QuarterWave {
+    int16_t values[91];
+};
+
+constexpr QuarterWave makeQuarterWave() {
+    QuarterWave table{};
+    for (int degrees = 0; degrees <= 90; ++degrees) {
+        const double radians = degrees * 3.14159265358979323846 / 180.0;
+        table.values[degrees] = static_cast<int16_t>(sineRadians(radians) * kOne + 0.5);
+    }
+    return table;
+}
+
+constexpr QuarterWave kQuarterWave = makeQuarterWave();
+}
+
+constexpr int32_t sinQ14(int32_t degrees) {
+    degrees %= 360;
+    if (degrees < 0) {
+        degrees += 360;
+    }
+    if (degrees <= 90) {
+        return detail::kQuarterWave.values[degrees];
+    }
+    if (degrees <= 180) {
+        return detail::kQuarterWave.values[180 - degrees];
+    }
+    if (degrees <= 270) {
+        return -detail::kQuarterWave.values[degrees - 180];
+    }
+    return -detail::kQuarterWave.values[360 - degrees];
+}
+
+constexpr int32_t cosQ14(int32_t degrees) {
+    return sinQ14(degrees + 90);
+}
+
+// Point at \c radius from the centre; 0 degrees is straight up, clockwise
+// positive, matching screen coordinates.
+inline void polarToScreen(int16_t centerX, int16_t centerY, int16_t radius, int32_t degrees,
+                          int16_t &x, int16_t &y) {
+    const int32_t half = kOne / 2;
+    x = static_cast<int16_t>(centerX + ((radius * sinQ14(degrees) + half) >> 14));
+    y = static_cast<int16_t>(centerY - ((radius * cosQ14(degrees) + half) >> 14));
+}
+
+}
@@ -0,0 +1,63 @@
+#include "esp32_dash/TM1638/ButtonScanner.h"
+
+ButtonScanner::ButtonScanner(const Config &config) : config_(config) {}
+
+void ButtonScanner::sample(uint8_t rawMask, uint32_t nowMs) {
+    uint8_t pressed = 0;
+    uint8_t released = 0;
+
+    for (uint8_t key = 0; key < 8; ++key) {
+        const uint8_t bit = static_cast<uint8_t>(1U << key);
+        uint8_t &integrator = integrators_[key];
+        if (rawMask & bit) {
+            if (integrator < config_.integratorSamples) {
+                integrator++;
+            }
+        } else if (integrator > 0) {
+            integrator--;
+        }
+
+        if (!(debounced_ & bit) && integrator >= config_.integratorSamples) {
+            debounced_ |= bit;
+            pressed |= bit;
+            pressedAtMs_[key] = nowMs;
+            longPressReported_ &= static_cast<uint8_t>(~bit);
+        } else if ((debounced_ & bit) && integrator == 0) {
+            debounced_ &= static_cast<uint8_t>(~bit);
+            released |= bit;
+        }
+    }
+
+    for (uint8_t key = 0; key < 8; ++key) {
+        const uint8_t bit = static_cast<uint8_t>(1U << key);
+        if (pressed & bit) {
+            emit(ButtonEvent::Type::Press, bit, nowMs);
+        }
+        if (released & bit) {
+            emit(ButtonEvent::Type::Release, bit, nowMs);
+        }
+        if ((debounced_ & bit) && !(longPressReported_ & bit) &&
+            (nowMs - pressedAtMs_[key]) >= config_.longPressMs) {
+            longPressReported_ |= bit;
+            emit(ButtonEvent::Type::LongPress, bit, nowMs);
+        }
+    }
+
+    if (pressed && (debounced_ & (debounced_ - 1))) {
+        emit(ButtonEvent::Type::Chord, debounced_, nowMs);
+    }
+}
+
+bool ButtonScanner::poll(ButtonEvent &out) {
+    return events_.pop(out);
+}
+
+void ButtonScanner::emit(ButtonEvent::Type type, uint8_t mask, uint32_t nowMs) {
+    ButtonEvent event;
+    event.type = type;
+    event.mask = mask;
+    event.timestampMs = nowMs;
+    if (!events_.push(event)) {
+        droppedEvents_ = droppedEvents_ + 1;
+    }
+}
@@ -0,0 +1,27 @@
+#include "esp32_dash/TM1638/ShiftLight.h"
+
+ShiftLight::ShiftLight(const Config &config) : config_(config) {}
+
+uint8_t ShiftLight::ledMask(float rpm, uint32_t nowMs) const {
+    if (!isActive(rpm)) {
+        return 0x00;
+    }
+    if (rpm >= config_.redlineRpm) {
+        const uint32_t halfPeriod = config_.flashPeriodMs / 2;
+        if (halfPeriod == 0) {
+            return 0xFF;
+        }
+        return ((nowMs / halfPeriod) & 0x01) ? 0x00 : 0xFF;
+    }
+
+    const float span = config_.redlineRpm - config_.startRpm;
+    uint8_t lit = 1;
+    if (span > 0.0f) {
+        // First LED at startRpm, the last one just below redline.
+        lit = static_cast<uint8_t>(1 + ((rpm - config_.startRpm) * (kLedCount - 1)) / span);
+    }
+    if (lit > kLedCount) {
+        lit = kLedCount;
+    }
+    return static_cast<uint8_t>((1U << lit) - 1);
+}
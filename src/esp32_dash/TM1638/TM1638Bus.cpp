@@ -0,0 +1,131 @@
+#include "esp32_dash/TM1638/TM1638Bus.h"
+
+#include "soc/gpio_reg.h"
+
+namespace {
+constexpr uint32_t kHalfClockNs = 500;   // 1 MHz max CLK
+constexpr uint32_t kStrobeNs = 1000;     // STB pulse width / read wait
+
+volatile uint32_t *reg(uint32_t address) {
+    return reinterpret_cast<volatile uint32_t *>(address);
+}
+}
+
+ArduinoTM1638Bus::ArduinoTM1638Bus(uint8_t strobePin, uint8_t clkPin, uint8_t dataPin)
+        : strobe(strobePin), clk(clkPin), data(dataPin) {}
+
+void ArduinoTM1638Bus::begin() {
+    pinMode(strobe, OUTPUT);
+    pinMode(clk, OUTPUT);
+    pinMode(data, OUTPUT);
+
+    digitalWrite(strobe, HIGH);
+    digitalWrite(clk, HIGH);
+    digitalWrite(data, HIGH);
+}
+
+void ArduinoTM1638Bus::select() {
+    digitalWrite(strobe, LOW);
+}
+
+void ArduinoTM1638Bus::deselect() {
+    digitalWrite(strobe, HIGH);
+}
+
+void ArduinoTM1638Bus::writeByte(uint8_t value) {
+    shiftOut(data, clk, LSBFIRST, value);
+}
+
+void ArduinoTM1638Bus::readBytes(uint8_t *out, uint8_t count) {
+    pinMode(data, INPUT);
+    for (uint8_t i = 0; i < count; i++) {
+        out[i] = shiftIn(data, clk, LSBFIRST);
+    }
+    pinMode(data, OUTPUT);
+}
+
+DirectGpioTM1638Bus::DirectGpioTM1638Bus(uint8_t strobePin, uint8_t clkPin, uint8_t dataPin)
+        : strobe(resolvePin(strobePin)), clk(resolvePin(clkPin)), data(resolvePin(dataPin)) {}
+
+DirectGpioTM1638Bus::Pin DirectGpioTM1638Bus::resolvePin(uint8_t pin) {
+    if (pin < 32) {
+        return Pin{pin, 1U << pin,
+                   reg(GPIO_OUT_W1TS_REG), reg(GPIO_OUT_W1TC_REG),
+                   reg(GPIO_ENABLE_W1TS_REG), reg(GPIO_ENABLE_W1TC_REG),
+                   reg(GPIO_IN_REG)};
+    }
+    return Pin{pin, 1U << (pin - 32),
+               reg(GPIO_OUT1_W1TS_REG), reg(GPIO_OUT1_W1TC_REG),
+               reg(GPIO_ENABLE1_W1TS_REG), reg(GPIO_ENABLE1_W1TC_REG),
+               reg(GPIO_IN1_REG)};
+}
+
+void DirectGpioTM1638Bus::begin() {
+    // pinMode routes the pads to the GPIO matrix; everything after that is
+    // plain register writes.
+    pinMode(strobe.number, OUTPUT);
+    pinMode(clk.number, OUTPUT);
+    pinMode(data.number, OUTPUT);
+    high(strobe);
+    high(clk);
+    high(data);
+
+    const uint32_t cyclesPerUs = ESP.getCpuFreqMHz();
+    halfClockCycles = (kHalfClockNs * cyclesPerUs + 999) / 1000;
+    strobeCycles = (kStrobeNs * cyclesPerUs + 999) / 1000;
+}
+
+void DirectGpioTM1638Bus::waitCycles(uint32_t cycles) const {
+    const uint32_t start = ESP.getCycleCount();
+    while ((ESP.getCycleCount() - start) < cycles) {
+    }
+}
+
+void DirectGpioTM1638Bus::select() {
+    low(strobe);
+    waitCycles(halfClockCycles);
+}
+
+void DirectGpioTM1638Bus::deselect() {
+    high(strobe);
+    waitCycles(strobeCycles);
+}
+
+void DirectGpioTM1638Bus::writeByte(uint8_t value) {
+    // The TM1638 latches DIO on the rising CLK edge.
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        low(clk);
+        if (value & 0x01) {
+            high(data);
+        } else {
+            low(data);
+        }
+        value >>= 1;
+        waitCycles(halfClockCycles);
+        high(clk);
+        waitCycles(halfClockCycles);
+    }
+}
+
+void DirectGpioTM1638Bus::readBytes(uint8_t *out, uint8_t count) {
+    high(data);
+    *data.enableClearReg = data.mask;   // release DIO, board pull-up holds it high
+    waitCycles(strobeCycles);           // twait after the read command
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t value = 0;
+        // Key data is shifted out on the falling CLK edge.
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            low(clk);
+            waitCycles(halfClockCycles);
+            if (*data.inReg & data.mask) {
+                value |= static_cast<uint8_t>(1U << bit);
+            }
+            high(clk);
+            waitCycles(halfClockCycles);
+        }
+        out[i] = value;
+    }
+
+    *data.enableSetReg = data.mask;
+}
@@ -1,65 +1,176 @@
 #include "esp32_dash/TM1638/TM1638LedAndKey.h"
 
+#include "esp32_dash/TM1638/SevenSegmentFont.h"
+
 TM1638LedAndKeyModule::TM1638LedAndKeyModule(uint8_t strobePin,
                                              uint8_t clkPin,
                                              uint8_t dataPin)
-        : strobe(strobePin), clk(clkPin), data(dataPin) {}
+        : arduinoBus(strobePin, clkPin, dataPin),
+          directBus(strobePin, clkPin, dataPin),
+          bus(&directBus) {}
 
 void TM1638LedAndKeyModule::begin() {
-    pinMode(strobe, OUTPUT);
-    pinMode(clk, OUTPUT);
-    pinMode(data, OUTPUT);
-
-    digitalWrite(strobe, HIGH);
-    digitalWrite(clk, HIGH);
-    digitalWrite(data, HIGH);
+    bus->begin();
 
     sendCommand(0x8F);   // Display ON, max brightness
     reset();
 }
 
+void TM1638LedAndKeyModule::setBackend(Backend backend) {
+    if (backend == activeBackend) {
+        return;
+    }
+    activeBackend = backend;
+    bus = backend == Backend::ArduinoGpio
+          ? static_cast<TM1638Bus *>(&arduinoBus)
+          : static_cast<TM1638Bus *>(&directBus);
+    bus->begin();
+}
+
 void TM1638LedAndKeyModule::sendCommand(uint8_t value) {
-    digitalWrite(strobe, LOW);
-    shiftOut(data, clk, LSBFIRST, value);
-    digitalWrite(strobe, HIGH);
+    bus->select();
+    bus->writeByte(value);
+    bus->deselect();
 }
 
 void TM1638LedAndKeyModule::reset() {
     sendCommand(0x40);   // Auto-increment mode
-    digitalWrite(strobe, LOW);
-    shiftOut(data, clk, LSBFIRST, 0xC0);  // Address = 0
+    bus->select();
+    bus->writeByte(0xC0);  // Address = 0
 
-    for (uint8_t i = 0; i < 16; i++) {
-        shiftOut(data, clk, LSBFIRST, 0x00);
+    for (uint8_t i = 0; i < kDisplayRamSize; i++) {
+        bus->writeByte(0x00);
+        displayRam[i] = 0x00;
     }
 
-    digitalWrite(strobe, HIGH);
+    bus->deselect();
+    dirtyCells = 0;
 }
 
 uint8_t TM1638LedAndKeyModule::readButtons() {
     uint8_t buttons = 0;
+    uint8_t raw[4];
 
-    digitalWrite(strobe, LOW);
-    shiftOut(data, clk, LSBFIRST, 0x42);  // Read buttons command
-    pinMode(data, INPUT);
+    bus->select();
+    bus->writeByte(0x42);  // Read buttons command
+    bus->readBytes(raw, 4);
+    bus->deselect();
 
     for (uint8_t i = 0; i < 4; i++) {
-        uint8_t v = shiftIn(data, clk, LSBFIRST);
-        buttons |= (v << i);
+        buttons |= (raw[i] << i);
     }
 
-    pinMode(data, OUTPUT);
-    digitalWrite(strobe, HIGH);
-
     return buttons;
 }
 
 void TM1638LedAndKeyModule::setLed(uint8_t value, uint8_t position) {
     if (position > 7) return;
+    writeCell((position << 1) + 1, value ? 0xFF : 0x00);
+}
+
+void TM1638LedAndKeyModule::setLeds(uint8_t mask) {
+    for (uint8_t i = 0; i < 8; i++) {
+        setLed((mask >> i) & 0x01, i);
+    }
+}
+
+void TM1638LedAndKeyModule::setSegments(uint8_t position, uint8_t segments) {
+    if (position > 7) return;
+    writeCell(position << 1, segments);
+}
+
+void TM1638LedAndKeyModule::setDigit(uint8_t position, char c, bool decimalPoint) {
+    setSegments(position, SevenSegmentFont::glyph(c) |
+                          (decimalPoint ? SevenSegmentFont::kDecimalPoint : 0x00));
+}
+
+void TM1638LedAndKeyModule::showText(const char *text) {
+    uint8_t position = 0;
+    while (text && *text && position < 8) {
+        const bool decimalPoint = text[1] == '.';
+        setDigit(position++, *text, decimalPoint);
+        text += decimalPoint ? 2 : 1;
+    }
+    while (position < 8) {
+        setSegments(position++, 0x00);
+    }
+}
+
+void TM1638LedAndKeyModule::writeCell(uint8_t address, uint8_t value) {
+    if (address >= kDisplayRamSize || displayRam[address] == value) {
+        return;
+    }
+    displayRam[address] = value;
+    dirtyCells |= static_cast<uint16_t>(1U << address);
+}
+
+void TM1638LedAndKeyModule::flush() {
+    if (dirtyCells == 0) {
+        return;
+    }
+
+    uint8_t first = 0;
+    while (!(dirtyCells & (1U << first))) {
+        first++;
+    }
+    uint8_t last = kDisplayRamSize - 1;
+    while (!(dirtyCells & (1U << last))) {
+        last--;
+    }
+
+    // A burst rewrites every cell between the first and last change; fixed
+    // addressing costs an address byte per cell. Pick the shorter one.
+    const uint8_t burstBytes = 2 + (last - first + 1);
+    const uint8_t fixedBytes = 1 + 2 * static_cast<uint8_t>(__builtin_popcount(dirtyCells));
+
+    if (burstBytes <= fixedBytes) {
+        sendCommand(0x40);        // Auto-increment mode
+        bus->select();
+        bus->writeByte(0xC0 + first);
+        for (uint8_t address = first; address <= last; address++) {
+            bus->writeByte(displayRam[address]);
+        }
+        bus->deselect();
+    } else {
+        sendCommand(0x44);        // Fixed address mode
+        for (uint8_t address = first; address <= last; address++) {
+            if (!(dirtyCells & (1U << address))) {
+                continue;
+            }
+            bus->select();
+            bus->writeByte(0xC0 + address);
+            bus->writeByte(displayRam[address]);
+            bus->deselect();
+        }
+    }
+
+    dirtyCells = 0;
+}
+
+TM1638LedAndKeyModule::BenchmarkResult TM1638LedAndKeyModule::benchmark(Backend backend,
+                                                                       uint16_t iterations) {
+    BenchmarkResult result{0, 0};
+    if (iterations == 0) {
+        return result;
+    }
+    const Backend previous = activeBackend;
+    const uint16_t pendingCells = dirtyCells;
+    setBackend(backend);
+
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < iterations; i++) {
+        readButtons();
+    }
+    result.readButtonsMicros = (micros() - start) / iterations;
+
+    start = micros();
+    for (uint16_t i = 0; i < iterations; i++) {
+        dirtyCells = 0xFFFF;
+        flush();
+    }
+    result.fullFlushMicros = (micros() - start) / iterations;
 
-    sendCommand(0x44);        // Fixed address mode
-    digitalWrite(strobe, LOW);
-    shiftOut(data, clk, LSBFIRST, 0xC1 + (position << 1));
-    shiftOut(data, clk, LSBFIRST, value ? 0xFF : 0x00);
-    digitalWrite(strobe, HIGH);
+    dirtyCells = pendingCells;
+    setBackend(previous);
+    return result;
 }
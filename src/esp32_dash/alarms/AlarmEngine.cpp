@@ -0,0 +1,154 @@
+#include "esp32_dash/alarms/AlarmEngine.h"
+
+AlarmEngine::AlarmEngine(const AlarmRule *rules, size_t count)
+        : rules_(rules), count_(count < kMaxRules ? count : kMaxRules) {}
+
+void AlarmEngine::reset(uint32_t nowMs) {
+    for (size_t i = 0; i < count_; ++i) {
+        if (state_[i] & kActive) {
+            changed_ = true;
+        }
+        state_[i] = 0;
+    }
+    for (SignalState &signal : signals_) {
+        signal = SignalState{0.0f, 0, nowMs, false};
+    }
+}
+
+void AlarmEngine::sample(AlarmSignal signal, float value, uint32_t nowMs) {
+    SignalState &state = signals_[static_cast<size_t>(signal)];
+    state.sampledAtMs = nowMs;
+    float ratePerSecond = 0.0f;
+    bool hasRate = false;
+    if (!state.hasAnchor) {
+        state.anchorValue = value;
+        state.anchorMs = nowMs;
+        state.hasAnchor = true;
+    } else if (nowMs - state.anchorMs >= kRateWindowMs) {
+        ratePerSecond = (value - state.anchorValue) * 1000.0f / static_cast<float>(nowMs - state.anchorMs);
+        hasRate = true;
+        state.anchorValue = value;
+        state.anchorMs = nowMs;
+    }
+
+    for (size_t i = 0; i < count_; ++i) {
+        const AlarmRule &rule = rules_[i];
+        if (rule.signal != signal) {
+            continue;
+        }
+        switch (rule.kind) {
+            case AlarmKind::Above:
+                update(i, value >= rule.trip, value <= rule.clear);
+                break;
+            case AlarmKind::Below:
+                update(i, value <= rule.trip, value >= rule.clear);
+                break;
+            case AlarmKind::RisingFaster:
+                if (hasRate) {
+                    update(i, ratePerSecond >= rule.trip, ratePerSecond <= rule.clear);
+                }
+                break;
+            case AlarmKind::Stale:
+                update(i, false, true);
+                break;
+        }
+    }
+}
+
+void AlarmEngine::checkStale(uint32_t nowMs) {
+    for (size_t i = 0; i < count_; ++i) {
+        const AlarmRule &rule = rules_[i];
+        if (rule.kind != AlarmKind::Stale || (state_[i] & kTripping)) {
+            continue;
+        }
+        const SignalState &signal = signals_[static_cast<size_t>(rule.signal)];
+        if (static_cast<float>(nowMs - signal.sampledAtMs) >= rule.trip) {
+            update(i, true, false);
+        }
+    }
+}
+
+void AlarmEngine::update(size_t index, bool trip, bool clear) {
+    uint8_t &state = state_[index];
+    if (trip) {
+        state |= kTripping;
+        if (!(state & kActive)) {
+            state = kActive | kTripping;
+            changed_ = true;
+        }
+    } else if (clear) {
+        state &= static_cast<uint8_t>(~kTripping);
+        // A latched alarm the driver already acknowledged has nothing left to show.
+        if ((state & kActive) && (!rules_[index].latching || (state & kAcknowledged))) {
+            state = 0;
+            changed_ = true;
+        }
+    }
+    // Between the trip and clear levels nothing changes.
+}
+
+void AlarmEngine::acknowledge() {
+    for (size_t i = 0; i < count_; ++i) {
+        uint8_t &state = state_[i];
+        if (!(state & kActive) || (state & kAcknowledged)) {
+            continue;
+        }
+        state = (state & kTripping) ? (state | kAcknowledged) : 0;
+        changed_ = true;
+    }
+}
+
+bool AlarmEngine::takeChanged() {
+    const bool changed = changed_;
+    changed_ = false;
+    return changed;
+}
+
+const AlarmRule *AlarmEngine::highestActive() const {
+    const AlarmRule *best = nullptr;
+    for (size_t i = 0; i < count_; ++i) {
+        if ((state_[i] & (kActive | kAcknowledged)) != kActive) {
+            continue;
+        }
+        if (!best || rules_[i].severity > best->severity) {
+            best = &rules_[i];
+        }
+    }
+    return best;
+}
+
+bool AlarmEngine::isValueAlarming(AlarmSignal signal) const {
+    for (size_t i = 0; i < count_; ++i) {
+        if ((state_[i] & kActive) && rules_[i].signal == signal && rules_[i].kind != AlarmKind::Stale) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t AlarmEngine::ledMask() const {
+    uint8_t mask = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        if (state_[i] & kActive) {
+            mask |= rules_[i].ledMask;
+        }
+    }
+    return mask;
+}
+
+uint8_t AlarmEngine::ledMask(AlarmSeverity severity) const {
+    uint8_t mask = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        if ((state_[i] & kActive) && rules_[i].severity == severity) {
+            mask |= rules_[i].ledMask;
+        }
+    }
+    return mask;
+}
+
+uint8_t composeAlarmLeds(uint8_t baseLeds, uint8_t warningLeds, uint8_t criticalLeds) {
+    if (criticalLeds != 0) {
+        return criticalLeds;
+    }
+    return static_cast<uint8_t>(baseLeds | warningLeds);
+}
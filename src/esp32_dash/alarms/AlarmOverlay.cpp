@@ -0,0 +1,45 @@
+#include "esp32_dash/alarms/AlarmOverlay.h"
+
+#include "esp32_dash/alarms/AlarmEngine.h"
+#include "esp32_dash/display/DisplayManager.h"
+
+AlarmOverlay::AlarmOverlay(const Config &config, AlarmEngine &engine, DisplayManager &displayManager)
+        : config_(config), engine_(engine), displayManager_(displayManager) {}
+
+void AlarmOverlay::update(bool alarmsChanged) {
+    if (!alarmsChanged) {
+        if (critical_ && !displayManager_.hasTransient()) {
+            present(*critical_);
+        }
+        return;
+    }
+    const AlarmRule *alarm = engine_.highestActive();
+    if (alarm) {
+        present(*alarm);
+    } else if (shown_) {
+        displayManager_.showTransientMessage(String());
+        shown_ = false;
+    }
+    critical_ = alarm && alarm->severity == AlarmSeverity::Critical ? alarm : nullptr;
+}
+
+bool AlarmOverlay::showStatus(const String &message) {
+    if (critical_) {
+        return false;
+    }
+    displayManager_.showTransientMessage(message, config_.statusMs);
+    // The message replaced any warning; clearing that later must not cut
+    // this one short.
+    shown_ = false;
+    return true;
+}
+
+void AlarmOverlay::present(const AlarmRule &alarm) {
+    // Critical alarms stay up until they clear or are acknowledged.
+    const bool critical = alarm.severity == AlarmSeverity::Critical;
+    displayManager_.showTransientMessage(alarm.message,
+                                         critical ? 0 : config_.warningMs,
+                                         critical ? 0xFFFF : 0x0000,
+                                         critical ? config_.criticalBackground : config_.warningBackground);
+    shown_ = true;
+}
@@ -0,0 +1,67 @@
+#include "esp32_dash/diagnostics/BootTimeline.h"
+
+#include <stdio.h>
+
+BootTimeline &bootTimeline() {
+    static BootTimeline timeline;
+    return timeline;
+}
+
+void BootTimeline::mark(BootMilestone milestone) {
+    const size_t index = static_cast<size_t>(milestone);
+    if (index >= kMilestoneCount || _reached[index]) {
+        return;
+    }
+    _micros[index] = micros();
+    _reached[index] = true;
+}
+
+bool BootTimeline::reached(BootMilestone milestone) const {
+    const size_t index = static_cast<size_t>(milestone);
+    return index < kMilestoneCount && _reached[index];
+}
+
+uint32_t BootTimeline::microsAt(BootMilestone milestone) const {
+    return reached(milestone) ? _micros[static_cast<size_t>(milestone)] : 0;
+}
+
+size_t BootTimeline::format(char *buffer, size_t size) const {
+    if (!buffer || size == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    size_t used = 0;
+    for (size_t i = 0; i < kMilestoneCount; ++i) {
+        const auto milestone = static_cast<BootMilestone>(i);
+        int written;
+        if (reached(milestone)) {
+            written = snprintf(buffer + used, size - used, "%s %lu ms\n",
+                               milestoneName(milestone),
+                               static_cast<unsigned long>(microsAt(milestone) / 1000UL));
+        } else {
+            written = snprintf(buffer + used, size - used, "%s pending\n",
+                               milestoneName(milestone));
+        }
+        if (written < 0) {
+            break;
+        }
+        if (static_cast<size_t>(written) >= size - used) {
+            used = size - 1;
+            break;
+        }
+        used += static_cast<size_t>(written);
+    }
+    return used;
+}
+
+const char *BootTimeline::milestoneName(BootMilestone milestone) {
+    switch (milestone) {
+        case BootMilestone::SetupStart:   return "setup";
+        case BootMilestone::SensorsReady: return "sensors";
+        case BootMilestone::DisplayReady: return "display";
+        case BootMilestone::GaugesLive:   return "gauges";
+        case BootMilestone::BleReady:     return "ble";
+        case BootMilestone::Count:        break;
+    }
+    return "?";
+}
@@ -0,0 +1,129 @@
+#include "esp32_dash/diagnostics/LoopProfiler.h"
+
+#include <stdio.h>
+
+LoopProfiler &loopProfiler() {
+    static LoopProfiler profiler;
+    return profiler;
+}
+
+void LoopProfiler::record(ProfileZone zone, uint32_t elapsedMicros) {
+    const size_t index = static_cast<size_t>(zone);
+    if (index >= kZoneCount) {
+        return;
+    }
+    const uint8_t bucket = bucketFor(elapsedMicros);
+    portENTER_CRITICAL(&_mux);
+    ZoneStats &stats = _zones[index];
+    stats.count++;
+    stats.totalMicros += elapsedMicros;
+    if (elapsedMicros > stats.maxMicros) {
+        stats.maxMicros = elapsedMicros;
+    }
+    stats.buckets[bucket]++;
+    portEXIT_CRITICAL(&_mux);
+}
+
+void LoopProfiler::reset() {
+    portENTER_CRITICAL(&_mux);
+    for (auto &zone : _zones) {
+        zone = ZoneStats{};
+    }
+    portEXIT_CRITICAL(&_mux);
+}
+
+LoopProfiler::ZoneStats LoopProfiler::stats(ProfileZone zone) const {
+    const size_t index = static_cast<size_t>(zone);
+    portENTER_CRITICAL(&_mux);
+    const ZoneStats copy = _zones[index < kZoneCount ? index : 0];
+    portEXIT_CRITICAL(&_mux);
+    return copy;
+}
+
+uint32_t LoopProfiler::percentileMicros(ProfileZone zone, uint8_t percentile) const {
+    return percentileOf(stats(zone), percentile);
+}
+
+uint32_t LoopProfiler::percentileOf(const ZoneStats &zoneStats, uint8_t percentile) {
+    if (zoneStats.count == 0) {
+        return 0;
+    }
+    if (percentile > 100) {
+        percentile = 100;
+    }
+    // Smallest bucket whose cumulative count reaches the requested rank.
+    const uint64_t rank = (static_cast<uint64_t>(zoneStats.count) * percentile + 99) / 100;
+    uint64_t seen = 0;
+    for (uint8_t bucket = 0; bucket < kBucketCount; ++bucket) {
+        seen += zoneStats.buckets[bucket];
+        if (seen >= rank && seen > 0) {
+            const uint32_t bound = bucketUpperBoundMicros(bucket);
+            return bound < zoneStats.maxMicros ? bound : zoneStats.maxMicros;
+        }
+    }
+    return zoneStats.maxMicros;
+}
+
+size_t LoopProfiler::format(char *buffer, size_t size) const {
+    if (!buffer || size == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    size_t used = 0;
+    for (size_t i = 0; i < kZoneCount; ++i) {
+        const auto zone = static_cast<ProfileZone>(i);
+        const ZoneStats zoneStats = stats(zone);
+        if (zoneStats.count == 0) {
+            continue;
+        }
+        const int written = snprintf(buffer + used, size - used,
+                                     "%s n=%lu avg=%lu p99=%lu max=%lu us\n",
+                                     zoneName(zone),
+                                     static_cast<unsigned long>(zoneStats.count),
+                                     static_cast<unsigned long>(zoneStats.totalMicros / zoneStats.count),
+                                     static_cast<unsigned long>(percentileOf(zoneStats, 99)),
+                                     static_cast<unsigned long>(zoneStats.maxMicros));
+        if (written < 0) {
+            break;
+        }
+        if (static_cast<size_t>(written) >= size - used) {
+            used = size - 1;  // truncated, keep what fits
+            break;
+        }
+        used += static_cast<size_t>(written);
+    }
+    if (used == 0) {
+        return static_cast<size_t>(snprintf(buffer, size, "No samples\n"));
+    }
+    return used;
+}
+
+const char *LoopProfiler::zoneName(ProfileZone zone) {
+    switch (zone) {
+        case ProfileZone::Loop:        return "loop";
+        case ProfileZone::DisplayLoop: return "display";
+        case ProfileZone::TachUpdate:  return "tach";
+        case ProfileZone::WaterUpdate: return "water";
+        case ProfileZone::WaterRead:   return "waterRead";
+        case ProfileZone::Buttons:     return "buttons";
+        case ProfileZone::Leds:        return "leds";
+        case ProfileZone::Count:       break;
+    }
+    return "?";
+}
+
+uint8_t LoopProfiler::bucketFor(uint32_t elapsedMicros) {
+    uint8_t bucket = 0;
+    while (elapsedMicros != 0 && bucket < kBucketCount - 1) {
+        elapsedMicros >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+uint32_t LoopProfiler::bucketUpperBoundMicros(uint8_t bucket) {
+    if (bucket >= kBucketCount - 1) {
+        return UINT32_MAX;
+    }
+    return (1UL << bucket) - 1;
+}
@@ -0,0 +1,185 @@
+#include "esp32_dash/diagnostics/SerialConsole.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+namespace {
+// Compares \c word with the next space-separated word of \c command and
+// advances past it.
+bool takeWord(const char *&command, const char *word) {
+    while (*command == ' ') {
+        ++command;
+    }
+    const char *end = command;
+    while (*end && *end != ' ') {
+        ++end;
+    }
+    const size_t length = static_cast<size_t>(end - command);
+    if (length == 0 || strlen(word) != length || strncasecmp(command, word, length) != 0) {
+        return false;
+    }
+    command = end;
+    return true;
+}
+}
+
+bool ConsoleArgs::matches(const char *command, size_t extraArgs) const {
+    size_t word = 0;
+    const char *rest = command;
+    while (true) {
+        while (*rest == ' ') {
+            ++rest;
+        }
+        if (*rest == '\0') {
+            break;
+        }
+        if (word >= count || !takeWord(rest, words[word])) {
+            return false;
+        }
+        ++word;
+    }
+    return word > 0 && count == word + extraArgs;
+}
+
+bool ConsoleArgs::uintAt(size_t index, uint32_t &value) const {
+    if (index >= count || words[index][0] == '\0') {
+        return false;
+    }
+    uint32_t parsed = 0;
+    for (const char *c = words[index]; *c; ++c) {
+        if (*c < '0' || *c > '9') {
+            return false;
+        }
+        const uint32_t digit = static_cast<uint32_t>(*c - '0');
+        if (parsed > (UINT32_MAX - digit) / 10) {
+            return false;
+        }
+        parsed = parsed * 10 + digit;
+    }
+    value = parsed;
+    return true;
+}
+
+void SerialConsole::write(const char *text, size_t length) {
+    queueText(text, length, nullptr, 0);
+}
+
+void SerialConsole::queueText(const char *text, size_t length, const char *suffix, size_t suffixLength) {
+    const auto *bytes = reinterpret_cast<const uint8_t *>(text);
+    const auto *suffixBytes = reinterpret_cast<const uint8_t *>(suffix);
+    portENTER_CRITICAL(&_mux);
+    _log.pushOverwrite(bytes, length);
+    _log.pushOverwrite(suffixBytes, suffixLength);
+    if (!_streaming) {
+        // All of it or none, so a line is never queued without its end.
+        if (length + suffixLength > _tx.freeSpace()) {
+            _droppedBytes = _droppedBytes + length + suffixLength;
+        } else {
+            _tx.push(bytes, length);
+            _tx.push(suffixBytes, suffixLength);
+        }
+    }
+    portEXIT_CRITICAL(&_mux);
+}
+
+void SerialConsole::print(const char *text) {
+    write(text, strlen(text));
+}
+
+void SerialConsole::println(const char *text) {
+    queueText(text, strlen(text), "\n", 1);
+}
+
+void SerialConsole::printf(const char *format, ...) {
+    char line[kFormatBytes];
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (length <= 0) {
+        return;
+    }
+    size_t kept = static_cast<size_t>(length);
+    if (kept >= sizeof(line)) {
+        kept = sizeof(line) - 1;
+        portENTER_CRITICAL(&_mux);
+        _droppedBytes = _droppedBytes + (static_cast<size_t>(length) - kept);
+        portEXIT_CRITICAL(&_mux);
+    }
+    write(line, kept);
+}
+
+bool SerialConsole::writeFrame(const uint8_t *frame, size_t length) {
+    portENTER_CRITICAL(&_mux);
+    const bool queued = _streaming && _tx.push(frame, length);
+    if (_streaming && !queued) {
+        _droppedFrames = _droppedFrames + 1;
+    }
+    portEXIT_CRITICAL(&_mux);
+    return queued;
+}
+
+void SerialConsole::dumpLog() {
+    if (_streaming) {
+        return;
+    }
+    portENTER_CRITICAL(&_mux);
+    const size_t total = _log.used();
+    if (total > _tx.freeSpace()) {
+        _droppedBytes = _droppedBytes + total;
+    } else {
+        const uint8_t *chunk = nullptr;
+        size_t offset = 0;
+        while (offset < total) {
+            const size_t run = _log.peek(chunk, offset);
+            _tx.push(chunk, run);
+            offset += run;
+        }
+    }
+    portEXIT_CRITICAL(&_mux);
+}
+
+size_t SerialConsole::peekTx(const uint8_t *&chunk) {
+    portENTER_CRITICAL(&_mux);
+    const size_t length = _tx.peek(chunk);
+    portEXIT_CRITICAL(&_mux);
+    return length;
+}
+
+void SerialConsole::consumeTx(size_t length) {
+    portENTER_CRITICAL(&_mux);
+    _tx.pop(length);
+    portEXIT_CRITICAL(&_mux);
+}
+
+bool SerialConsole::feed(char c, ConsoleArgs &args) {
+    if (c != '\r' && c != '\n') {
+        if (_lineLength < kLineLength - 1) {
+            _line[_lineLength++] = c;
+        }
+        return false;
+    }
+    if (_lineLength == 0) {
+        return false;
+    }
+    _line[_lineLength] = '\0';
+    _lineLength = 0;
+
+    args.count = 0;
+    char *cursor = _line;
+    while (*cursor && args.count < ConsoleArgs::kMaxWords) {
+        while (*cursor == ' ' || *cursor == '\t') {
+            *cursor++ = '\0';
+        }
+        if (*cursor == '\0') {
+            break;
+        }
+        args.words[args.count++] = cursor;
+        while (*cursor && *cursor != ' ' && *cursor != '\t') {
+            ++cursor;
+        }
+    }
+    return args.count > 0;
+}
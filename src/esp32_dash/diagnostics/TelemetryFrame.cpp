@@ -0,0 +1,65 @@
+#include "esp32_dash/diagnostics/TelemetryFrame.h"
+
+#include <math.h>
+
+namespace {
+void putU16(uint8_t *&out, uint16_t value) {
+    *out++ = static_cast<uint8_t>(value);
+    *out++ = static_cast<uint8_t>(value >> 8);
+}
+
+void putU32(uint8_t *&out, uint32_t value) {
+    putU16(out, static_cast<uint16_t>(value));
+    putU16(out, static_cast<uint16_t>(value >> 16));
+}
+
+uint16_t clampU16(float value) {
+    if (isnan(value) || value <= 0.0f) {
+        return 0;
+    }
+    return value >= 65535.0f ? 65535 : static_cast<uint16_t>(lroundf(value));
+}
+
+int16_t coolantTenths(float tempC) {
+    if (isnan(tempC)) {
+        return INT16_MIN;
+    }
+    const float tenths = tempC * 10.0f;
+    if (tenths <= -32767.0f) {
+        return -32767;
+    }
+    return tenths >= 32767.0f ? 32767 : static_cast<int16_t>(lroundf(tenths));
+}
+}
+
+uint8_t telemetryCrc8(const uint8_t *data, size_t length) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (uint8_t shift = 0; shift < 8; ++shift) {
+            crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+        }
+    }
+    return crc;
+}
+
+size_t encodeTelemetryFrame(const TelemetrySample &sample, uint8_t *out, size_t size) {
+    if (!out || size < kTelemetryFrameBytes) {
+        return 0;
+    }
+    uint8_t *cursor = out;
+    *cursor++ = kTelemetrySync0;
+    *cursor++ = kTelemetrySync1;
+    *cursor++ = kTelemetryTypeSample;
+    *cursor++ = static_cast<uint8_t>(kTelemetryPayloadBytes);
+    putU32(cursor, sample.ms);
+    putU16(cursor, clampU16(sample.rpm));
+    putU16(cursor, static_cast<uint16_t>(coolantTenths(sample.coolantC)));
+    putU16(cursor, clampU16(sample.speedKmh * 10.0f));
+    *cursor++ = sample.page;
+    *cursor++ = sample.inputs;
+    *cursor++ = sample.alarmLeds;
+    putU16(cursor, sample.droppedBytes > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(sample.droppedBytes));
+    *cursor = telemetryCrc8(out + 2, 2 + kTelemetryPayloadBytes);
+    return kTelemetryFrameBytes;
+}
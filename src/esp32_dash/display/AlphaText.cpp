@@ -0,0 +1,109 @@
+#include "esp32_dash/display/AlphaText.h"
+
+#include "esp32_dash/display/DmaGC9A01A.h"
+
+namespace {
+constexpr int16_t kMaxRowPixels = 240;
+
+const AlphaGlyph *findGlyph(const AlphaFont &font, char c) {
+    const uint8_t code = static_cast<uint8_t>(c);
+    for (uint8_t i = 0; i < font.glyphCount; ++i) {
+        if (font.glyphs[i].code == code) {
+            return &font.glyphs[i];
+        }
+        if (font.glyphs[i].code > code) {
+            break;
+        }
+    }
+    return nullptr;
+}
+
+int8_t kerningFor(const AlphaFont &font, char left, char right) {
+    for (uint16_t i = 0; i < font.kerningCount; ++i) {
+        const AlphaKerning &pair = font.kerning[i];
+        if (pair.left == static_cast<uint8_t>(left) && pair.right == static_cast<uint8_t>(right)) {
+            return pair.adjust;
+        }
+    }
+    return 0;
+}
+
+int16_t cellWidth(const AlphaFont &font, const AlphaGlyph *glyph, char c, char next) {
+    if (!glyph) {
+        return 0;
+    }
+    const int16_t width = glyph->xAdvance + (next ? kerningFor(font, c, next) : 0);
+    return width > 0 ? width : 0;
+}
+
+uint16_t blend565(uint16_t color, uint16_t background, uint8_t alpha) {
+    const int fr = (color >> 11) & 0x1F, fg = (color >> 5) & 0x3F, fb = color & 0x1F;
+    const int br = (background >> 11) & 0x1F, bg = (background >> 5) & 0x3F, bb = background & 0x1F;
+    const int r = br + ((fr - br) * alpha + 7) / 15;
+    const int g = bg + ((fg - bg) * alpha + 7) / 15;
+    const int b = bb + ((fb - bb) * alpha + 7) / 15;
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+uint8_t coverageAt(const AlphaFont &font, const AlphaGlyph &glyph, int16_t gx, int16_t gy) {
+    const uint16_t rowBytes = (glyph.width + 1) / 2;
+    const uint8_t packed = font.bitmap[glyph.offset + gy * rowBytes + gx / 2];
+    return (gx & 1) ? (packed & 0x0F) : (packed >> 4);
+}
+}
+
+int16_t alphaTextWidth(const AlphaFont &font, const char *text) {
+    if (!text) {
+        return 0;
+    }
+    int16_t width = 0;
+    for (const char *c = text; *c; ++c) {
+        width += cellWidth(font, findGlyph(font, *c), *c, c[1]);
+    }
+    return width;
+}
+
+void drawAlphaText(Adafruit_GC9A01A &display,
+                   const AlphaFont &font,
+                   const char *text,
+                   int16_t x,
+                   int16_t top,
+                   uint16_t color,
+                   uint16_t backgroundColor) {
+    int16_t width = alphaTextWidth(font, text);
+    if (x + width > display.width()) {
+        width = display.width() - x;
+    }
+    if (width > kMaxRowPixels) {
+        width = kMaxRowPixels;
+    }
+    if (width <= 0 || x < 0 || top < 0) {
+        return;
+    }
+
+    uint16_t palette[16];
+    for (uint8_t alpha = 0; alpha < 16; ++alpha) {
+        palette[alpha] = blend565(color, backgroundColor, alpha);
+    }
+
+    uint16_t row[kMaxRowPixels];
+    display.startWrite();
+    display.setAddrWindow(x, top, width, font.lineHeight);
+    for (int16_t y = 0; y < font.lineHeight; ++y) {
+        int16_t cellX = 0;
+        for (const char *c = text; *c && cellX < width; ++c) {
+            const AlphaGlyph *glyph = findGlyph(font, *c);
+            const int16_t cell = cellWidth(font, glyph, *c, c[1]);
+            const int16_t gy = glyph ? y - glyph->yOffset : -1;
+            const bool rowInked = glyph && gy >= 0 && gy < glyph->height;
+            for (int16_t px = 0; px < cell && cellX + px < width; ++px) {
+                const int16_t gx = px - glyph->xOffset;
+                const bool inked = rowInked && gx >= 0 && gx < glyph->width;
+                row[cellX + px] = palette[inked ? coverageAt(font, *glyph, gx, gy) : 0];
+            }
+            cellX += cell;
+        }
+        writePixelBlock(display, row, width);
+    }
+    display.endWrite();
+}
@@ -0,0 +1,96 @@
+#include "esp32_dash/display/widgets/Arc.h"
+
+#include "esp32_dash/util/TrigTable.h"
+
+namespace {
+constexpr int16_t kStepDegrees = 2;
+}
+
+Arc::Arc(int16_t centerX, int16_t centerY, int16_t innerRadius, int16_t outerRadius,
+         int16_t startDeg, int16_t sweepDeg,
+         float minValue, float maxValue,
+         uint16_t fillColor, uint16_t trackColor)
+        : _centerX(centerX),
+          _centerY(centerY),
+          _innerRadius(innerRadius),
+          _outerRadius(outerRadius),
+          _startDeg(startDeg),
+          _sweepDeg(sweepDeg),
+          _minValue(minValue),
+          _maxValue(maxValue),
+          _fillColor(fillColor),
+          _trackColor(trackColor),
+          _value(minValue),
+          _drawnDegrees(-1) {}
+
+void Arc::setValue(float value) {
+    if (fillDegreesFor(value) != fillDegreesFor(_value)) {
+        _dirty = true;
+    }
+    _value = value;
+}
+
+void Arc::setFillColor(uint16_t color) {
+    if (color == _fillColor) {
+        return;
+    }
+    _fillColor = color;
+    _drawnDegrees = -1;
+    _dirty = true;
+}
+
+void Arc::invalidate() {
+    _drawnDegrees = -1;
+    _dirty = true;
+}
+
+int16_t Arc::fillDegreesFor(float value) const {
+    if (_maxValue <= _minValue || value <= _minValue) {
+        return 0;
+    }
+    if (value >= _maxValue) {
+        return _sweepDeg;
+    }
+    const int16_t degrees = static_cast<int16_t>((value - _minValue) * _sweepDeg / (_maxValue - _minValue));
+    // Quantise to the wedge step so sub-step jitter does not cause redraws.
+    return static_cast<int16_t>(degrees - (degrees % kStepDegrees));
+}
+
+void Arc::fillRing(Adafruit_GFX &gfx, int16_t centerX, int16_t centerY,
+                   int16_t innerRadius, int16_t outerRadius,
+                   int16_t fromDeg, int16_t toDeg, uint16_t color) {
+    for (int16_t a = fromDeg; a < toDeg; a += kStepDegrees) {
+        const int16_t b = (a + kStepDegrees < toDeg) ? a + kStepDegrees : toDeg;
+        int16_t ix0, iy0, ox0, oy0, ix1, iy1, ox1, oy1;
+        trig::polarToScreen(centerX, centerY, innerRadius, a, ix0, iy0);
+        trig::polarToScreen(centerX, centerY, outerRadius, a, ox0, oy0);
+        trig::polarToScreen(centerX, centerY, innerRadius, b, ix1, iy1);
+        trig::polarToScreen(centerX, centerY, outerRadius, b, ox1, oy1);
+        gfx.fillTriangle(ix0, iy0, ox0, oy0, ox1, oy1, color);
+        gfx.fillTriangle(ix0, iy0, ox1, oy1, ix1, iy1, color);
+    }
+}
+
+void Arc::fillWedge(Adafruit_GC9A01A &display, int16_t fromDeg, int16_t toDeg, uint16_t color) const {
+    fillRing(display, _centerX, _centerY, _innerRadius, _outerRadius,
+             static_cast<int16_t>(_startDeg + fromDeg), static_cast<int16_t>(_startDeg + toDeg), color);
+}
+
+void Arc::draw(Adafruit_GC9A01A &display) {
+    if (!_dirty) {
+        return;
+    }
+
+    const int16_t degrees = fillDegreesFor(_value);
+    if (_drawnDegrees < 0) {
+        fillWedge(display, 0, degrees, _fillColor);
+        fillWedge(display, degrees, _sweepDeg, _trackColor);
+    } else if (degrees > _drawnDegrees) {
+        fillWedge(display, _drawnDegrees, degrees, _fillColor);
+    } else if (degrees < _drawnDegrees) {
+        fillWedge(display, degrees, _drawnDegrees, _trackColor);
+    }
+
+    _drawnDegrees = degrees;
+    _dirty = false;
+}
@@ -0,0 +1,70 @@
+#include "esp32_dash/display/widgets/Bar.h"
+
+Bar::Bar(int16_t x, int16_t y, int16_t width, int16_t height,
+         float minValue, float maxValue,
+         uint16_t fillColor, uint16_t trackColor)
+        : _x(x),
+          _y(y),
+          _width(width),
+          _height(height),
+          _minValue(minValue),
+          _maxValue(maxValue),
+          _fillColor(fillColor),
+          _trackColor(trackColor),
+          _value(minValue),
+          _drawnFill(-1) {}
+
+void Bar::setValue(float value) {
+    if (fillWidthFor(value) != fillWidthFor(_value)) {
+        _dirty = true;
+    }
+    _value = value;
+}
+
+void Bar::setFillColor(uint16_t color) {
+    if (color == _fillColor) {
+        return;
+    }
+    _fillColor = color;
+    // The filled span changes colour, so repaint it from scratch.
+    _drawnFill = -1;
+    _dirty = true;
+}
+
+void Bar::invalidate() {
+    _drawnFill = -1;
+    _dirty = true;
+}
+
+int16_t Bar::fillWidthFor(float value) const {
+    if (_maxValue <= _minValue || value <= _minValue) {
+        return 0;
+    }
+    if (value >= _maxValue) {
+        return _width;
+    }
+    return static_cast<int16_t>((value - _minValue) * _width / (_maxValue - _minValue));
+}
+
+void Bar::draw(Adafruit_GC9A01A &display) {
+    if (!_dirty) {
+        return;
+    }
+
+    const int16_t fill = fillWidthFor(_value);
+    if (_drawnFill < 0) {
+        if (fill > 0) {
+            display.fillRect(_x, _y, fill, _height, _fillColor);
+        }
+        if (fill < _width) {
+            display.fillRect(_x + fill, _y, _width - fill, _height, _trackColor);
+        }
+    } else if (fill > _drawnFill) {
+        display.fillRect(_x + _drawnFill, _y, fill - _drawnFill, _height, _fillColor);
+    } else if (fill < _drawnFill) {
+        display.fillRect(_x + fill, _y, _drawnFill - fill, _height, _trackColor);
+    }
+
+    _drawnFill = fill;
+    _dirty = false;
+}
@@ -2,6 +2,13 @@
 
 #include <SPI.h>
 
+#include "esp32_dash/display/DmaGC9A01A.h"
+
+namespace {
+// GC9A01A: no command for 5 ms after sleep out.
+constexpr uint32_t kSleepOutSettleMs = 5;
+}
+
 DisplayManager::DisplayManager(const DisplayConfig &config) : _config(config) {}
 
 bool DisplayManager::begin() {
@@ -14,9 +21,19 @@ bool DisplayManager::begin() {
         digitalWrite(_config.backlightPin, HIGH);
     }
 
-    _display.reset(
-            new Adafruit_GC9A01A(_config.csPin, _config.dcPin, _config.rstPin)
-    );
+    DmaGC9A01A *dmaDisplay = nullptr;
+    if (_config.dmaTransfers) {
+        DmaDisplayConfig dmaConfig;
+        dmaConfig.sclkPin = _config.sclPin;
+        dmaConfig.mosiPin = _config.sdaPin;
+        dmaConfig.clockHz = _config.spiClockHz;
+        dmaDisplay = new DmaGC9A01A(_config.csPin, _config.dcPin, _config.rstPin, dmaConfig);
+        _display.reset(dmaDisplay);
+    } else {
+        _display.reset(
+                new Adafruit_GC9A01A(_config.csPin, _config.dcPin, _config.rstPin)
+        );
+    }
     if (!_display) {
         Serial.println("Failed to allocate GC9A01A display");
         return false;
@@ -26,6 +43,9 @@ bool DisplayManager::begin() {
 
     _display->begin();
     _display->setRotation(_config.rotation);
+    if (dmaDisplay && !dmaDisplay->beginDma()) {
+        Serial.println("DMA display transfers unavailable, using blocking SPI");
+    }
     _display->fillScreen(_config.backgroundColor);
 
     _initialized = true;
@@ -34,8 +54,8 @@ bool DisplayManager::begin() {
     _suspended = false;
     _transientMessage.active = false;
 
-    if (!_pages.empty()) {
-        _pages[_currentPage]->onEnter(*_display);
+    if (pageCount() > 0) {
+        enterPage(_currentPage);
     }
 
     return true;
@@ -61,26 +81,49 @@ void DisplayManager::loop() {
         _dirty = true;
     }
 
+    // Animated pages advance at a fixed cadence and only request a frame
+    // while something is still moving.
+    if (!_transientMessage.active && pageCount() > 0 &&
+        (now - _lastAnimationTick) >= _config.animationFrameIntervalMs) {
+        _lastAnimationTick = now;
+        if (tickPage(_currentPage, now)) {
+            _dirty = true;
+        }
+    }
+
     const bool intervalElapsed =
             _config.refreshIntervalMs > 0 &&
             (now - _lastRender) >= _config.refreshIntervalMs;
 
+    // A scheduled switch rides on a frame that was going to be drawn anyway.
+    if (_pageRotation && !_transientMessage.active && pageCount() > 1) {
+        size_t next = _currentPage;
+        if (_pageRotation->poll(_currentPage, now, _dirty || intervalElapsed, next) &&
+            next < pageCount() && next != _currentPage) {
+            exitPage(_currentPage);
+            _currentPage = next;
+            enterPage(_currentPage);
+            _dirty = true;
+        }
+    }
+
     if (_dirty || intervalElapsed) {
-        if (_pages.empty()) {
+        if (pageCount() == 0) {
             drawPlaceholder();
         } else {
-            _pages[_currentPage]->render(*_display);
+            renderPage(_currentPage);
         }
         if (_transientMessage.active) {
             drawTransientOverlay();
         }
         _lastRender = now;
         _dirty = false;
+        ++_framesDrawn;
     }
 }
 
 void DisplayManager::addPage(DisplayPage *page) {
-    if (!page) {
+    if (!page || _pageTable) {
         return;
     }
     _pages.push_back(page);
@@ -91,40 +134,45 @@ void DisplayManager::addPage(DisplayPage *page) {
 }
 
 void DisplayManager::nextPage() {
-    if (_pages.size() <= 1 || !_display) {
+    if (pageCount() <= 1 || !_display) {
         return;
     }
-    _pages[_currentPage]->onExit(*_display);
-    _currentPage = (_currentPage + 1) % _pages.size();
-    _pages[_currentPage]->onEnter(*_display);
+    exitPage(_currentPage);
+    _currentPage = (_currentPage + 1) % pageCount();
+    enterPage(_currentPage);
     _dirty = true;
 }
 
 void DisplayManager::previousPage() {
-    if (_pages.size() <= 1 || !_display) {
+    if (pageCount() <= 1 || !_display) {
         return;
     }
-    _pages[_currentPage]->onExit(*_display);
+    exitPage(_currentPage);
     if (_currentPage == 0) {
-        _currentPage = _pages.size() - 1;
+        _currentPage = pageCount() - 1;
     } else {
         _currentPage--;
     }
-    _pages[_currentPage]->onEnter(*_display);
+    enterPage(_currentPage);
     _dirty = true;
 }
 
 void DisplayManager::showPage(size_t index) {
-    if (index >= _pages.size() || !_display) {
+    if (index >= pageCount()) {
+        return;
+    }
+    if (!_display) {
+        // Not started yet: begin() enters whichever page is selected.
+        _currentPage = index;
         return;
     }
     if (index == _currentPage) {
         _dirty = true;
         return;
     }
-    _pages[_currentPage]->onExit(*_display);
+    exitPage(_currentPage);
     _currentPage = index;
-    _pages[_currentPage]->onEnter(*_display);
+    enterPage(_currentPage);
     _dirty = true;
 }
 
@@ -148,6 +196,31 @@ void DisplayManager::setSuspended(bool suspended) {
     }
 }
 
+void DisplayManager::sendPanelCommand(uint8_t command) {
+    if (DmaGC9A01A *dma = DmaGC9A01A::active()) {
+        // Queue behind any pixels still in flight, then wait for all of it.
+        dma->queueCommand(command);
+        dma->flush();
+    } else {
+        _display->sendCommand(command);
+    }
+}
+
+void DisplayManager::setPanelAsleep(bool asleep) {
+    if (!_initialized || !_display) {
+        return;
+    }
+    if (asleep) {
+        sendPanelCommand(GC9A01A_DISPOFF);
+        sendPanelCommand(GC9A01A_SLPIN);
+    } else {
+        sendPanelCommand(GC9A01A_SLPOUT);
+        delay(kSleepOutSettleMs);
+        sendPanelCommand(GC9A01A_DISPON);
+        _dirty = true;
+    }
+}
+
 void DisplayManager::showTransientMessage(const String &message,
                                           uint32_t durationMs,
                                           uint16_t textColor,
@@ -165,6 +238,7 @@ void DisplayManager::showTransientMessage(const String &message,
         return;
     }
     _transientMessage.text = message;
+    _transientMessage.image = nullptr;
     _transientMessage.shownAt = millis();
     _transientMessage.durationMs = durationMs;
     _transientMessage.textColor = textColor;
@@ -174,6 +248,22 @@ void DisplayManager::showTransientMessage(const String &message,
     _dirty = true;
 }
 
+void DisplayManager::showTransientImage(const RleImage &image,
+                                        uint32_t durationMs,
+                                        uint16_t backgroundColor) {
+    if (!_initialized || !_display || _suspended) {
+        return;
+    }
+    _transientMessage.text = String();
+    _transientMessage.image = &image;
+    _transientMessage.shownAt = millis();
+    _transientMessage.durationMs = durationMs;
+    _transientMessage.backgroundColor = backgroundColor;
+    _transientMessage.requiresPageReset = true;
+    _transientMessage.active = true;
+    _dirty = true;
+}
+
 Adafruit_GC9A01A *DisplayManager::display() {
     return _display.get();
 }
@@ -188,15 +278,27 @@ void DisplayManager::drawPlaceholder() {
     _display->setTextSize(2);
     _display->setCursor(10, _config.height / 2);
     _display->println(F("Miata"));
-    delay(3000);
 }
 
 void DisplayManager::drawTransientOverlay() {
-    if (!_display || !_transientMessage.active || _transientMessage.text.isEmpty()) {
+    if (!_display || !_transientMessage.active) {
         return;
     }
 
     Adafruit_GC9A01A &display = *_display;
+    if (const RleImage *image = _transientMessage.image) {
+        if (image->width < display.width() || image->height < display.height()) {
+            display.fillScreen(_transientMessage.backgroundColor);
+        }
+        drawRleImage(display, *image,
+                     static_cast<int16_t>((display.width() - image->width) / 2),
+                     static_cast<int16_t>((display.height() - image->height) / 2));
+        return;
+    }
+    if (_transientMessage.text.isEmpty()) {
+        return;
+    }
+
     display.setTextWrap(false);
     display.fillScreen(_transientMessage.backgroundColor);
 
@@ -229,8 +331,54 @@ void DisplayManager::resetCurrentPageLayout() {
         return;
     }
     _display->fillScreen(_config.backgroundColor);
-    if (_pages.empty()) {
+    if (pageCount() == 0) {
         return;
     }
-    _pages[_currentPage]->onEnter(*_display);
+    enterPage(_currentPage);
+}
+
+void DisplayManager::bindPageTable(const PageTable *table, void *pages) {
+    _pageTable = table;
+    _pageSet = pages;
+    _pages.clear();
+    _currentPage = 0;
+    if (_initialized && _display) {
+        enterPage(_currentPage);
+    }
+    _dirty = true;
+}
+
+size_t DisplayManager::pageCount() const {
+    return _pageTable ? _pageTable->count : _pages.size();
+}
+
+void DisplayManager::enterPage(size_t index) {
+    if (_pageTable) {
+        _pageTable->enter(_pageSet, index, *_display);
+    } else {
+        _pages[index]->onEnter(*_display);
+    }
+}
+
+void DisplayManager::exitPage(size_t index) {
+    if (_pageTable) {
+        _pageTable->exit(_pageSet, index, *_display);
+    } else {
+        _pages[index]->onExit(*_display);
+    }
+}
+
+bool DisplayManager::tickPage(size_t index, uint32_t nowMs) {
+    if (_pageTable) {
+        return _pageTable->tick(_pageSet, index, nowMs);
+    }
+    return _pages[index]->tick(nowMs);
+}
+
+void DisplayManager::renderPage(size_t index) {
+    if (_pageTable) {
+        _pageTable->render(_pageSet, index, *_display);
+    } else {
+        _pages[index]->render(*_display);
+    }
 }
@@ -0,0 +1,250 @@
+#include "esp32_dash/display/DmaGC9A01A.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <SPI.h>
+
+#include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#endif
+
+void writePixelBlock(Adafruit_GC9A01A &display, uint16_t *pixels, uint32_t count) {
+#if defined(ARDUINO_ARCH_ESP32)
+    DmaGC9A01A *dma = DmaGC9A01A::active();
+    if (dma && &display == dma) {
+        dma->pushPixels(pixels, count);
+        return;
+    }
+#endif
+    display.writePixels(pixels, count);
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+namespace {
+constexpr spi_host_device_t kHost = SPI3_HOST;  // VSPI, the bus Arduino's SPI object drives
+
+// SpiDmaQueue puts (dcPin << 1) | level in transaction.user.
+void IRAM_ATTR setDcBeforeTransfer(spi_transaction_t *transaction) {
+    const uintptr_t user = reinterpret_cast<uintptr_t>(transaction->user);
+    gpio_set_level(static_cast<gpio_num_t>(user >> 1), user & 1);
+}
+}
+
+DmaGC9A01A *DmaGC9A01A::s_active = nullptr;
+
+DmaGC9A01A::DmaGC9A01A(int8_t csPin, int8_t dcPin, int8_t rstPin, const DmaDisplayConfig &config)
+        : Adafruit_GC9A01A(csPin, dcPin, rstPin), _config(config), _csPin(csPin), _dcPin(dcPin) {}
+
+DmaGC9A01A::~DmaGC9A01A() {
+    releaseBus();
+}
+
+bool DmaGC9A01A::beginDma() {
+    if (dmaActive()) {
+        return true;
+    }
+    if (_csPin < 0 || _dcPin < 0 || _config.linePixels == 0) {
+        return false;
+    }
+
+    const size_t bufferBytes = static_cast<size_t>(_config.linePixels) * sizeof(uint16_t);
+    for (uint16_t *&buffer : _buffers) {
+        buffer = static_cast<uint16_t *>(heap_caps_malloc(bufferBytes, MALLOC_CAP_DMA));
+    }
+    if (!_buffers[0] || !_buffers[1]) {
+        releaseBus();
+        return false;
+    }
+
+    // Adafruit's begin() left the peripheral on the Arduino SPI driver.
+    SPI.end();
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = _config.mosiPin;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = _config.sclkPin;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = static_cast<int>(bufferBytes);
+    if (spi_bus_initialize(kHost, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        releaseBus();
+        SPI.begin();
+        return false;
+    }
+
+    spi_device_interface_config_t device = {};
+    device.clock_speed_hz = static_cast<int>(_config.clockHz);
+    device.mode = 0;
+    device.spics_io_num = _csPin;
+    device.queue_size = SpiDmaQueue::kQueueDepth;
+    device.pre_cb = setDcBeforeTransfer;
+    if (spi_bus_add_device(kHost, &device, &_device) != ESP_OK) {
+        _device = nullptr;
+        spi_bus_free(kHost);
+        releaseBus();
+        SPI.begin();
+        return false;
+    }
+
+    pinMode(_dcPin, OUTPUT);
+    _queue.attach(_device, _dcPin, _buffers, _config.linePixels);
+    s_active = this;
+    return true;
+}
+
+void DmaGC9A01A::releaseBus() {
+    if (_device) {
+        _queue.detach();
+        spi_bus_remove_device(_device);
+        spi_bus_free(kHost);
+        _device = nullptr;
+    }
+    for (uint16_t *&buffer : _buffers) {
+        heap_caps_free(buffer);
+        buffer = nullptr;
+    }
+    if (s_active == this) {
+        s_active = nullptr;
+    }
+}
+
+void DmaGC9A01A::flush() {
+    _queue.flush();
+}
+
+void DmaGC9A01A::queueCommand(uint8_t command, const uint8_t *data, uint8_t length) {
+    if (!dmaActive()) {
+        sendCommand(command, data, length);
+        return;
+    }
+    _queue.command(command, data, length);
+}
+
+void DmaGC9A01A::pushPixels(const uint16_t *pixels, uint32_t count) {
+    _queue.pushPixels(pixels, count);
+}
+
+void DmaGC9A01A::startWrite() {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::startWrite();
+    }
+}
+
+void DmaGC9A01A::endWrite() {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::endWrite();
+    }
+}
+
+void DmaGC9A01A::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::setAddrWindow(x, y, w, h);
+        return;
+    }
+    _queue.prepare(static_cast<uint32_t>(w) * h);
+    _queue.setWindow(x, y, x + w - 1, y + h - 1);
+}
+
+bool DmaGC9A01A::clip(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const {
+    if (w < 0) {
+        x += w + 1;
+        w = -w;
+    }
+    if (h < 0) {
+        y += h + 1;
+        h = -h;
+    }
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > _width) {
+        w = _width - x;
+    }
+    if (y + h > _height) {
+        h = _height - y;
+    }
+    return w > 0 && h > 0;
+}
+
+void DmaGC9A01A::fillWindow(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!clip(x, y, w, h)) {
+        return;
+    }
+    setAddrWindow(x, y, w, h);
+    _queue.fill(color, static_cast<uint32_t>(w) * static_cast<uint32_t>(h));
+}
+
+void DmaGC9A01A::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::drawPixel(x, y, color);
+        return;
+    }
+    writePixel(x, y, color);
+}
+
+void DmaGC9A01A::writePixel(int16_t x, int16_t y, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::writePixel(x, y, color);
+        return;
+    }
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return;
+    }
+    setAddrWindow(x, y, 1, 1);
+    _queue.pushPixels(&color, 1);
+}
+
+void DmaGC9A01A::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::fillRect(x, y, w, h, color);
+        return;
+    }
+    fillWindow(x, y, w, h, color);
+}
+
+void DmaGC9A01A::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::writeFillRect(x, y, w, h, color);
+        return;
+    }
+    fillWindow(x, y, w, h, color);
+}
+
+void DmaGC9A01A::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::drawFastHLine(x, y, w, color);
+        return;
+    }
+    fillWindow(x, y, w, 1, color);
+}
+
+void DmaGC9A01A::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::writeFastHLine(x, y, w, color);
+        return;
+    }
+    fillWindow(x, y, w, 1, color);
+}
+
+void DmaGC9A01A::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::drawFastVLine(x, y, h, color);
+        return;
+    }
+    fillWindow(x, y, 1, h, color);
+}
+
+void DmaGC9A01A::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (!dmaActive()) {
+        Adafruit_GC9A01A::writeFastVLine(x, y, h, color);
+        return;
+    }
+    fillWindow(x, y, 1, h, color);
+}
+
+#endif
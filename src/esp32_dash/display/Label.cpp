@@ -0,0 +1,127 @@
+#include "esp32_dash/display/widgets/Label.h"
+
+#include <string.h>
+
+#include "esp32_dash/display/AlphaText.h"
+
+Label::Label(int16_t y, uint8_t textSize, uint16_t color, uint16_t backgroundColor,
+             int16_t safeMargin)
+        : _text(),
+          _y(y),
+          _textSize(textSize),
+          _color(color),
+          _backgroundColor(backgroundColor),
+          _safeMargin(safeMargin),
+          _font(nullptr),
+          _drawn{0, 0, 0, 0},
+          _hasDrawn(false) {}
+
+void Label::setText(const char *text) {
+    const char *source = text ? text : "";
+    if (strncmp(_text, source, kCapacity - 1) == 0) {
+        return;
+    }
+    strncpy(_text, source, kCapacity - 1);
+    _text[kCapacity - 1] = '\0';
+    _dirty = true;
+}
+
+void Label::setColor(uint16_t color) {
+    if (color == _color) {
+        return;
+    }
+    _color = color;
+    _dirty = true;
+}
+
+void Label::setFont(const AlphaFont *font) {
+    if (font == _font) {
+        return;
+    }
+    _font = font;
+    _dirty = true;
+}
+
+void Label::invalidate() {
+    // The background was repainted underneath us, so nothing needs erasing.
+    _hasDrawn = false;
+    _dirty = true;
+}
+
+Label::Bounds Label::measure(Adafruit_GC9A01A &display) const {
+    Bounds bounds{0, _y, 0, 0};
+    if (_text[0] == '\0') {
+        return bounds;
+    }
+
+    int16_t x1 = 0, y1 = _y;
+    uint16_t w, h;
+    if (_font) {
+        w = static_cast<uint16_t>(alphaTextWidth(*_font, _text));
+        h = _font->lineHeight;
+    } else {
+        display.getTextBounds(_text, 0, _y, &x1, &y1, &w, &h);
+    }
+
+    int16_t x = (display.width() - static_cast<int16_t>(w)) / 2;
+    const int16_t maxX = display.width() - _safeMargin - static_cast<int16_t>(w);
+    if (x > maxX) {
+        x = maxX;
+    }
+    if (x < _safeMargin) {
+        x = _safeMargin;
+    }
+
+    bounds.x = x;
+    bounds.y = y1;
+    bounds.w = static_cast<int16_t>(w);
+    bounds.h = static_cast<int16_t>(h);
+    return bounds;
+}
+
+void Label::clearUncovered(Adafruit_GC9A01A &display, const Bounds &next) {
+    if (!_hasDrawn || _drawn.w <= 0 || _drawn.h <= 0) {
+        return;
+    }
+
+    const bool sameBand = next.w > 0 && next.y == _drawn.y && next.h == _drawn.h;
+    if (!sameBand) {
+        display.fillRect(_drawn.x, _drawn.y, _drawn.w, _drawn.h, _backgroundColor);
+        return;
+    }
+
+    // Opaque text already overwrote the overlap; only the side strips remain.
+    const int16_t oldRight = _drawn.x + _drawn.w;
+    const int16_t newRight = next.x + next.w;
+    if (_drawn.x < next.x) {
+        const int16_t right = oldRight < next.x ? oldRight : next.x;
+        display.fillRect(_drawn.x, _drawn.y, right - _drawn.x, _drawn.h, _backgroundColor);
+    }
+    if (oldRight > newRight) {
+        const int16_t left = _drawn.x > newRight ? _drawn.x : newRight;
+        display.fillRect(left, _drawn.y, oldRight - left, _drawn.h, _backgroundColor);
+    }
+}
+
+void Label::draw(Adafruit_GC9A01A &display) {
+    if (!_dirty) {
+        return;
+    }
+
+    display.setTextWrap(false);
+    display.setTextSize(_textSize);
+    const Bounds next = measure(display);
+
+    if (next.w > 0 && _font) {
+        drawAlphaText(display, *_font, _text, next.x, _y, _color, _backgroundColor);
+    } else if (next.w > 0) {
+        display.setTextColor(_color, _backgroundColor);
+        display.setCursor(next.x, _y);
+        display.print(_text);
+    }
+    clearUncovered(display, next);
+
+    _drawn = next;
+    _hasDrawn = true;
+    _dirty = false;
+}
@@ -0,0 +1,175 @@
+#include "esp32_dash/display/pages/MultiGaugePage.h"
+
+#include <math.h>
+
+#include "esp32_dash/display/fonts/ReadoutFont.h"
+
+namespace {
+constexpr int16_t kSafeMargin = 24;
+constexpr int16_t kLinkY = kSafeMargin + 4;
+constexpr int16_t kRpmY = kLinkY + 24;
+constexpr int16_t kCaptionY = kRpmY + 44;
+constexpr int16_t kCoolantY = kCaptionY + 26;
+constexpr int16_t kSpeedY = kCoolantY + 34;
+
+// Widest expected text box of each region, times two bytes per pixel.
+constexpr uint32_t kRpmCostBytes = 128u * 40u * 2u;       // "8888" in the readout font
+constexpr uint32_t kSpeedCostBytes = 144u * 24u * 2u;     // "188 km/h" at size 3
+constexpr uint32_t kCoolantCostBytes = 90u * 24u * 2u;    // "105 C" at size 3
+constexpr uint32_t kLinkCostBytes = 84u * 16u * 2u;       // "NO LINK" at size 2
+
+constexpr float kRpmTweenMs = 120.0f;
+constexpr float kRpmSettleEpsilon = 1.0f;
+
+constexpr uint16_t kBackgroundColor = 0x0000;
+constexpr uint16_t kRpmColor = 0xF800;
+constexpr uint16_t kCaptionColor = 0x8410;
+constexpr uint16_t kCoolantColor = 0x07E0;
+constexpr uint16_t kSpeedColor = 0xFFFF;
+constexpr uint16_t kLinkUpColor = 0x07FF;
+constexpr uint16_t kLinkDownColor = 0x8410;
+}
+
+MultiGaugePage::MultiGaugePage(const Config &config)
+        : _config(config),
+          _rpmTween({.timeConstantMs = kRpmTweenMs, .settleEpsilon = kRpmSettleEpsilon}),
+          _linkLabel(kLinkY, 2, kLinkDownColor, kBackgroundColor, kSafeMargin),
+          _rpmValue(kRpmY, 6, kRpmColor, kBackgroundColor),
+          _rpmCaption(kCaptionY, 2, kCaptionColor, kBackgroundColor, kSafeMargin),
+          _coolantValue(kCoolantY, 3, kCoolantColor, kBackgroundColor, " C"),
+          _speedValue(kSpeedY, 3, kSpeedColor, kBackgroundColor, " km/h"),
+          _regions{
+                  {&_rpmValue, config.rpmIntervalMs, kRpmCostBytes, 0, false, false},
+                  {&_speedValue, config.speedIntervalMs, kSpeedCostBytes, 0, false, false},
+                  {&_coolantValue, config.coolantIntervalMs, kCoolantCostBytes, 0, false, false},
+                  {&_linkLabel, config.linkIntervalMs, kLinkCostBytes, 0, false, false},
+          },
+          _lastFrameBytes(0),
+          _deferredRegions(0),
+          _linkConnected(false),
+          _layoutDirty(true) {
+    _linkLabel.setText("NO LINK");
+    _rpmValue.setFont(&fonts::kReadout);
+    _rpmValue.setValue(0.0f);
+    _rpmCaption.setText("rpm");
+    _coolantValue.setText("-- C");
+    _speedValue.setValue(0.0f);
+}
+
+void MultiGaugePage::setRpm(float rpm) {
+    _rpmTween.setTarget(rpm, millis());
+    if (_rpmTween.isSettled()) {
+        _rpmValue.setValue(_rpmTween.value());
+    }
+}
+
+void MultiGaugePage::setCoolantTemp(float tempC) {
+    if (isnan(tempC)) {
+        return;
+    }
+    _coolantValue.setValue(tempC);
+}
+
+void MultiGaugePage::setSpeed(float kmh) {
+    _speedValue.setValue(kmh);
+}
+
+void MultiGaugePage::setLinkConnected(bool connected) {
+    if (connected == _linkConnected) {
+        return;
+    }
+    _linkConnected = connected;
+    _linkLabel.setText(connected ? "LINK" : "NO LINK");
+    _linkLabel.setColor(connected ? kLinkUpColor : kLinkDownColor);
+}
+
+void MultiGaugePage::onEnter(Adafruit_GC9A01A &display) {
+    (void) display;
+    _layoutDirty = true;
+}
+
+bool MultiGaugePage::isDue(const Region &region, uint32_t nowMs) const {
+    if (!region.widget->isDirty()) {
+        return false;
+    }
+    return !region.drawn || region.carried || (nowMs - region.drawnAtMs) >= region.intervalMs;
+}
+
+bool MultiGaugePage::tick(uint32_t nowMs) {
+    if (_rpmTween.step(nowMs)) {
+        _rpmValue.setValue(_rpmTween.value());
+    }
+    if (_layoutDirty) {
+        return true;
+    }
+    for (const Region &region : _regions) {
+        if (isDue(region, nowMs)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MultiGaugePage::drawRegion(Region &region, Adafruit_GC9A01A &display, uint32_t nowMs, uint32_t &spent) {
+    if (spent > 0 && spent + region.costBytes > _config.frameBudgetBytes) {
+        region.carried = true;
+        return false;
+    }
+    region.widget->draw(display);
+    region.drawnAtMs = nowMs;
+    region.drawn = true;
+    region.carried = false;
+    spent += region.costBytes;
+    return true;
+}
+
+void MultiGaugePage::render(Adafruit_GC9A01A &display) {
+    const uint32_t now = millis();
+    uint32_t spent = 0;
+    _deferredRegions = 0;
+
+    if (_layoutDirty) {
+        // A full repaint costs a screen of traffic regardless; draw everything.
+        display.fillScreen(kBackgroundColor);
+        _rpmCaption.invalidate();
+        _rpmCaption.draw(display);
+        for (Region &region : _regions) {
+            region.widget->invalidate();
+            region.widget->draw(display);
+            region.drawnAtMs = now;
+            region.drawn = true;
+            region.carried = false;
+        }
+        _layoutDirty = false;
+        _lastFrameBytes = 0;
+        return;
+    }
+
+    // RPM goes first whenever it is due, so a carried region can never push
+    // it out of the frame. Regions pushed back last frame come next so the
+    // slower ones wait at most one frame, then the rest in priority order.
+    Region &rpm = _regions[0];
+    if (isDue(rpm, now)) {
+        drawRegion(rpm, display, now, spent);
+    }
+    for (size_t i = 1; i < kRegionCount; ++i) {
+        Region &region = _regions[i];
+        if (region.carried && region.widget->isDirty()) {
+            drawRegion(region, display, now, spent);
+        } else {
+            region.carried = false;
+        }
+    }
+    for (size_t i = 1; i < kRegionCount; ++i) {
+        Region &region = _regions[i];
+        if (region.carried || !isDue(region, now)) {
+            continue;
+        }
+        drawRegion(region, display, now, spent);
+    }
+
+    for (const Region &region : _regions) {
+        _deferredRegions += region.carried ? 1 : 0;
+    }
+    _lastFrameBytes = spent;
+}
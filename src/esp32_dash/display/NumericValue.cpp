@@ -0,0 +1,23 @@
+#include "esp32_dash/display/widgets/NumericValue.h"
+
+#include <stdio.h>
+
+NumericValue::NumericValue(int16_t y, uint8_t textSize, uint16_t color, uint16_t backgroundColor,
+                           const char *suffix)
+        : Label(y, textSize, color, backgroundColor),
+          _suffix(suffix ? suffix : ""),
+          _value(0),
+          _hasValue(false) {}
+
+void NumericValue::setValue(float value) {
+    const int32_t rounded = static_cast<int32_t>(value);
+    if (_hasValue && rounded == _value) {
+        return;
+    }
+    _value = rounded;
+    _hasValue = true;
+
+    char text[kCapacity];
+    snprintf(text, sizeof(text), "%ld%s", static_cast<long>(rounded), _suffix);
+    setText(text);
+}
@@ -0,0 +1,133 @@
+#include "esp32_dash/display/PageRotation.h"
+
+#include <math.h>
+
+namespace {
+constexpr size_t kNoPage = static_cast<size_t>(-1);
+}
+
+PageRotation::PageRotation(const Config &config)
+        : _config(config),
+          _slots(),
+          _count(0),
+          _shownPage(kNoPage),
+          _shownAtMs(0),
+          _userInputAtMs(0),
+          _dueSinceMs(0),
+          _userInput(false),
+          _due(false),
+          _enabled(true) {}
+
+void PageRotation::addPage(size_t pageIndex, float changeThreshold) {
+    if (_count >= kMaxPages || find(pageIndex)) {
+        return;
+    }
+    _slots[_count++] = Slot{pageIndex, changeThreshold, 0.0f, 0, 0, false, false};
+}
+
+PageRotation::Slot *PageRotation::find(size_t pageIndex) {
+    for (size_t i = 0; i < _count; ++i) {
+        if (_slots[i].page == pageIndex) {
+            return &_slots[i];
+        }
+    }
+    return nullptr;
+}
+
+void PageRotation::noteValue(size_t pageIndex, float value, uint32_t nowMs) {
+    Slot *slot = find(pageIndex);
+    if (!slot) {
+        return;
+    }
+    if (slot->sampled && fabsf(value - slot->lastValue) >= slot->changeThreshold) {
+        slot->changedAtMs = nowMs;
+        slot->lastValue = value;
+    } else if (!slot->sampled) {
+        slot->lastValue = value;
+    }
+    slot->sampledAtMs = nowMs;
+    slot->sampled = true;
+}
+
+void PageRotation::setAlarming(size_t pageIndex, bool alarming) {
+    if (Slot *slot = find(pageIndex)) {
+        slot->alarming = alarming;
+    }
+}
+
+void PageRotation::noteUserInput(uint32_t nowMs) {
+    _userInput = true;
+    _userInputAtMs = nowMs;
+}
+
+bool PageRotation::isFresh(const Slot &slot, uint32_t nowMs) const {
+    return slot.sampled && (nowMs - slot.sampledAtMs) < _config.staleAfterMs;
+}
+
+bool PageRotation::shouldHold(const Slot &slot, uint32_t nowMs) const {
+    if (slot.alarming) {
+        return true;
+    }
+    const uint32_t shownFor = nowMs - _shownAtMs;
+    const bool moving = slot.changedAtMs != 0 && (nowMs - slot.changedAtMs) < _config.settleMs;
+    return moving && shownFor < _config.maxDwellMs;
+}
+
+bool PageRotation::pickNext(size_t currentPage, uint32_t nowMs, size_t &next) const {
+    size_t start = 0;
+    for (size_t i = 0; i < _count; ++i) {
+        if (_slots[i].page == currentPage) {
+            start = i + 1;
+            break;
+        }
+    }
+    for (size_t step = 0; step < _count; ++step) {
+        const Slot &candidate = _slots[(start + step) % _count];
+        if (candidate.page != currentPage && isFresh(candidate, nowMs)) {
+            next = candidate.page;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PageRotation::poll(size_t currentPage, uint32_t nowMs, bool frameDue, size_t &next) {
+    if (currentPage != _shownPage) {
+        // Someone else switched pages; its dwell starts now.
+        _shownPage = currentPage;
+        _shownAtMs = nowMs;
+        _due = false;
+    }
+    if (!_enabled || _count == 0) {
+        return false;
+    }
+    if (_userInput && (nowMs - _userInputAtMs) < _config.userPauseMs) {
+        _due = false;
+        return false;
+    }
+    _userInput = false;
+
+    if ((nowMs - _shownAtMs) < _config.dwellMs) {
+        return false;
+    }
+    // Pages outside the rotation stay until the user leaves them.
+    const Slot *current = find(currentPage);
+    size_t candidate = currentPage;
+    if (!current || shouldHold(*current, nowMs) || !pickNext(currentPage, nowMs, candidate)) {
+        _due = false;
+        return false;
+    }
+
+    if (!_due) {
+        _due = true;
+        _dueSinceMs = nowMs;
+    }
+    if (!frameDue && (nowMs - _dueSinceMs) < _config.maxSwitchDelayMs) {
+        return false;
+    }
+    _due = false;
+    _shownPage = candidate;
+    _shownAtMs = nowMs;
+    next = candidate;
+    return true;
+}
@@ -0,0 +1,141 @@
+#include "esp32_dash/display/RleImage.h"
+
+#include "esp32_dash/display/DmaGC9A01A.h"
+
+namespace {
+constexpr uint16_t kMaxLinePixels = 240;
+constexpr uint8_t kRunFlag = 0x80;
+}
+
+RleDecoder::RleDecoder(const RleImage &image)
+        : _image(image),
+          _position(0),
+          _remaining(0),
+          _isRun(false),
+          _runColor(0) {}
+
+uint16_t RleDecoder::readValue() {
+    if (_image.palette) {
+        if (_position >= _image.dataSize) {
+            return 0;
+        }
+        const uint8_t index = _image.data[_position++];
+        return index < _image.paletteSize ? _image.palette[index] : 0;
+    }
+    if (_position + 1 >= _image.dataSize) {
+        _position = _image.dataSize;
+        return 0;
+    }
+    const uint16_t color = static_cast<uint16_t>(_image.data[_position] |
+                                                 (_image.data[_position + 1] << 8));
+    _position += 2;
+    return color;
+}
+
+size_t RleDecoder::read(uint16_t *out, size_t count) {
+    size_t produced = 0;
+    while (produced < count) {
+        if (_remaining == 0) {
+            if (_position >= _image.dataSize) {
+                break;
+            }
+            const uint8_t header = _image.data[_position++];
+            _isRun = (header & kRunFlag) != 0;
+            _remaining = static_cast<uint8_t>((header & ~kRunFlag) + 1);
+            if (_isRun) {
+                _runColor = readValue();
+            }
+        }
+
+        if (_isRun) {
+            size_t span = count - produced;
+            if (span > _remaining) {
+                span = _remaining;
+            }
+            for (size_t i = 0; i < span; ++i) {
+                out[produced++] = _runColor;
+            }
+            _remaining = static_cast<uint8_t>(_remaining - span);
+        } else {
+            out[produced++] = readValue();
+            --_remaining;
+        }
+    }
+    return produced;
+}
+
+RleEncoder::RleEncoder(std::vector<uint8_t> &out)
+        : _out(out),
+          _pending(),
+          _pendingCount(0),
+          _runColor(0),
+          _runLength(0) {}
+
+void RleEncoder::emitValue(uint16_t color) {
+    _out.push_back(static_cast<uint8_t>(color & 0xFF));
+    _out.push_back(static_cast<uint8_t>(color >> 8));
+}
+
+void RleEncoder::flushLiteral(size_t count) {
+    if (count == 0) {
+        return;
+    }
+    _out.push_back(static_cast<uint8_t>(count - 1));
+    for (size_t i = 0; i < count; ++i) {
+        emitValue(_pending[i]);
+    }
+    _pendingCount = 0;
+}
+
+void RleEncoder::emitRun() {
+    if (_runLength == 0) {
+        return;
+    }
+    if (_runLength == 1) {
+        // A lone pixel is cheaper as part of a literal.
+        if (_pendingCount == kMaxToken) {
+            flushLiteral(_pendingCount);
+        }
+        _pending[_pendingCount++] = _runColor;
+    } else {
+        flushLiteral(_pendingCount);
+        _out.push_back(static_cast<uint8_t>(kRunFlag | (_runLength - 1)));
+        emitValue(_runColor);
+    }
+    _runLength = 0;
+}
+
+void RleEncoder::push(uint16_t color) {
+    if (_runLength > 0 && color == _runColor && _runLength < kMaxToken) {
+        ++_runLength;
+        return;
+    }
+    emitRun();
+    _runColor = color;
+    _runLength = 1;
+}
+
+void RleEncoder::finish() {
+    emitRun();
+    flushLiteral(_pendingCount);
+}
+
+void drawRleImage(Adafruit_GC9A01A &display, const RleImage &image, int16_t x, int16_t y) {
+    if (image.width == 0 || image.width > kMaxLinePixels || x < 0 || y < 0 ||
+        x + image.width > display.width() || y + image.height > display.height()) {
+        return;
+    }
+
+    uint16_t line[kMaxLinePixels];
+    RleDecoder decoder(image);
+    display.startWrite();
+    display.setAddrWindow(x, y, image.width, image.height);
+    for (uint16_t row = 0; row < image.height; ++row) {
+        const size_t produced = decoder.read(line, image.width);
+        for (size_t i = produced; i < image.width; ++i) {
+            line[i] = 0;  // truncated asset: pad rather than desync the window
+        }
+        writePixelBlock(display, line, image.width);
+    }
+    display.endWrite();
+}
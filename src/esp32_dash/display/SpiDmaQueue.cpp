@@ -0,0 +1,180 @@
+#include "esp32_dash/display/SpiDmaQueue.h"
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(UNIT_TEST)
+#include <string.h>
+
+namespace {
+constexpr uint8_t kColumnAddressSet = 0x2A;
+constexpr uint8_t kPageAddressSet = 0x2B;
+constexpr uint8_t kMemoryWrite = 0x2C;
+
+// The panel takes RGB565 big-endian.
+inline uint16_t toWire(uint16_t color) {
+    return static_cast<uint16_t>((color << 8) | (color >> 8));
+}
+}
+
+void SpiDmaQueue::attach(spi_device_handle_t device, int8_t dcPin, uint16_t *const (&buffers)[2],
+                         uint16_t linePixels) {
+    _device = device;
+    _dcPin = dcPin;
+    _buffers[0] = buffers[0];
+    _buffers[1] = buffers[1];
+    _linePixels = linePixels;
+    _bufferUsers[0] = 0;
+    _bufferUsers[1] = 0;
+    _nextBuffer = 0;
+    _head = 0;
+    _inFlight = 0;
+    _polling = false;
+    _windowX0 = _windowX1 = _windowY0 = _windowY1 = 0xFFFF;
+}
+
+void SpiDmaQueue::detach() {
+    if (!_device) {
+        return;
+    }
+    flush();
+    _device = nullptr;
+}
+
+void SpiDmaQueue::prepare(uint32_t pixels) {
+    const bool polling = _mode == SpiTransferMode::Polling ||
+                         (_mode == SpiTransferMode::Auto && pixels < kPollingPixels);
+    if (polling && !_polling) {
+        flush();
+    }
+    _polling = polling;
+}
+
+void SpiDmaQueue::flush() {
+    while (_inFlight > 0) {
+        reapOne();
+    }
+}
+
+void SpiDmaQueue::send(bool data, const void *bytes, size_t length, int8_t buffer) {
+    spi_transaction_t polled;
+    spi_transaction_t *transaction = &polled;
+    if (!_polling) {
+        if (_inFlight == kQueueDepth) {
+            reapOne();
+        }
+        Slot &slot = _slots[_head];
+        _head = static_cast<uint8_t>((_head + 1) % kQueueDepth);
+        slot.buffer = buffer;
+        transaction = &slot.transaction;
+    }
+
+    *transaction = {};
+    transaction->length = length * 8;
+    // Carries (dcPin << 1) | level for the driver's pre-transfer callback.
+    transaction->user = reinterpret_cast<void *>((static_cast<uintptr_t>(_dcPin) << 1) | (data ? 1 : 0));
+    if (buffer == kNoBuffer) {
+        // Commands, parameters and single pixels fit in the transaction itself.
+        transaction->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(transaction->tx_data, bytes, length);
+    } else {
+        transaction->tx_buffer = bytes;
+    }
+
+    if (_polling) {
+        spi_device_polling_transmit(_device, transaction);
+        ++_polled;
+        return;
+    }
+    if (buffer != kNoBuffer) {
+        ++_bufferUsers[buffer];
+    }
+    spi_device_queue_trans(_device, transaction, portMAX_DELAY);
+    ++_inFlight;
+    ++_queued;
+}
+
+void SpiDmaQueue::reapOne() {
+    spi_transaction_t *done = nullptr;
+    spi_device_get_trans_result(_device, &done, portMAX_DELAY);
+    // Transactions complete in queue order, so the oldest slot is the one done.
+    const Slot &slot = _slots[(_head + kQueueDepth - _inFlight) % kQueueDepth];
+    if (slot.buffer != kNoBuffer) {
+        --_bufferUsers[slot.buffer];
+    }
+    --_inFlight;
+}
+
+uint16_t *SpiDmaQueue::acquireBuffer(int8_t &index) {
+    index = static_cast<int8_t>(_nextBuffer);
+    _nextBuffer ^= 1;
+    while (_bufferUsers[index] > 0) {
+        reapOne();
+    }
+    return _buffers[index];
+}
+
+void SpiDmaQueue::command(uint8_t command, const uint8_t *data, uint8_t length) {
+    send(false, &command, 1, kNoBuffer);
+    for (uint8_t offset = 0; offset < length; offset += 4) {
+        const uint8_t chunk = length - offset < 4 ? length - offset : 4;
+        send(true, data + offset, chunk, kNoBuffer);
+    }
+}
+
+void SpiDmaQueue::setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (x0 != _windowX0 || x1 != _windowX1) {
+        const uint8_t columns[4] = {uint8_t(x0 >> 8), uint8_t(x0), uint8_t(x1 >> 8), uint8_t(x1)};
+        command(kColumnAddressSet, columns, sizeof(columns));
+        _windowX0 = x0;
+        _windowX1 = x1;
+    }
+    if (y0 != _windowY0 || y1 != _windowY1) {
+        const uint8_t rows[4] = {uint8_t(y0 >> 8), uint8_t(y0), uint8_t(y1 >> 8), uint8_t(y1)};
+        command(kPageAddressSet, rows, sizeof(rows));
+        _windowY0 = y0;
+        _windowY1 = y1;
+    }
+    command(kMemoryWrite);
+}
+
+void SpiDmaQueue::pushPixels(const uint16_t *pixels, uint32_t count) {
+    if (count == 1) {
+        const uint16_t wire = toWire(*pixels);
+        send(true, &wire, sizeof(wire), kNoBuffer);
+        return;
+    }
+    while (count > 0) {
+        int8_t index;
+        uint16_t *buffer = acquireBuffer(index);
+        const uint32_t chunk = count < _linePixels ? count : _linePixels;
+        for (uint32_t i = 0; i < chunk; ++i) {
+            buffer[i] = toWire(pixels[i]);
+        }
+        send(true, buffer, chunk * sizeof(uint16_t), index);
+        pixels += chunk;
+        count -= chunk;
+    }
+}
+
+void SpiDmaQueue::fill(uint16_t color, uint32_t count) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1) {
+        pushPixels(&color, 1);
+        return;
+    }
+    // A solid fill needs one buffer's worth of colour; every chunk reuses it.
+    int8_t index;
+    uint16_t *buffer = acquireBuffer(index);
+    const uint32_t filled = count < _linePixels ? count : _linePixels;
+    const uint16_t wire = toWire(color);
+    for (uint32_t i = 0; i < filled; ++i) {
+        buffer[i] = wire;
+    }
+    while (count > 0) {
+        const uint32_t chunk = count < filled ? count : filled;
+        send(true, buffer, chunk * sizeof(uint16_t), index);
+        count -= chunk;
+    }
+}
+
+#endif
@@ -0,0 +1,187 @@
+#include "esp32_dash/display/StaticLayerCache.h"
+
+#include <memory>
+
+namespace {
+// 48 KB holds a handful of mostly-black gauge faces; one 16-row band of
+// scratch is ~7.5 KB and only lives while a layer is being captured.
+constexpr uint32_t kDefaultBudgetBytes = 48 * 1024;
+constexpr uint16_t kDefaultBandRows = 16;
+
+// GFX surface covering rows [top, top + rows) of a full-size layer. Drawing
+// outside the band is clipped, so the same draw code can be replayed once
+// per band.
+class BandCanvas : public Adafruit_GFX {
+public:
+    BandCanvas(int16_t width, int16_t height, uint16_t rows)
+            : Adafruit_GFX(width, height),
+              _rows(rows),
+              _top(0),
+              _pixels(new uint16_t[static_cast<size_t>(width) * rows]) {}
+
+    void setTop(int16_t top) { _top = top; }
+    const uint16_t *row(uint16_t index) const { return _pixels.get() + static_cast<size_t>(index) * _width; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x < 0 || x >= _width || y < _top || y >= _top + _rows || y >= _height) {
+            return;
+        }
+        _pixels[static_cast<size_t>(y - _top) * _width + x] = color;
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        int16_t x0 = x < 0 ? 0 : x;
+        int16_t x1 = x + w > _width ? _width : static_cast<int16_t>(x + w);
+        int16_t y0 = y < _top ? _top : y;
+        int16_t y1 = y + h > _top + _rows ? static_cast<int16_t>(_top + _rows) : static_cast<int16_t>(y + h);
+        for (int16_t row = y0; row < y1; ++row) {
+            uint16_t *line = _pixels.get() + static_cast<size_t>(row - _top) * _width;
+            for (int16_t col = x0; col < x1; ++col) {
+                line[col] = color;
+            }
+        }
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+    void fillScreen(uint16_t color) override { fillRect(0, _top, _width, static_cast<int16_t>(_rows), color); }
+
+private:
+    uint16_t _rows;
+    int16_t _top;
+    std::unique_ptr<uint16_t[]> _pixels;
+};
+}
+
+StaticLayerCache::StaticLayerCache(const Config &config)
+        : _config(config),
+          _entries(),
+          _bytesUsed(0),
+          _useClock(0),
+          _hits(0),
+          _misses(0) {}
+
+StaticLayerCache::Entry *StaticLayerCache::find(const void *owner) {
+    for (Entry &entry : _entries) {
+        if (entry.owner == owner) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void StaticLayerCache::release(Entry &entry) {
+    _bytesUsed -= static_cast<uint32_t>(entry.data.size());
+    entry.owner = nullptr;
+    std::vector<uint8_t>().swap(entry.data);
+}
+
+StaticLayerCache::Entry *StaticLayerCache::makeRoom(uint32_t bytes) {
+    while (true) {
+        Entry *freeSlot = nullptr;
+        Entry *oldest = nullptr;
+        for (Entry &entry : _entries) {
+            if (!entry.owner) {
+                freeSlot = freeSlot ? freeSlot : &entry;
+            } else if (!oldest || entry.lastUsed < oldest->lastUsed) {
+                oldest = &entry;
+            }
+        }
+        if (freeSlot && _bytesUsed + bytes <= _config.budgetBytes) {
+            return freeSlot;
+        }
+        if (!oldest) {
+            return nullptr;
+        }
+        release(*oldest);
+    }
+}
+
+void StaticLayerCache::blit(Entry &entry, Adafruit_GC9A01A &display) {
+    const RleImage image = {
+            static_cast<uint16_t>(display.width()),
+            static_cast<uint16_t>(display.height()),
+            nullptr,
+            0,
+            entry.data.data(),
+            static_cast<uint32_t>(entry.data.size()),
+    };
+    drawRleImage(display, image, 0, 0);
+    entry.lastUsed = ++_useClock;
+}
+
+bool StaticLayerCache::restore(const void *owner, Adafruit_GC9A01A &display) {
+    Entry *entry = find(owner);
+    if (!entry) {
+        return false;
+    }
+    ++_hits;
+    blit(*entry, display);
+    return true;
+}
+
+bool StaticLayerCache::capture(const void *owner, Adafruit_GC9A01A &display, DrawFn draw, void *context) {
+    ++_misses;
+    invalidate(owner);
+
+    const int16_t width = display.width();
+    const int16_t height = display.height();
+    std::vector<uint8_t> data;
+    {
+        BandCanvas band(width, height, _config.bandRows);
+        RleEncoder encoder(data);
+        for (int16_t top = 0; top < height; top = static_cast<int16_t>(top + _config.bandRows)) {
+            band.setTop(top);
+            band.fillScreen(0x0000);
+            draw(context, band);
+            for (uint16_t row = 0; row < _config.bandRows && top + row < height; ++row) {
+                const uint16_t *pixels = band.row(row);
+                for (int16_t x = 0; x < width; ++x) {
+                    encoder.push(pixels[x]);
+                }
+            }
+        }
+        encoder.finish();
+    }
+
+    const uint32_t bytes = static_cast<uint32_t>(data.size());
+    Entry *slot = bytes <= _config.budgetBytes ? makeRoom(bytes) : nullptr;
+    if (!slot) {
+        return false;
+    }
+    data.shrink_to_fit();
+    slot->owner = owner;
+    slot->data.swap(data);
+    _bytesUsed += bytes;
+    blit(*slot, display);
+    return true;
+}
+
+void StaticLayerCache::invalidate(const void *owner) {
+    if (Entry *entry = find(owner)) {
+        release(*entry);
+    }
+}
+
+void StaticLayerCache::clear() {
+    for (Entry &entry : _entries) {
+        if (entry.owner) {
+            release(entry);
+        }
+    }
+}
+
+size_t StaticLayerCache::entryCount() const {
+    size_t count = 0;
+    for (const Entry &entry : _entries) {
+        if (entry.owner) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+StaticLayerCache &staticLayerCache() {
+    static StaticLayerCache cache({.budgetBytes = kDefaultBudgetBytes, .bandRows = kDefaultBandRows});
+    return cache;
+}
@@ -1,24 +1,25 @@
 #include "esp32_dash/display/pages/StaticTextPage.h"
 
+#include <string.h>
 #include <utility>
-#include <vector>
 
 namespace {
 constexpr int16_t kCircularSafeMargin = 30;
 constexpr int16_t kBodyLineSpacing = 28;
+constexpr size_t kMaxLineLength = 31;  // longer lines are cut, they would not fit anyway
 
 void drawCenteredText(Adafruit_GC9A01A &display,
-                      const String &text,
+                      const char *text,
                       int16_t y,
                       uint8_t textSize) {
-    if (text.isEmpty()) {
+    if (!text || text[0] == '\0') {
         return;
     }
 
     int16_t x1, y1;
     uint16_t w, h;
     display.setTextSize(textSize);
-    display.getTextBounds(text.c_str(), 0, y, &x1, &y1, &w, &h);
+    display.getTextBounds(text, 0, y, &x1, &y1, &w, &h);
 
     const int16_t centeredX = (display.width() - static_cast<int16_t>(w)) / 2;
     int16_t x = centeredX;
@@ -36,20 +37,17 @@ void drawCenteredText(Adafruit_GC9A01A &display,
     display.print(text);
 }
 
-std::vector<String> splitLines(const String &text) {
-    std::vector<String> lines;
-    int32_t start = 0;
-    while (start < text.length()) {
-        const int32_t end = text.indexOf('\n', start);
-        if (end == -1) {
-            lines.emplace_back(text.substring(start));
-            break;
-        }
-        lines.emplace_back(text.substring(start, end));
-        start = end + 1;
+// Counts '\n'-separated lines the same way the render loop walks them: a
+// trailing newline does not start another line.
+int16_t countLines(const char *text) {
+    if (!text || text[0] == '\0') {
+        return 0;
     }
-    if (lines.empty() && !text.isEmpty()) {
-        lines.emplace_back(text);
+    int16_t lines = 1;
+    for (const char *p = text; *p; ++p) {
+        if (*p == '\n' && p[1] != '\0') {
+            lines++;
+        }
     }
     return lines;
 }
@@ -78,15 +76,16 @@ void StaticTextPage::render(Adafruit_GC9A01A &display) {
 
     display.setTextWrap(false);
     display.setTextColor(_titleColor);
-    drawCenteredText(display, _title, kCircularSafeMargin + 10, 3);
+    drawCenteredText(display, _title.c_str(), kCircularSafeMargin + 10, 3);
 
     display.setTextColor(_bodyColor);
-    const auto lines = splitLines(_body);
-    if (lines.empty()) {
+    const char *body = _body.c_str();
+    const int16_t lineCount = countLines(body);
+    if (lineCount == 0) {
         return;
     }
 
-    const int16_t totalHeight = static_cast<int16_t>(lines.size()) * kBodyLineSpacing;
+    const int16_t totalHeight = lineCount * kBodyLineSpacing;
     int16_t startY = (display.height() / 2) - (totalHeight / 2);
     const int16_t minStartY = kCircularSafeMargin + 50;
     if (startY < minStartY) {
@@ -97,8 +96,17 @@ void StaticTextPage::render(Adafruit_GC9A01A &display) {
         startY = maxStartY;
     }
 
-    for (const auto &line : lines) {
+    // Walk the body in place, one line at a time through a stack buffer.
+    char line[kMaxLineLength + 1];
+    const char *start = body;
+    for (int16_t i = 0; i < lineCount; ++i) {
+        const char *end = strchr(start, '\n');
+        const size_t length = end ? static_cast<size_t>(end - start) : strlen(start);
+        const size_t copied = length < kMaxLineLength ? length : kMaxLineLength;
+        memcpy(line, start, copied);
+        line[copied] = '\0';
         drawCenteredText(display, line, startY, 2);
         startY += kBodyLineSpacing;
+        start = end ? end + 1 : start + length;
     }
 }
@@ -0,0 +1,127 @@
+#include "esp32_dash/display/pages/SweepTachPage.h"
+
+#include <stdio.h>
+
+#include "esp32_dash/display/StaticLayerCache.h"
+#include "esp32_dash/util/TrigTable.h"
+
+namespace {
+constexpr int16_t kCenter = 120;
+constexpr int16_t kStartDeg = -135;
+constexpr int16_t kSweepDeg = 270;
+
+constexpr int16_t kTickOuterRadius = 117;
+constexpr int16_t kMajorTickInnerRadius = 104;
+constexpr int16_t kMinorTickInnerRadius = 110;
+constexpr int16_t kRedlineInnerRadius = 108;
+constexpr int16_t kSweepOuterRadius = 100;
+constexpr int16_t kSweepInnerRadius = 86;
+constexpr int16_t kNumeralRadius = 72;
+constexpr float kMinorTickRpm = 500.0f;
+
+// Fed per-pulse RPM, so only a short follow to smooth pulse jitter.
+constexpr float kRpmTweenMs = 60.0f;
+constexpr float kRpmSettleEpsilon = 1.0f;
+
+constexpr uint16_t kBackgroundColor = 0x0000;
+constexpr uint16_t kTickColor = 0xFFFF;
+constexpr uint16_t kRedlineColor = 0xF800;
+constexpr uint16_t kSweepColor = 0xFD20;
+constexpr uint16_t kTrackColor = 0x18C3;
+constexpr uint16_t kReadoutColor = 0xFFFF;
+constexpr uint16_t kUnitColor = 0x8410;
+}
+
+SweepTachPage::SweepTachPage(const Config &config)
+        : _config(config),
+          _rpm(0.0f),
+          _rpmTween({.timeConstantMs = kRpmTweenMs, .settleEpsilon = kRpmSettleEpsilon}),
+          _sweep(kCenter, kCenter, kSweepInnerRadius, kSweepOuterRadius, kStartDeg, kSweepDeg,
+                 0.0f, config.maxRpm, kSweepColor, kTrackColor),
+          _readout(kCenter - 16, 4, kReadoutColor, kBackgroundColor),
+          _unitLabel(kCenter + 22, 2, kUnitColor, kBackgroundColor),
+          _layoutDirty(true) {
+    _readout.setValue(0.0f);
+    _unitLabel.setText("rpm");
+}
+
+void SweepTachPage::setRpm(float rpm) {
+    _rpm = rpm;
+    _rpmTween.setTarget(rpm, millis());
+    if (_rpmTween.isSettled()) {
+        _sweep.setValue(rpm);
+        _readout.setValue(rpm);
+    }
+}
+
+bool SweepTachPage::needsRender() const {
+    return _layoutDirty || _sweep.isDirty() || _readout.isDirty();
+}
+
+bool SweepTachPage::tick(uint32_t nowMs) {
+    if (_rpmTween.step(nowMs)) {
+        _sweep.setValue(_rpmTween.value());
+        _readout.setValue(_rpmTween.value());
+    }
+    return needsRender();
+}
+
+void SweepTachPage::onEnter(Adafruit_GC9A01A &display) {
+    (void) display;
+    _layoutDirty = true;
+}
+
+int16_t SweepTachPage::degreesFor(float rpm) const {
+    return static_cast<int16_t>(kStartDeg + rpm * kSweepDeg / _config.maxRpm + 0.5f);
+}
+
+void SweepTachPage::drawDial(Adafruit_GFX &gfx) const {
+    gfx.fillScreen(kBackgroundColor);
+
+    // Redline band sits behind the outer ends of the ticks.
+    Arc::fillRing(gfx, kCenter, kCenter, kRedlineInnerRadius, kTickOuterRadius,
+                  degreesFor(_config.redlineRpm), kStartDeg + kSweepDeg, kRedlineColor);
+
+    gfx.setTextWrap(false);
+    gfx.setTextSize(2);
+    gfx.setTextColor(kTickColor, kBackgroundColor);
+
+    int numeral = 0;
+    for (float rpm = 0.0f; rpm <= _config.maxRpm; rpm += kMinorTickRpm) {
+        const bool major = static_cast<int>(rpm) % 1000 == 0;
+        const int16_t degrees = degreesFor(rpm);
+        int16_t x0, y0, x1, y1;
+        trig::polarToScreen(kCenter, kCenter, major ? kMajorTickInnerRadius : kMinorTickInnerRadius,
+                            degrees, x0, y0);
+        trig::polarToScreen(kCenter, kCenter, kTickOuterRadius, degrees, x1, y1);
+        gfx.drawLine(x0, y0, x1, y1, kTickColor);
+
+        if (major) {
+            char text[3];
+            snprintf(text, sizeof(text), "%d", numeral++);
+            int16_t nx, ny;
+            trig::polarToScreen(kCenter, kCenter, kNumeralRadius, degrees, nx, ny);
+            // Centre the 12x16 glyph cell on the numeral position.
+            gfx.setCursor(static_cast<int16_t>(nx - 6), static_cast<int16_t>(ny - 8));
+            gfx.print(text);
+        }
+    }
+}
+
+void SweepTachPage::render(Adafruit_GC9A01A &display) {
+    if (_layoutDirty) {
+        const bool restored = staticLayerCache().restoreOrCapture(
+                this, display, [this](Adafruit_GFX &gfx) { drawDial(gfx); });
+        if (!restored) {
+            drawDial(display);
+        }
+        _sweep.invalidate();
+        _readout.invalidate();
+        _unitLabel.invalidate();
+        _layoutDirty = false;
+    }
+
+    _sweep.draw(display);
+    _readout.draw(display);
+    _unitLabel.draw(display);
+}
@@ -1,88 +1,56 @@
 #include "esp32_dash/display/pages/TachPage.h"
 
+#include <string.h>
+
+#include "esp32_dash/display/fonts/ReadoutFont.h"
+
 namespace {
+constexpr int16_t kPanelSize = 240;
 constexpr int16_t kSafeMargin = 24;
 constexpr int16_t kTitleY = kSafeMargin + 8;
-constexpr int16_t kStatusYOffset = 30;
-
-void clearTextBand(Adafruit_GC9A01A &display,
-                   int16_t y,
-                   uint8_t textSize,
-                   uint16_t backgroundColor) {
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.setTextSize(textSize);
-    display.getTextBounds("88", 0, y, &x1, &y1, &w, &h);
+constexpr int16_t kRpmY = (kPanelSize / 2) - 30;
+constexpr int16_t kStatusY = kPanelSize - kSafeMargin - 30;
 
-    int16_t top = y1;
-    int16_t height = static_cast<int16_t>(h);
-    if (top < 0) {
-        height += top;
-        top = 0;
-    }
-    if (height <= 0) {
-        return;
-    }
+constexpr float kRpmTweenMs = 120.0f;
+constexpr float kRpmSettleEpsilon = 1.0f;
 
-    const int16_t width = display.width() - (kSafeMargin * 2);
-    if (width <= 0) {
-        return;
-    }
-
-    display.fillRect(kSafeMargin, top, width, height, backgroundColor);
-}
-
-void drawCenteredText(Adafruit_GC9A01A &display,
-                      const String &text,
-                      int16_t y,
-                      uint8_t textSize) {
-    if (text.isEmpty()) {
-        return;
-    }
-
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.setTextSize(textSize);
-    display.getTextBounds(text.c_str(), 0, y, &x1, &y1, &w, &h);
-
-    const int16_t centeredX = (display.width() - static_cast<int16_t>(w)) / 2;
-    int16_t x = centeredX;
-    if (x < kSafeMargin) {
-        x = kSafeMargin;
-    }
-    const int16_t maxX = display.width() - kSafeMargin - static_cast<int16_t>(w);
-    if (maxX < kSafeMargin) {
-        x = kSafeMargin;
-    } else if (x > maxX) {
-        x = maxX;
-    }
-
-    display.setCursor(x, y);
-    display.print(text);
-}
+constexpr uint16_t kBackgroundColor = 0x0000;
+constexpr uint16_t kTitleColor = 0xFFFF;
+constexpr uint16_t kRpmColor = 0xF800;
+constexpr uint16_t kStatusColor = 0xFFE0;
 }
 
 TachPage::TachPage()
-        : _title(F("Tacho")),
-          _rpm(0.0f),
-          _statusMessage(F("Awaiting tach signal")),
-          _backgroundColor(0x0000),
-          _titleColor(0xFFFF),
-          _rpmColor(0xF800),
-          _statusColor(0xFFE0),
-          _layoutDirty(true) {}
+        : _rpm(0.0f),
+          _rpmTween({.timeConstantMs = kRpmTweenMs, .settleEpsilon = kRpmSettleEpsilon}),
+          _backgroundColor(kBackgroundColor),
+          _titleLabel(kTitleY, 3, kTitleColor, kBackgroundColor, kSafeMargin),
+          _rpmValue(kRpmY, 6, kRpmColor, kBackgroundColor),
+          _statusLabel(kStatusY, 2, kStatusColor, kBackgroundColor, kSafeMargin),
+          _layoutDirty(true) {
+    _titleLabel.setText("Tacho");
+    _rpmValue.setFont(&fonts::kReadout);
+    _rpmValue.setValue(_rpm);
+    _statusLabel.setText("Awaiting tach signal");
+}
 
-void TachPage::setTitle(const String &title) {
-    _title = title;
-    _layoutDirty = true;
+void TachPage::setTitle(const char *title) {
+    char truncated[kTitleCapacity];
+    strncpy(truncated, title ? title : "", kTitleCapacity - 1);
+    truncated[kTitleCapacity - 1] = '\0';
+    _titleLabel.setText(truncated);
 }
 
 void TachPage::setRpm(float rpm) {
     _rpm = rpm;
+    _rpmTween.setTarget(rpm, millis());
+    if (_rpmTween.isSettled()) {
+        _rpmValue.setValue(_rpmTween.value());
+    }
 }
 
-void TachPage::setStatusMessage(const String &status) {
-    _statusMessage = status;
+void TachPage::setStatusMessage(const char *status) {
+    _statusLabel.setText(status);
 }
 
 void TachPage::onEnter(Adafruit_GC9A01A &display) {
@@ -90,29 +58,23 @@ void TachPage::onEnter(Adafruit_GC9A01A &display) {
     _layoutDirty = true;
 }
 
-void TachPage::drawBaseLayout(Adafruit_GC9A01A &display) {
-    display.fillScreen(_backgroundColor);
-    display.setTextWrap(false);
-    display.setTextColor(_titleColor, _backgroundColor);
-    drawCenteredText(display, _title, kTitleY, 3);
-    _layoutDirty = false;
+bool TachPage::tick(uint32_t nowMs) {
+    if (_rpmTween.step(nowMs)) {
+        _rpmValue.setValue(_rpmTween.value());
+    }
+    return _layoutDirty || _rpmValue.isDirty() || _titleLabel.isDirty() || _statusLabel.isDirty();
 }
 
 void TachPage::render(Adafruit_GC9A01A &display) {
     if (_layoutDirty) {
-        drawBaseLayout(display);
-    } else {
-        display.setTextWrap(false);
+        display.fillScreen(_backgroundColor);
+        _titleLabel.invalidate();
+        _rpmValue.invalidate();
+        _statusLabel.invalidate();
+        _layoutDirty = false;
     }
 
-    display.setTextColor(_rpmColor, _backgroundColor);
-    const String rpmText = String(static_cast<int>(_rpm));
-    const int16_t rpmY = (display.height() / 2) - 30;
-    clearTextBand(display, rpmY, 6, _backgroundColor);
-    drawCenteredText(display, rpmText, rpmY, 6);
-
-    display.setTextColor(_statusColor, _backgroundColor);
-    const int16_t statusY = display.height() - kSafeMargin - kStatusYOffset;
-    clearTextBand(display, statusY, 2, _backgroundColor);
-    drawCenteredText(display, _statusMessage, statusY, 2);
+    _titleLabel.draw(display);
+    _rpmValue.draw(display);
+    _statusLabel.draw(display);
 }
@@ -0,0 +1,67 @@
+#include "esp32_dash/display/ValueTween.h"
+
+#include <math.h>
+
+ValueTween::ValueTween(const Config &config)
+        : _config(config),
+          _value(0.0f),
+          _velocity(0.0f),
+          _target(0.0f),
+          _lastStepMs(0),
+          _hasValue(false),
+          _settled(true) {}
+
+void ValueTween::setTarget(float target, uint32_t timestampMs) {
+    if (!_hasValue) {
+        snapTo(target, timestampMs);
+        return;
+    }
+    if (target == _target) {
+        return;
+    }
+    if (_settled) {
+        // Start integrating from the sample, not from the last idle frame.
+        _lastStepMs = timestampMs;
+        _settled = false;
+    }
+    _target = target;
+}
+
+void ValueTween::snapTo(float value, uint32_t timestampMs) {
+    _value = value;
+    _target = value;
+    _velocity = 0.0f;
+    _lastStepMs = timestampMs;
+    _hasValue = true;
+    _settled = true;
+}
+
+bool ValueTween::step(uint32_t nowMs) {
+    if (_settled) {
+        return false;
+    }
+
+    const uint32_t elapsed = nowMs - _lastStepMs;
+    if (elapsed == 0) {
+        return false;
+    }
+    _lastStepMs = nowMs;
+
+    // Closed-form critically damped response towards a fixed target, so
+    // irregular frame gaps neither overshoot nor go unstable.
+    const float omega = 1.0f / _config.timeConstantMs;
+    const float dt = static_cast<float>(elapsed);
+    const float offset = _value - _target;
+    const float slope = _velocity + omega * offset;
+    const float decay = expf(-omega * dt);
+    _value = _target + (offset + slope * dt) * decay;
+    _velocity = (slope - omega * (offset + slope * dt)) * decay;
+
+    if (fabsf(_value - _target) < _config.settleEpsilon &&
+        fabsf(_velocity) * _config.timeConstantMs < _config.settleEpsilon) {
+        _value = _target;
+        _velocity = 0.0f;
+        _settled = true;
+    }
+    return true;
+}
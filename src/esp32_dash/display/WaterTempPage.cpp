@@ -1,88 +1,68 @@
 #include "esp32_dash/display/pages/WaterTempPage.h"
 
+#include <string.h>
+
+#include "esp32_dash/display/fonts/ReadoutFont.h"
+
 namespace {
+constexpr int16_t kPanelSize = 240;
 constexpr int16_t kSafeMargin = 24;
 constexpr int16_t kTitleY = kSafeMargin + 8;
-constexpr int16_t kStatusYOffset = 30;
-
-void clearTextBand(Adafruit_GC9A01A &display,
-                   int16_t y,
-                   uint8_t textSize,
-                   uint16_t backgroundColor) {
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.setTextSize(textSize);
-    display.getTextBounds("88", 0, y, &x1, &y1, &w, &h);
-
-    int16_t top = y1;
-    int16_t height = static_cast<int16_t>(h);
-    if (top < 0) {
-        height += top;
-        top = 0;
-    }
-    if (height <= 0) {
-        return;
-    }
-
-    const int16_t width = display.width() - (kSafeMargin * 2);
-    if (width <= 0) {
-        return;
-    }
-
-    display.fillRect(kSafeMargin, top, width, height, backgroundColor);
-}
-
-void drawCenteredText(Adafruit_GC9A01A &display,
-                      const String &text,
-                      int16_t y,
-                      uint8_t textSize) {
-    if (text.isEmpty()) {
-        return;
-    }
-
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.setTextSize(textSize);
-    display.getTextBounds(text.c_str(), 0, y, &x1, &y1, &w, &h);
-
-    const int16_t centeredX = (display.width() - static_cast<int16_t>(w)) / 2;
-    int16_t x = centeredX;
-    if (x < kSafeMargin) {
-        x = kSafeMargin;
-    }
-    const int16_t maxX = display.width() - kSafeMargin - static_cast<int16_t>(w);
-    if (maxX < kSafeMargin) {
-        x = kSafeMargin;
-    } else if (x > maxX) {
-        x = maxX;
-    }
-
-    display.setCursor(x, y);
-    display.print(text);
-}
+constexpr int16_t kTempY = (kPanelSize / 2) - 30;
+constexpr int16_t kStatusY = kPanelSize - kSafeMargin - 30;
+
+// Coolant bar sits between the readout and the status line.
+constexpr int16_t kBarWidth = 140;
+constexpr int16_t kBarX = (kPanelSize - kBarWidth) / 2;
+constexpr int16_t kBarY = kTempY + 60;
+constexpr int16_t kBarHeight = 8;
+constexpr float kBarMinC = 40.0f;
+constexpr float kBarMaxC = 120.0f;
+
+// Coolant moves slowly; a lazier follower hides ADC jitter between samples.
+constexpr float kTempTweenMs = 600.0f;
+constexpr float kTempSettleEpsilon = 0.1f;
+
+constexpr uint16_t kBackgroundColor = 0x0000;
+constexpr uint16_t kTitleColor = 0xFFFF;
+constexpr uint16_t kTempColor = 0x07E0;
+constexpr uint16_t kTrackColor = 0x2104;
+constexpr uint16_t kStatusColor = 0xFFE0;
 }
 
 WaterTempPage::WaterTempPage()
-        : _title(F("Water")),
-          _waterTempC(85.0f),
-          _statusMessage(F("")),
-          _backgroundColor(0x0000),
-          _titleColor(0xFFFF),
-          _tempColor(0x07E0),
-          _statusColor(0xFFE0),
-          _layoutDirty(true) {}
+        : _waterTempC(85.0f),
+          _tempTween({.timeConstantMs = kTempTweenMs, .settleEpsilon = kTempSettleEpsilon}),
+          _backgroundColor(kBackgroundColor),
+          _titleLabel(kTitleY, 3, kTitleColor, kBackgroundColor, kSafeMargin),
+          _tempValue(kTempY, 6, kTempColor, kBackgroundColor, " C"),
+          _tempBar(kBarX, kBarY, kBarWidth, kBarHeight, kBarMinC, kBarMaxC, kTempColor, kTrackColor),
+          _statusLabel(kStatusY, 2, kStatusColor, kBackgroundColor, kSafeMargin),
+          _layoutDirty(true) {
+    _titleLabel.setText("Water");
+    _tempValue.setFont(&fonts::kReadout);
+    _tempValue.setValue(_waterTempC);
+    _tempBar.setValue(_waterTempC);
+}
 
-void WaterTempPage::setTitle(const String &title) {
-    _title = title;
-    _layoutDirty = true;
+void WaterTempPage::setTitle(const char *title) {
+    char truncated[kTitleCapacity];
+    strncpy(truncated, title ? title : "", kTitleCapacity - 1);
+    truncated[kTitleCapacity - 1] = '\0';
+    _titleLabel.setText(truncated);
 }
 
 void WaterTempPage::setWaterTemp(float tempC) {
     _waterTempC = tempC;
+    _tempTween.setTarget(tempC, millis());
+    if (_tempTween.isSettled()) {
+        _tempValue.setValue(tempC);
+        _tempBar.setValue(tempC);
+    }
 }
 
-void WaterTempPage::setStatusMessage(const String &status) {
-    _statusMessage = status;
+void WaterTempPage::setStatusMessage(const char *status) {
+    _statusLabel.setText(status);
 }
 
 void WaterTempPage::onEnter(Adafruit_GC9A01A &display) {
@@ -90,29 +70,27 @@ void WaterTempPage::onEnter(Adafruit_GC9A01A &display) {
     _layoutDirty = true;
 }
 
-void WaterTempPage::drawBaseLayout(Adafruit_GC9A01A &display) {
-    display.fillScreen(_backgroundColor);
-    display.setTextWrap(false);
-    display.setTextColor(_titleColor, _backgroundColor);
-    drawCenteredText(display, _title, kTitleY, 3);
-    _layoutDirty = false;
+bool WaterTempPage::tick(uint32_t nowMs) {
+    if (_tempTween.step(nowMs)) {
+        _tempValue.setValue(_tempTween.value());
+        _tempBar.setValue(_tempTween.value());
+    }
+    return _layoutDirty || _tempValue.isDirty() || _tempBar.isDirty() ||
+           _titleLabel.isDirty() || _statusLabel.isDirty();
 }
 
 void WaterTempPage::render(Adafruit_GC9A01A &display) {
     if (_layoutDirty) {
-        drawBaseLayout(display);
-    } else {
-        display.setTextWrap(false);
+        display.fillScreen(_backgroundColor);
+        _titleLabel.invalidate();
+        _tempValue.invalidate();
+        _tempBar.invalidate();
+        _statusLabel.invalidate();
+        _layoutDirty = false;
     }
 
-    display.setTextColor(_tempColor, _backgroundColor);
-    const String tempText = String(static_cast<int>(_waterTempC)) + F(" C");
-    const int16_t tempY = (display.height() / 2) - 30;
-    clearTextBand(display, tempY, 6, _backgroundColor);
-    drawCenteredText(display, tempText, tempY, 6);
-
-    display.setTextColor(_statusColor, _backgroundColor);
-    const int16_t statusY = display.height() - kSafeMargin - kStatusYOffset;
-    clearTextBand(display, statusY, 2, _backgroundColor);
-    drawCenteredText(display, _statusMessage, statusY, 2);
+    _titleLabel.draw(display);
+    _tempValue.draw(display);
+    _tempBar.draw(display);
+    _statusLabel.draw(display);
 }
@@ -1,24 +1,46 @@
 #include <BLEDevice.h>
 #include <BLEUtils.h>
 #include <BLEServer.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
 
 #include "esp32_dash/main.h"
 #include <math.h>
+#include <type_traits>
 
+#include "esp32_dash/alarms/AlarmEngine.h"
+#include "esp32_dash/alarms/AlarmOverlay.h"
 #include "esp32_dash/display/DisplayManager.h"
+#include "esp32_dash/display/DmaGC9A01A.h"
+#include "esp32_dash/display/images/BootLogo.h"
+#include "esp32_dash/display/pages/MultiGaugePage.h"
 #include "esp32_dash/display/pages/StaticTextPage.h"
+#include "esp32_dash/display/pages/SweepTachPage.h"
 #include "esp32_dash/display/pages/TachPage.h"
 #include "esp32_dash/display/pages/WaterTempPage.h"
+#include "esp32_dash/sensors/DigitalInputs.h"
+#include "esp32_dash/sensors/PulseCapture.h"
 #include "esp32_dash/sensors/TachSensor.h"
 #include "esp32_dash/sensors/WaterSensor.h"
+#include "esp32_dash/TM1638/ButtonScanner.h"
+#include "esp32_dash/TM1638/ShiftLight.h"
 #include "esp32_dash/TM1638/TM1638LedAndKey.h"
+#include "esp32_dash/diagnostics/BootTimeline.h"
+#include "esp32_dash/diagnostics/LoopProfiler.h"
+#include "esp32_dash/diagnostics/SerialConsole.h"
+#include "esp32_dash/diagnostics/TelemetryFrame.h"
+#include "esp32_dash/power/PowerManager.h"
 #include "esp32_dash/myCustomCallbacks.h"
 #include "esp32_dash/myServerCallbacks.h"
 
 BLEServer *pServer = nullptr;
 BLECharacteristic *pCharacteristic = nullptr;
+SerialConsole console;
 
 namespace {
+    constexpr uint32_t kAnimationFrameMs = 33;  // ~30 FPS while values move
+
     DisplayConfig makeDisplayConfig() {
         DisplayConfig cfg;
         cfg.csPin = 5;
@@ -28,17 +50,52 @@ namespace {
         cfg.rotation = 0;
         cfg.backgroundColor = 0x0000;
         cfg.refreshIntervalMs = 0;  // redraw only when something changes
+        cfg.animationFrameIntervalMs = kAnimationFrameMs;
         cfg.width = 240;
         cfg.height = 240;
         return cfg;
     }
+
+    constexpr float kDialMaxRpm = 8000.0f;
+    constexpr float kDialRedlineRpm = 7000.0f;
+
+    // ~3.5 ms of SPI at 40 MHz per frame: RPM (10240 B) plus the largest
+    // slower region, speed (6912 B), so nothing waits more than one frame.
+    constexpr MultiGaugePage::Config kMultiGaugeConfig = {
+            .frameBudgetBytes = 17408,
+            .rpmIntervalMs = 0,
+            .speedIntervalMs = 250,
+            .coolantIntervalMs = 1000,
+            .linkIntervalMs = 1000,
+    };
 }
 
 DisplayManager displayManager(makeDisplayConfig());
+#if DASH_STATIC_PAGES
+PageSet<StaticTextPage, WaterTempPage, TachPage, SweepTachPage, MultiGaugePage> dashPages(
+        StaticTextPage("Miata", "Booting"), WaterTempPage(), TachPage(),
+        SweepTachPage({.maxRpm = kDialMaxRpm, .redlineRpm = kDialRedlineRpm}),
+        MultiGaugePage(kMultiGaugeConfig));
+StaticTextPage &startupPage = dashPages.get<0>();
+WaterTempPage &waterPage = dashPages.get<1>();
+TachPage &tachPage = dashPages.get<2>();
+SweepTachPage &sweepTachPage = dashPages.get<3>();
+MultiGaugePage &multiGaugePage = dashPages.get<4>();
+#if !DASH_BENCHMARK
+static_assert(!std::is_polymorphic<StaticTextPage>::value && !std::is_polymorphic<WaterTempPage>::value &&
+                      !std::is_polymorphic<TachPage>::value && !std::is_polymorphic<SweepTachPage>::value &&
+                      !std::is_polymorphic<MultiGaugePage>::value,
+              "static-page builds should carry no page vtables");
+#endif
+#else
 StaticTextPage startupPage("Miata", "Booting");
 WaterTempPage waterPage;
 TachPage tachPage;
+SweepTachPage sweepTachPage({.maxRpm = kDialMaxRpm, .redlineRpm = kDialRedlineRpm});
+MultiGaugePage multiGaugePage(kMultiGaugeConfig);
+#endif
 constexpr uint32_t kStatusOverlayDurationMs = 2000;
+constexpr uint32_t kSplashDurationMs = 300;
 
 namespace {
     constexpr int cNanoRXPin = 33;
@@ -46,6 +103,7 @@ namespace {
 
     constexpr int kWaterTempPin = 34;
     constexpr int kTachSignalPin = 35;
+    constexpr int kVssSignalPin = 39;  // input-only pad, same conditioning as tach
 
     constexpr float kAdcReferenceVoltage = 3.3f;
     constexpr int kAdcResolution = 4095;
@@ -60,18 +118,95 @@ namespace {
     constexpr float kTachChangeThresholdRpm = 25.0f;
     constexpr uint32_t kTachMinPulseIntervalMicros = 2000;
 
+    constexpr size_t kTachChannel = 0;
+    constexpr size_t kVssChannel = 1;
+    // The VSS uses the pulse counter, which can only apply its own glitch filter.
+    constexpr uint32_t kVssMinPulseIntervalMicros = PulseChannel::kHardwareFilterMicros;
+    constexpr uint32_t kVssStaleMicros = 2000000;  // ~0.5 km/h; slower than this reads as stopped
+    constexpr float kVssPulsesPerKm = 4000.0f;  // calibrate against GPS speed
+
+    constexpr uint32_t kSwitchDebounceMicros = 20000;
+
     constexpr uint32_t kDataPageCycleMs = 8000;
+    constexpr uint32_t kDataPageMaxDwellMs = 20000;
+    constexpr uint32_t kDataPageSettleMs = 2000;
+    constexpr uint32_t kDataPageStaleMs = 5000;
+    constexpr uint32_t kRotationUserPauseMs = 30000;
+    constexpr uint32_t kRotationMaxSwitchDelayMs = 1000;
+    constexpr float kRotationRpmChange = 100.0f;
+    constexpr float kRotationCoolantChange = 1.0f;
     constexpr size_t kWaterPageIndex = 1;  // after the startup page
     constexpr size_t kTachPageIndex = 2;
+    constexpr size_t kSweepTachPageIndex = 3;
+    constexpr size_t kMultiGaugePageIndex = 4;
 
     constexpr uint8_t TM1638_STROBE = 25;
     constexpr uint8_t TM1638_CLK = 26;
     constexpr uint8_t TM1638_DATA = 27;
-    uint8_t g_lastTmButtons = 0;
 
-    uint32_t g_lastPageSwitch = 0;
-    size_t g_currentDataPage = 0;
-    bool g_lowPowerMode = false;
+    constexpr uint32_t kButtonScanIntervalMs = 5;
+    constexpr uint8_t kButtonDebounceSamples = 4;  // 20 ms at the scan rate
+    constexpr uint32_t kButtonLongPressMs = 800;
+    constexpr uint32_t kTm1638TaskStackBytes = 3072;
+    SemaphoreHandle_t g_tm1638Mutex = nullptr;
+    volatile uint8_t g_pageLedMask = 0x01;
+
+    enum class SegmentReadout : uint8_t {
+        Rpm,
+        Coolant,
+        Off,
+        Count
+    };
+    volatile SegmentReadout g_segmentReadout = SegmentReadout::Rpm;
+
+    constexpr float kShiftLightStartRpm = 4500.0f;
+    constexpr float kShiftLightRedlineRpm = 6500.0f;
+    constexpr uint32_t kShiftLightFlashPeriodMs = 100;
+
+    // Earlier rows outrank later ones of the same severity.
+    constexpr AlarmRule kAlarmRules[] = {
+            {"OVER-REV",        AlarmSignal::Rpm,      AlarmKind::Above,        AlarmSeverity::Critical, 7200.0f, 6800.0f, true,  0xFF},
+            {"COOLANT HOT",     AlarmSignal::CoolantC, AlarmKind::Above,        AlarmSeverity::Critical, 110.0f,  106.0f,  false, 0x81},
+            {"Coolant warm",    AlarmSignal::CoolantC, AlarmKind::Above,        AlarmSeverity::Warning,  104.0f,  101.0f,  false, 0x80},
+            {"Coolant rising",  AlarmSignal::CoolantC, AlarmKind::RisingFaster, AlarmSeverity::Warning,  1.0f,    0.3f,    false, 0x40},
+            {"No coolant temp", AlarmSignal::CoolantC, AlarmKind::Stale,        AlarmSeverity::Warning,  5000.0f, 0.0f,    false, 0x20},
+    };
+    constexpr uint32_t kAlarmWarningOverlayMs = 3000;
+    constexpr uint16_t kAlarmCriticalBackground = 0xF800;  // red
+    constexpr uint16_t kAlarmWarningBackground = 0xFD20;   // amber
+    volatile uint8_t g_warningLedMask = 0;
+    volatile uint8_t g_criticalLedMask = 0;
+    uint32_t g_lastCoolantReadingMs = 0;
+
+    // Serializes TM1638 bus access between the scan task and the main loop.
+    class Tm1638Lock {
+    public:
+        Tm1638Lock() { xSemaphoreTake(g_tm1638Mutex, portMAX_DELAY); }
+        ~Tm1638Lock() { xSemaphoreGive(g_tm1638Mutex); }
+    };
+
+    constexpr uint32_t kTelemetryIntervalMs = 20;  // 50 Hz, ~1 kB/s of the 115200 baud link
+    uint32_t g_lastTelemetryMs = 0;
+    esp_timer_handle_t g_simTachTimer = nullptr;
+
+    // Light sleep runs in slices so BLE wake requests and the TM1638 keys
+    // are checked every slice; a tach pulse wakes straight away.
+    constexpr uint32_t kSleepSliceMs = 250;
+    constexpr uint32_t kPanelMinAwakeMs = 120;
+    constexpr uint32_t kMaxWakeToFrameMs = 500;  // give up waiting for a frame from a dead panel
+    // BLE advertising intervals in 0.625 ms units.
+    constexpr uint16_t kAdvertisingActiveMin = 0x20;  // 20 ms, the stack default
+    constexpr uint16_t kAdvertisingActiveMax = 0x40;  // 40 ms
+    constexpr uint16_t kAdvertisingSleepMin = 1600;   // 1 s
+    constexpr uint16_t kAdvertisingSleepMax = 2000;   // 1.25 s
+    bool g_ignoreWakePress = false;
+
+    constexpr uint32_t kBleInitStackBytes = 8192;
+    volatile bool g_bleReady = false;
+    bool g_bootReportPublished = false;
+
+    // Must stay below kAnimationFrameMs or tweened readouts drop frames.
+    constexpr uint32_t kLoopIdleMs = 10;
 }
 
 
@@ -85,21 +220,449 @@ WaterSensor waterSensor({
                                 .changeThresholdC = kWaterTempChangeThresholdC,
                         }, waterPage, displayManager);
 
+PulseCapture<2> pulseCapture({
+                                      {
+                                              .pin = kTachSignalPin,
+                                              .edge = RISING,
+                                              .debounceMicros = kTachMinPulseIntervalMicros,
+                                              .backend = PulseBackend::GpioInterrupt,
+                                              .staleMicros = 0,  // TachSensor rates from counts, not periods
+                                      },
+                                      {
+                                              .pin = kVssSignalPin,
+                                              .edge = RISING,
+                                              .debounceMicros = kVssMinPulseIntervalMicros,
+                                              .backend = PulseBackend::Pcnt,
+                                              .staleMicros = kVssStaleMicros,
+                                      },
+                              });
+
+// Indexed by VehicleInput.
+DigitalInputs<static_cast<size_t>(VehicleInput::Count)> vehicleInputs({
+                                                                      {
+                                                                              .pin = LIGHTS_SENSE_PIN,
+                                                                              .mode = INPUT,
+                                                                              .activeLow = false,
+                                                                              .debounceMicros = kSwitchDebounceMicros,
+                                                                      },
+                                                                      {
+                                                                              .pin = HANDBRAKE_PIN,
+                                                                              .mode = INPUT_PULLUP,
+                                                                              .activeLow = true,
+                                                                              .debounceMicros = kSwitchDebounceMicros,
+                                                                      },
+                                                                      {
+                                                                              .pin = WINDOWS_PIN,
+                                                                              .mode = INPUT_PULLUP,
+                                                                              .activeLow = true,
+                                                                              .debounceMicros = kSwitchDebounceMicros,
+                                                                      },
+                                                              });
+
 TachSensor tachSensor({
-                              .signalPin = kTachSignalPin,
                               .updateIntervalMs = kTachUpdateIntervalMs,
                               .pulsesPerRevolution = kTachPulsesPerRevolution,
                               .changeThresholdRpm = kTachChangeThresholdRpm,
-                              .minPulseIntervalMicros = kTachMinPulseIntervalMicros,
-                      }, tachPage, displayManager);
+                      }, pulseCapture.channel(kTachChannel), tachPage, displayManager);
 
 TM1638LedAndKeyModule tm1638(TM1638_STROBE, TM1638_CLK, TM1638_DATA);
+ButtonScanner buttonScanner({
+                                    .integratorSamples = kButtonDebounceSamples,
+                                    .longPressMs = kButtonLongPressMs,
+                            });
+ShiftLight shiftLight({
+                              .startRpm = kShiftLightStartRpm,
+                              .redlineRpm = kShiftLightRedlineRpm,
+                              .flashPeriodMs = kShiftLightFlashPeriodMs,
+                      });
+
+AlarmEngine alarmEngine(kAlarmRules);
+AlarmOverlay alarmOverlay({
+                                  .warningMs = kAlarmWarningOverlayMs,
+                                  .statusMs = kStatusOverlayDurationMs,
+                                  .criticalBackground = kAlarmCriticalBackground,
+                                  .warningBackground = kAlarmWarningBackground,
+                          }, alarmEngine, displayManager);
+PageRotation pageRotation({
+                                  .dwellMs = kDataPageCycleMs,
+                                  .maxDwellMs = kDataPageMaxDwellMs,
+                                  .settleMs = kDataPageSettleMs,
+                                  .staleAfterMs = kDataPageStaleMs,
+                                  .userPauseMs = kRotationUserPauseMs,
+                                  .maxSwitchDelayMs = kRotationMaxSwitchDelayMs,
+                          });
+
+namespace {
+    gpio_int_type_t gpioEdgeType(int edge) {
+        switch (edge) {
+            case FALLING:
+                return GPIO_INTR_NEGEDGE;
+            case CHANGE:
+                return GPIO_INTR_ANYEDGE;
+            default:
+                return GPIO_INTR_POSEDGE;
+        }
+    }
+
+    class DashPowerHal final : public PowerHal {
+    public:
+        void setDisplayAsleep(bool asleep) override {
+            displayManager.setPanelAsleep(asleep);
+        }
+
+        void setSlowAdvertising(bool slow) override {
+            if (!g_bleReady) {
+                return;
+            }
+            BLEAdvertising *advertising = BLEDevice::getAdvertising();
+            advertising->setMinInterval(slow ? kAdvertisingSleepMin : kAdvertisingActiveMin);
+            advertising->setMaxInterval(slow ? kAdvertisingSleepMax : kAdvertisingActiveMax);
+            if (pServer->getConnectedCount() == 0) {
+                // New intervals only apply when advertising restarts.
+                advertising->stop();
+                advertising->start();
+            }
+        }
+
+        WakeSource lightSleep(uint32_t maxMs) override {
+            const PulseChannelConfig &tach = pulseCapture.channel(kTachChannel).config();
+            const auto pin = static_cast<gpio_num_t>(tach.pin);
+
+            // Wake on whichever level the tach line is not at now, so any
+            // edge ends the sleep. The edge interrupt is parked meanwhile;
+            // the wakeup shares its trigger-type field.
+            gpio_intr_disable(pin);
+            gpio_wakeup_enable(pin, digitalRead(tach.pin) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+            esp_sleep_enable_gpio_wakeup();
+            esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(maxMs) * 1000ULL);
+
+            Serial.flush();
+            const bool slept = esp_light_sleep_start() == ESP_OK;
+
+            gpio_wakeup_disable(pin);
+            gpio_set_intr_type(pin, gpioEdgeType(tach.edge));
+            gpio_intr_enable(pin);
+            esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+
+            if (!slept) {
+                // Rejected (e.g. radio without modem sleep): idle instead.
+                delay(maxMs);
+                return WakeSource::Timer;
+            }
+            return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO ? WakeSource::TachPulse : WakeSource::Timer;
+        }
+
+        bool buttonsHeld() override {
+            Tm1638Lock lock;
+            return tm1638.readButtons() != 0;
+        }
+
+        uint32_t micros() override {
+            return ::micros();
+        }
+    };
+
+    DashPowerHal powerHal;
+}
+
+PowerManager powerManager({
+                                  .sleepSliceMs = kSleepSliceMs,
+                                  .minAwakeMs = kPanelMinAwakeMs,
+                                  .maxWakingMs = kMaxWakeToFrameMs,
+                          }, powerHal);
 
 HardwareSerial nanoSerial(2);
 
+float vehicleSpeedKmh() {
+    const float pulsesPerHour = pulseCapture.channel(kVssChannel).frequencyHz() * 3600.0f;
+    return pulsesPerHour / kVssPulsesPerKm;
+}
+
 void updateSensors() {
-    waterSensor.update();
-    tachSensor.update();
+    {
+        DASH_PROFILE_ZONE(WaterUpdate);
+        waterSensor.update();
+    }
+    {
+        DASH_PROFILE_ZONE(TachUpdate);
+        tachSensor.update();
+        // The sweep follows the per-pulse RPM; its tick() asks for frames
+        // only while the arc or readout is still moving.
+        if (displayManager.currentPageIndex() == kSweepTachPageIndex) {
+            sweepTachPage.setRpm(tachSensor.instantRpm());
+        }
+    }
+    if (displayManager.currentPageIndex() == kMultiGaugePageIndex) {
+        // Setters ignore unchanged values; each region paces its own redraws.
+        multiGaugePage.setRpm(tachSensor.lastRpm());
+        multiGaugePage.setCoolantTemp(waterSensor.lastTempC());
+        multiGaugePage.setSpeed(vehicleSpeedKmh());
+        multiGaugePage.setLinkConnected(g_bleReady && pServer->getConnectedCount() > 0);
+    }
+}
+
+// Fans fresh samples out to the alarm engine and the page rotation.
+void publishSamples(uint32_t now) {
+    const float rpm = tachSensor.instantRpm();
+    alarmEngine.sample(AlarmSignal::Rpm, rpm, now);
+    if (rpm > 0.0f) {
+        // With the engine stopped the tach pages have nothing to show.
+        pageRotation.noteValue(kTachPageIndex, rpm, now);
+        pageRotation.noteValue(kSweepTachPageIndex, rpm, now);
+    }
+    if (waterSensor.lastReadingMs() != g_lastCoolantReadingMs) {
+        g_lastCoolantReadingMs = waterSensor.lastReadingMs();
+        alarmEngine.sample(AlarmSignal::CoolantC, waterSensor.lastTempC(), now);
+        pageRotation.noteValue(kWaterPageIndex, waterSensor.lastTempC(), now);
+    }
+}
+
+// Runs every loop right after the sensors, so a new alarm is on screen in
+// the same iteration's frame whichever page is showing.
+void updateAlarms() {
+    if (isLowPowerMode()) {
+        return;
+    }
+    const uint32_t now = millis();
+    publishSamples(now);
+    alarmEngine.checkStale(now);
+    const bool changed = alarmEngine.takeChanged();
+    // Also runs without a change, so a critical overlay knocked down by
+    // anything else goes straight back up.
+    alarmOverlay.update(changed);
+    if (!changed) {
+        return;
+    }
+
+    g_warningLedMask = alarmEngine.ledMask(AlarmSeverity::Warning);
+    g_criticalLedMask = alarmEngine.ledMask(AlarmSeverity::Critical);
+    const bool rpmAlarm = alarmEngine.isValueAlarming(AlarmSignal::Rpm);
+    pageRotation.setAlarming(kTachPageIndex, rpmAlarm);
+    pageRotation.setAlarming(kSweepTachPageIndex, rpmAlarm);
+    pageRotation.setAlarming(kWaterPageIndex, alarmEngine.isValueAlarming(AlarmSignal::CoolantC));
+}
+
+size_t formatLoopStats(char *buffer, size_t size) {
+#if DASH_PROFILING
+    return loopProfiler().format(buffer, size);
+#else
+    return static_cast<size_t>(snprintf(buffer, size, "Profiling disabled\n"));
+#endif
+}
+
+// Drives the tach channel from a periodic timer, as if the coil were firing.
+void simulatedTachPulse(void *) {
+    pulseCapture.channel(kTachChannel).onEdge(micros());
+}
+
+void setSimulatedRpm(uint32_t rpm) {
+    if (!g_simTachTimer) {
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = &simulatedTachPulse;
+        timerArgs.name = "simTach";
+        if (esp_timer_create(&timerArgs, &g_simTachTimer) != ESP_OK) {
+            g_simTachTimer = nullptr;
+            return;
+        }
+    }
+    esp_timer_stop(g_simTachTimer);  // fails harmlessly when idle
+    if (rpm > 0) {
+        const float pulsesPerSecond = static_cast<float>(rpm) * kTachPulsesPerRevolution / 60.0f;
+        esp_timer_start_periodic(g_simTachTimer, static_cast<uint64_t>(1000000.0f / pulsesPerSecond));
+    }
+}
+
+// Draws the same primitive mix in every transfer mode. Each run ends with a
+// flush, so queued work counts until it has actually left the bus.
+void benchmarkDisplay(DmaGC9A01A &display) {
+    struct Workload {
+        const char *name;
+        void (*draw)(DmaGC9A01A &display);
+    };
+    static const Workload kWorkloads[] = {
+            {"pixel x2000", [](DmaGC9A01A &d) {
+                for (uint16_t i = 0; i < 2000; ++i) {
+                    d.drawPixel((i * 37) % 240, (i * 91) % 240, i);
+                }
+            }},
+            {"hline 8px x500", [](DmaGC9A01A &d) {
+                for (uint16_t i = 0; i < 500; ++i) {
+                    d.drawFastHLine((i * 13) % 232, (i * 7) % 240, 8, i);
+                }
+            }},
+            {"fill 240x8 x30", [](DmaGC9A01A &d) {
+                for (uint16_t i = 0; i < 30; ++i) {
+                    d.fillRect(0, (i * 8) % 240, 240, 8, i * 2047);
+                }
+            }},
+            {"screen x4", [](DmaGC9A01A &d) {
+                for (uint16_t i = 0; i < 4; ++i) {
+                    d.fillScreen(i * 0x3333);
+                }
+            }},
+    };
+    constexpr SpiTransferMode kModes[] = {SpiTransferMode::Auto, SpiTransferMode::Queued, SpiTransferMode::Polling};
+
+    for (const Workload &workload : kWorkloads) {
+        uint32_t elapsed[3];
+        for (size_t i = 0; i < 3; ++i) {
+            display.setTransferMode(kModes[i]);
+            const uint32_t start = micros();
+            workload.draw(display);
+            display.flush();
+            elapsed[i] = micros() - start;
+        }
+        console.printf("%s: auto=%lu queued=%lu polling=%lu us\n", workload.name,
+                       static_cast<unsigned long>(elapsed[0]), static_cast<unsigned long>(elapsed[1]),
+                       static_cast<unsigned long>(elapsed[2]));
+    }
+    display.setTransferMode(SpiTransferMode::Auto);
+    // The transient clears with a full page reset, repainting over the bench.
+    showTransientStatusMessage(F("Bench done"));
+}
+
+void handleSerialCommand(const ConsoleArgs &args) {
+    uint32_t value = 0;
+    if (args.matches("stats")) {
+        static char stats[512];
+        formatLoopStats(stats, sizeof(stats));
+        console.print(stats);
+    } else if (args.matches("boot")) {
+        char report[128];
+        bootTimeline().format(report, sizeof(report));
+        console.print(report);
+    } else if (args.matches("power")) {
+        console.printf("power: state=%u wake source=%u slices=%lu wake to frame=%lu us wake timeouts=%lu\n",
+                       static_cast<unsigned>(powerManager.state()),
+                       static_cast<unsigned>(powerManager.lastWakeSource()),
+                       static_cast<unsigned long>(powerManager.sleepSlices()),
+                       static_cast<unsigned long>(powerManager.lastWakeToFrameMicros()),
+                       static_cast<unsigned long>(powerManager.wakeTimeouts()));
+    } else if (args.matches("bench tm1638")) {
+        constexpr uint16_t kIterations = 200;
+        Tm1638Lock lock;
+        const auto arduino = tm1638.benchmark(TM1638LedAndKeyModule::Backend::ArduinoGpio, kIterations);
+        const auto direct = tm1638.benchmark(TM1638LedAndKeyModule::Backend::DirectRegister, kIterations);
+        console.printf("tm1638 readButtons: arduino=%lu us direct=%lu us\n",
+                       static_cast<unsigned long>(arduino.readButtonsMicros),
+                       static_cast<unsigned long>(direct.readButtonsMicros));
+        console.printf("tm1638 16-byte flush: arduino=%lu us direct=%lu us\n",
+                       static_cast<unsigned long>(arduino.fullFlushMicros),
+                       static_cast<unsigned long>(direct.fullFlushMicros));
+    } else if (args.matches("bench display")) {
+        DmaGC9A01A *dma = DmaGC9A01A::active();
+        if (!dma) {
+            console.println(F("DMA display not active"));
+            return;
+        }
+        benchmarkDisplay(*dma);
+#if DASH_BENCHMARK && DASH_STATIC_PAGES
+    } else if (args.matches("bench pages")) {
+        Adafruit_GC9A01A *display = displayManager.display();
+        if (!display) {
+            console.println(F("Display not ready"));
+            return;
+        }
+        // tick() advances each page's tweens, so there is real work behind
+        // every call; the barrier stops the compiler hoisting or merging
+        // calls across iterations on either path.
+        constexpr uint32_t kIterations = 30000;
+        DisplayPage *const virtualPages[] = {&startupPage, &waterPage, &tachPage, &sweepTachPage, &multiGaugePage};
+        constexpr size_t kPages = sizeof(virtualPages) / sizeof(virtualPages[0]);
+        const uint32_t nowMs = millis();
+        uint32_t changed = 0;
+        uint32_t start = micros();
+        for (uint32_t i = 0; i < kIterations; ++i) {
+            changed += virtualPages[i % kPages]->tick(nowMs + i) ? 1 : 0;
+            asm volatile("" ::: "memory");
+        }
+        const uint32_t virtualMicros = micros() - start;
+        start = micros();
+        for (uint32_t i = 0; i < kIterations; ++i) {
+            changed += dashPages.tick(i % kPages, nowMs + i) ? 1 : 0;
+            asm volatile("" ::: "memory");
+        }
+        const uint32_t staticMicros = micros() - start;
+        displayManager.requestRefresh();
+        console.printf("page tick x%lu: virtual=%lu us static=%lu us (%lu changed)\n",
+                       static_cast<unsigned long>(kIterations),
+                       static_cast<unsigned long>(virtualMicros),
+                       static_cast<unsigned long>(staticMicros),
+                       static_cast<unsigned long>(changed));
+#endif
+    } else if (args.matches("speed")) {
+        console.printf("VSS %.1f km/h\n", vehicleSpeedKmh());
+    } else if (args.matches("stats reset")) {
+        loopProfiler().reset();
+        console.println(F("Stats reset"));
+    } else if (args.matches("page", 1) && args.uintAt(1, value)) {
+        pageRotation.noteUserInput(millis());
+        displayManager.showPage(value);
+    } else if (args.matches("log dump")) {
+        console.dumpLog();
+    } else if (args.matches("sim rpm", 1) && args.uintAt(2, value)) {
+        setSimulatedRpm(value);
+        console.printf("Simulating %lu rpm\n", static_cast<unsigned long>(value));
+    } else if (args.matches("stream on")) {
+        console.println(F("Streaming telemetry; send 'stream off' to stop"));
+        console.setStreaming(true);
+    } else if (args.matches("stream off")) {
+        console.setStreaming(false);
+        console.printf("Streaming stopped, %lu frames dropped\n",
+                       static_cast<unsigned long>(console.droppedFrames()));
+    } else {
+        console.print(F("Unknown command: "));
+        console.println(args.words[0]);
+    }
+}
+
+void handleSerialInput() {
+    ConsoleArgs args;
+    while (Serial.available()) {
+        if (console.feed(static_cast<char>(Serial.read()), args)) {
+            handleSerialCommand(args);
+        }
+    }
+}
+
+// Hands the UART only what fits in its FIFO, so a host that is not
+// reading never stalls the loop.
+void drainConsole() {
+    int room = Serial.availableForWrite();
+    const uint8_t *chunk = nullptr;
+    while (room > 0) {
+        const size_t queued = console.peekTx(chunk);
+        if (queued == 0) {
+            break;
+        }
+        const size_t length = queued < static_cast<size_t>(room) ? queued : static_cast<size_t>(room);
+        const size_t written = Serial.write(chunk, length);
+        console.consumeTx(written);
+        if (written < length) {
+            break;
+        }
+        room -= static_cast<int>(written);
+    }
+}
+
+void publishTelemetry(uint32_t now) {
+    if (!console.isStreaming() || (now - g_lastTelemetryMs) < kTelemetryIntervalMs) {
+        return;
+    }
+    g_lastTelemetryMs = now;
+    const TelemetrySample sample = {
+            .ms = now,
+            .rpm = tachSensor.lastRpm(),
+            .coolantC = waterSensor.lastTempC(),
+            .speedKmh = vehicleSpeedKmh(),
+            .page = displayManager.currentPageIndex(),
+            .inputs = static_cast<uint8_t>(vehicleInputs.states()),
+            .alarmLeds = static_cast<uint8_t>(g_warningLedMask | g_criticalLedMask),
+            .droppedBytes = console.droppedBytes(),
+    };
+    uint8_t frame[kTelemetryFrameBytes];
+    const size_t length = encodeTelemetryFrame(sample, frame, sizeof(frame));
+    console.writeFrame(frame, length);
 }
 
 void showTransientStatusMessage(const String &message) {
@@ -107,147 +670,187 @@ void showTransientStatusMessage(const String &message) {
         return;
     }
     if (displayManager.isSuspended()) {
-        Serial.print(F("Status (suspended): "));
-        Serial.println(message);
+        console.print(F("Status (suspended): "));
+        console.println(message.c_str());
         return;
     }
-    displayManager.showTransientMessage(message, kStatusOverlayDurationMs);
+    if (!alarmOverlay.showStatus(message)) {
+        console.print(F("Status (behind alarm): "));
+        console.println(message.c_str());
+    }
 }
 
 void showTransientStatusMessage(const __FlashStringHelper *message) {
     showTransientStatusMessage(String(message));
 }
 
+// Safe from the BLE task: the loop makes the transition on its next pass.
 void enterLowPowerMode() {
-    if (g_lowPowerMode) {
-        return;
+    powerManager.requestSleep();
+}
+
+void exitLowPowerMode() {
+    powerManager.requestWake();
+}
+
+bool isLowPowerMode() {
+    return powerManager.state() != PowerState::Active;
+}
+
+bool isVehicleInputActive(VehicleInput input) {
+    return vehicleInputs.isActive(static_cast<size_t>(input));
+}
+
+void handleVehicleInputs() {
+    InputEvent event;
+    while (vehicleInputs.poll(event, micros())) {
+        switch (static_cast<VehicleInput>(event.input)) {
+            case VehicleInput::Lights:
+                showTransientStatusMessage(event.active ? F("Lights ON") : F("Lights OFF"));
+                break;
+            case VehicleInput::Handbrake:
+                console.println(event.active ? F("Handbrake on") : F("Handbrake off"));
+                break;
+            case VehicleInput::Windows:
+                console.println(event.active ? F("Window switch on") : F("Window switch off"));
+                break;
+            case VehicleInput::Count:
+                break;
+        }
     }
-    Serial.println(F("Entering low power mode"));
-    g_lowPowerMode = true;
+}
+
+void suspendForSleep() {
+    console.println(F("Entering low power mode"));
     waterSensor.setEnabled(false);
     tachSensor.setEnabled(false);
     displayManager.setSuspended(true);
 }
 
-void exitLowPowerMode() {
-    if (!g_lowPowerMode) {
-        return;
-    }
-    Serial.println(F("Leaving low power mode"));
-    g_lowPowerMode = false;
+void resumeFromSleep() {
+    console.println(F("Leaving low power mode"));
     displayManager.setSuspended(false);
     waterSensor.setEnabled(true);
     tachSensor.setEnabled(true);
+    alarmEngine.reset(millis());
+    g_ignoreWakePress = powerManager.lastWakeSource() == WakeSource::Button;
     showTransientStatusMessage(F("Awake"));
 }
 
-bool isLowPowerMode() {
-    return g_lowPowerMode;
+void handlePowerTransitions() {
+    switch (powerManager.update()) {
+        case PowerTransition::Slept:
+            suspendForSleep();
+            break;
+        case PowerTransition::Woke:
+            resumeFromSleep();
+            break;
+        case PowerTransition::None:
+            break;
+    }
 }
 
-void handleTm1638Buttons() {
-    uint8_t buttons = tm1638.readButtons();
-
-    // Rising-edge detection (only trigger once per press)
-    uint8_t pressed = buttons & ~g_lastTmButtons;
-    g_lastTmButtons = buttons;
-
-    if (!pressed) return;  // nothing new pressed
-
-    // Each bit = one button
-    // Bit 0 → Button 1 (left)
-    // Bit 7 → Button 8 (right)
-
-    switch (pressed) {
-
-        case 0x01:  // Button 1
-            Serial.println("Button 1 pressed");
-            displayManager.previousPage();
+void formatSegmentReadout(SegmentReadout readout, char *text, size_t size) {
+    switch (readout) {
+        case SegmentReadout::Rpm:
+            snprintf(text, size, "r%7d", static_cast<int>(tachSensor.lastRpm()));
             break;
-
-        case 0x02:  // Button 2
-            Serial.println("Button 2 pressed");
-            displayManager.nextPage();
+        case SegmentReadout::Coolant: {
+            const float tempC = waterSensor.lastTempC();
+            if (isnan(tempC)) {
+                snprintf(text, size, "C   ---*");
+            } else {
+                snprintf(text, size, "C%6d*", static_cast<int>(tempC));
+            }
             break;
-
-        case 0x04:  // Button 3
-            Serial.println("Button 3 pressed");
+        }
+        case SegmentReadout::Off:
+        case SegmentReadout::Count:
+            text[0] = '\0';
             break;
+    }
+}
 
-        case 0x08:  // Button 4
-            Serial.println("Button 4 pressed");
-            break;
+// Owns the TM1638 fast tick: key sampling plus the LEDs, so the shift light
+// follows the latest tach pulse without waiting on the display pipeline.
+void tm1638Task(void *) {
+    TickType_t lastWake = xTaskGetTickCount();
+    for (;;) {
+        const uint32_t now = millis();
+        const float rpm = tachSensor.instantRpm();
+        uint8_t leds = composeAlarmLeds(shiftLight.isActive(rpm) ? shiftLight.ledMask(rpm, now) : g_pageLedMask,
+                                        g_warningLedMask, g_criticalLedMask);
+        char digits[12];
+        formatSegmentReadout(g_segmentReadout, digits, sizeof(digits));
+        if (isLowPowerMode()) {
+            leds = 0;
+            digits[0] = '\0';
+        }
 
-        case 0x10:  // Button 5
-            Serial.println("Button 5 pressed");
-            break;
+        uint8_t raw = 0;
+        {
+            Tm1638Lock lock;
+            {
+                DASH_PROFILE_ZONE(Buttons);
+                raw = tm1638.readButtons();
+            }
+            DASH_PROFILE_ZONE(Leds);
+            tm1638.setLeds(leds);
+            tm1638.showText(digits);  // only changed digits are rewritten
+            tm1638.flush();
+        }
+        buttonScanner.sample(raw, now);
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(kButtonScanIntervalMs));
+    }
+}
 
-        case 0x20:  // Button 6
-            Serial.println("Button 6 pressed");
+void handleButtonEvent(const ButtonEvent &event) {
+    // Bit 0 → Button 1 (left)
+    // Bit 7 → Button 8 (right)
+    switch (event.type) {
+        case ButtonEvent::Type::Press:
+            if (g_ignoreWakePress) {
+                // The press that woke the dash is not also a page change.
+                g_ignoreWakePress = false;
+                break;
+            }
+            pageRotation.noteUserInput(millis());
+            if (event.mask == 0x01) {
+                displayManager.previousPage();
+            } else if (event.mask == 0x02) {
+                displayManager.nextPage();
+            } else if (event.mask == 0x04) {
+                const auto next = static_cast<uint8_t>(g_segmentReadout) + 1;
+                g_segmentReadout = static_cast<SegmentReadout>(next % static_cast<uint8_t>(SegmentReadout::Count));
+            }
+            console.printf("Button %d pressed\n", __builtin_ctz(event.mask) + 1);
             break;
 
-        case 0x40:  // Button 7
-            Serial.println("Button 7 pressed");
+        case ButtonEvent::Type::LongPress:
+            // Any long press acknowledges the current alarms.
+            alarmEngine.acknowledge();
+            console.printf("Button %d held\n", __builtin_ctz(event.mask) + 1);
             break;
 
-        case 0x80:  // Button 8
-            Serial.println("Button 8 pressed");
+        case ButtonEvent::Type::Chord:
+            console.printf("Buttons 0x%02X pressed together\n", event.mask);
             break;
 
-        default:
-            Serial.println("Multiple buttons pressed");
+        case ButtonEvent::Type::Release:
             break;
     }
+}
 
-    // Optional: light the matching LED for feedback
-    for (uint8_t i = 0; i < 8; i++) {
-        tm1638.setLed(0, i);
+void handleTm1638Buttons() {
+    ButtonEvent event;
+    while (buttonScanner.poll(event)) {
+        handleButtonEvent(event);
     }
-    tm1638.setLed(1, g_currentDataPage);
 }
 
 
-void setup() {
-    Serial.begin(115200);
-    nanoSerial.begin(115200, SERIAL_8N1, cNanoRXPin, cNanoTXPin);
-
-    delay(1000);
-
-    pinMode(LIGHTS_PIN, OUTPUT);
-    digitalWrite(LIGHTS_PIN, LOW);
-
-    displayManager.addPage(&startupPage);
-    displayManager.addPage(&waterPage);
-    displayManager.addPage(&tachPage);
-    displayManager.begin();
-    displayManager.requestRefresh();
-    displayManager.loop();
-
-    String startupLog;
-    auto appendStartupMessage = [&](const __FlashStringHelper *message, uint32_t pauseMs) {
-        if (!startupLog.isEmpty()) {
-            startupLog += '\n';
-        }
-        startupLog += String(message);
-        startupPage.setBody(startupLog);
-        displayManager.requestRefresh();
-        displayManager.loop();
-        if (pauseMs > 0) {
-            delay(pauseMs);
-        }
-    };
-
-    appendStartupMessage(F("Powering display"), 1000);
-
-    if (!startupLog.isEmpty()) {
-        startupLog += '\n';
-    }
-    startupLog += F("Starting BLE");
-    startupPage.setBody(startupLog);
-    displayManager.requestRefresh();
-    displayManager.loop();
-
-    Serial.println("Starting BLE Server...");
+void startBle(void *) {
+    console.println("Starting BLE Server...");
 
     BLEDevice::init("ESP32-Control");
 
@@ -274,33 +877,121 @@ void setup() {
     pAdvertising->setMinPreferred(0x12);
     BLEDevice::startAdvertising();
 
-    delay(1000);  // keep the startup screen visible for the full 5 seconds
+    bootTimeline().mark(BootMilestone::BleReady);
+    g_bleReady = true;
+    vTaskDelete(nullptr);
+}
 
-    Serial.println("BLE device is ready, advertising as 'ESP32-Control'");
+void publishBootReport() {
+    char report[128];
+    bootTimeline().format(report, sizeof(report));
+    console.println("BLE device is ready, advertising as 'ESP32-Control'");
+    console.print(report);
+    startupPage.setBody(report);
+    if (displayManager.currentPageIndex() == 0) {
+        displayManager.requestRefresh();
+    }
+}
 
-    appendStartupMessage(F("Awaiting client"), 3000);
+void setup() {
+    bootTimeline().mark(BootMilestone::SetupStart);
+    Serial.begin(115200);
+    nanoSerial.begin(115200, SERIAL_8N1, cNanoRXPin, cNanoTXPin);
 
-    waterPage.setWaterTemp(85.0f);
-    waterPage.setStatusMessage("Awaiting client");
-    tachPage.setStatusMessage("Awaiting tach signal");
-    displayManager.showPage(kTachPageIndex);
-    displayManager.requestRefresh();
-    displayManager.loop();
+    // BLE bring-up takes several hundred ms; run it on the protocol core
+    // while this core brings up the sensors and the display.
+    xTaskCreatePinnedToCore(startBle, "bleInit", kBleInitStackBytes, nullptr, 1, nullptr, 0);
+
+    pinMode(LIGHTS_PIN, OUTPUT);
+    digitalWrite(LIGHTS_PIN, LOW);
 
+    pulseCapture.begin();
+    vehicleInputs.begin();
     waterSensor.begin();
     tachSensor.begin();
+    alarmEngine.reset(millis());
+    g_tm1638Mutex = xSemaphoreCreateMutex();
     tm1638.begin();
-    tm1638.setLed(1, 0);
+    // Higher priority than loop() so long frames never delay a key sample
+    xTaskCreatePinnedToCore(tm1638Task, "tm1638", kTm1638TaskStackBytes, nullptr, 2, nullptr, 1);
+    bootTimeline().mark(BootMilestone::SensorsReady);
+
+    waterPage.setStatusMessage("Awaiting client");
+    tachPage.setStatusMessage("Awaiting tach signal");
+
+#if DASH_STATIC_PAGES
+    displayManager.setPages(dashPages);
+#else
+    displayManager.addPage(&startupPage);
+    displayManager.addPage(&waterPage);
+    displayManager.addPage(&tachPage);
+    displayManager.addPage(&sweepTachPage);
+    displayManager.addPage(&multiGaugePage);
+#endif
+    pageRotation.addPage(kWaterPageIndex, kRotationCoolantChange);
+    pageRotation.addPage(kTachPageIndex, kRotationRpmChange);
+    pageRotation.addPage(kSweepTachPageIndex, kRotationRpmChange);
+    displayManager.setPageRotation(&pageRotation);
+    displayManager.showPage(kTachPageIndex);
+    displayManager.begin();
+    bootTimeline().mark(BootMilestone::DisplayReady);
+
+    // GaugesLive is marked by loop() on the first frame after the logo clears.
+    displayManager.showTransientImage(images::kBootLogo, kSplashDurationMs);
+    displayManager.loop();
 }
 
 void loop() {
-    updateSensors();
-    handleTm1638Buttons();
-    displayManager.loop();
+    handlePowerTransitions();
+    if (powerManager.state() == PowerState::Sleeping) {
+        // update() already light-slept for one slice; give the BLE and
+        // TM1638 tasks a moment before the next one.
+        handleSerialInput();
+        drainConsole();
+        delay(kLoopIdleMs);
+        return;
+    }
+    {
+        DASH_PROFILE_ZONE(Loop);
+        updateSensors();
+        updateAlarms();
+        handleTm1638Buttons();
+        handleVehicleInputs();
+        {
+            DASH_PROFILE_ZONE(DisplayLoop);
+            const uint32_t framesBefore = displayManager.framesDrawn();
+            displayManager.loop();
+            if (powerManager.state() == PowerState::Waking && displayManager.framesDrawn() != framesBefore) {
+                powerManager.noteFrameDrawn();
+                console.printf("Wake to first frame: %lu us\n",
+                               static_cast<unsigned long>(powerManager.lastWakeToFrameMicros()));
+            }
+            if (!bootTimeline().reached(BootMilestone::GaugesLive) &&
+                displayManager.framesDrawn() != framesBefore && !displayManager.hasTransient()) {
+                bootTimeline().mark(BootMilestone::GaugesLive);
+            }
+        }
+        // Light the LED for the page on screen, whether a button or the
+        // rotation chose it; the TM1638 task sends it.
+        g_pageLedMask = static_cast<uint8_t>(1U << displayManager.currentPageIndex());
+    }
+    handleSerialInput();
+    publishTelemetry(millis());
 
+    if (g_bleReady && !g_bootReportPublished) {
+        g_bootReportPublished = true;
+        publishBootReport();
+    }
+
+    // Echo everything from the Nano to the USB console.
     while (nanoSerial.available()) {
-        char c = nanoSerial.read();
-        Serial.write(c);   // echo everything from Nano to USB serial
+        char nanoBytes[32];
+        size_t nanoLength = 0;
+        while (nanoSerial.available() && nanoLength < sizeof(nanoBytes)) {
+            nanoBytes[nanoLength++] = nanoSerial.read();
+        }
+        console.write(nanoBytes, nanoLength);
     }
-    delay(50);
+    drainConsole();
+    delay(kLoopIdleMs);
 }
@@ -0,0 +1,65 @@
+#include "esp32_dash/power/PowerManager.h"
+
+PowerManager::PowerManager(const Config &config, PowerHal &hal) : config_(config), hal_(hal) {}
+
+PowerTransition PowerManager::update() {
+    switch (state_) {
+        case PowerState::Active:
+            wakeRequested_ = false;
+            if (!sleepRequested_) {
+                return PowerTransition::None;
+            }
+            if (hasWoken_ && (hal_.micros() - wokeAtMicros_) < config_.minAwakeMs * 1000UL) {
+                return PowerTransition::None;  // keep the request for a later loop
+            }
+            sleepRequested_ = false;
+            hal_.setDisplayAsleep(true);
+            hal_.setSlowAdvertising(true);
+            state_ = PowerState::Sleeping;
+            return PowerTransition::Slept;
+
+        case PowerState::Sleeping: {
+            sleepRequested_ = false;
+            if (wakeRequested_) {
+                wakeRequested_ = false;
+                return wake(WakeSource::Ble);
+            }
+            WakeSource source = hal_.lightSleep(config_.sleepSliceMs);
+            ++sleepSlices_;
+            if (source == WakeSource::Timer && hal_.buttonsHeld()) {
+                source = WakeSource::Button;
+            }
+            if (source == WakeSource::Timer || source == WakeSource::None) {
+                return PowerTransition::None;
+            }
+            return wake(source);
+        }
+
+        case PowerState::Waking:
+            if ((hal_.micros() - wokeAtMicros_) >= config_.maxWakingMs * 1000UL) {
+                lastWakeToFrameMicros_ = 0;
+                ++wakeTimeouts_;
+                state_ = PowerState::Active;
+            }
+            return PowerTransition::None;
+    }
+    return PowerTransition::None;
+}
+
+PowerTransition PowerManager::wake(WakeSource source) {
+    wokeAtMicros_ = hal_.micros();
+    hasWoken_ = true;
+    lastWakeSource_ = source;
+    hal_.setDisplayAsleep(false);
+    hal_.setSlowAdvertising(false);
+    state_ = PowerState::Waking;
+    return PowerTransition::Woke;
+}
+
+void PowerManager::noteFrameDrawn() {
+    if (state_ != PowerState::Waking) {
+        return;
+    }
+    lastWakeToFrameMicros_ = hal_.micros() - wokeAtMicros_;
+    state_ = PowerState::Active;
+}
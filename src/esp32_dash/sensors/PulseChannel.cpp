@@ -0,0 +1,194 @@
+#include "esp32_dash/sensors/PulseChannel.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include "driver/pcnt.h"
+#endif
+
+namespace {
+#if defined(ARDUINO_ARCH_ESP32)
+// The counter wraps to 0 on reaching this; reads must come at least this
+// many pulses apart, which at kHardwareSampleMicros is over 100 kHz.
+constexpr int16_t kPcntHighLimit = 32767;
+constexpr uint16_t kPcntFilterApbCycles = 1023;  // ~12.8 us glitch filter, the hardware maximum
+#endif
+}
+
+void PulseChannel::configure(const PulseChannelConfig &config) {
+    config_ = config;
+}
+
+bool PulseChannel::beginHardware(uint8_t unit) {
+#if defined(ARDUINO_ARCH_ESP32)
+    if (config_.backend != PulseBackend::Pcnt || unit >= PCNT_UNIT_MAX ||
+        config_.debounceMicros > kHardwareFilterMicros) {
+        return false;
+    }
+    pcnt_config_t pcnt = {};
+    pcnt.pulse_gpio_num = config_.pin;
+    pcnt.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+    pcnt.channel = PCNT_CHANNEL_0;
+    pcnt.unit = static_cast<pcnt_unit_t>(unit);
+    pcnt.pos_mode = config_.edge == FALLING ? PCNT_COUNT_DIS : PCNT_COUNT_INC;
+    pcnt.neg_mode = config_.edge == RISING ? PCNT_COUNT_DIS : PCNT_COUNT_INC;
+    pcnt.lctrl_mode = PCNT_MODE_KEEP;
+    pcnt.hctrl_mode = PCNT_MODE_KEEP;
+    pcnt.counter_h_lim = kPcntHighLimit;
+    pcnt.counter_l_lim = 0;
+    if (pcnt_unit_config(&pcnt) != ESP_OK) {
+        return false;
+    }
+    pcnt_set_filter_value(pcnt.unit, kPcntFilterApbCycles);
+    pcnt_filter_enable(pcnt.unit);
+    pcnt_counter_pause(pcnt.unit);
+    pcnt_counter_clear(pcnt.unit);
+    pcnt_counter_resume(pcnt.unit);
+    hardwareUnit_ = static_cast<int8_t>(unit);
+    lastRawCount_ = 0;
+    lastTakeMicros_ = micros();
+    return true;
+#else
+    (void) unit;
+    return false;
+#endif
+}
+
+uint32_t PulseChannel::readHardwareCount() {
+#if defined(ARDUINO_ARCH_ESP32)
+    const auto unit = static_cast<pcnt_unit_t>(hardwareUnit_);
+    int16_t count = 0;
+    if (pcnt_get_counter_value(unit, &count) != ESP_OK) {
+        return 0;
+    }
+    // Clearing here would lose pulses counted between the read and the
+    // clear, so the counter keeps running and only the difference is taken.
+    int32_t pulses = static_cast<int32_t>(count) - lastRawCount_;
+    if (pulses < 0) {
+        pulses += kPcntHighLimit;
+    }
+    lastRawCount_ = count;
+    return static_cast<uint32_t>(pulses);
+#else
+    return 0;
+#endif
+}
+
+void IRAM_ATTR PulseChannel::onEdge(uint32_t nowMicros) {
+    portENTER_CRITICAL_ISR(&mux_);
+    edgeCount_ = edgeCount_ + 1;
+    if (!enabled_) {
+        portEXIT_CRITICAL_ISR(&mux_);
+        return;
+    }
+    if (stored_ > 0) {
+        const uint8_t newest = (head_ + kHistory - 1) % kHistory;
+        const uint32_t delta = nowMicros - timestamps_[newest];
+        if (delta < config_.debounceMicros) {
+            rejectedCount_ = rejectedCount_ + 1;
+            portEXIT_CRITICAL_ISR(&mux_);
+            return;
+        }
+        lastPeriodMicros_ = delta;
+    }
+    timestamps_[head_] = nowMicros;
+    head_ = (head_ + 1) % kHistory;
+    if (stored_ < kHistory) {
+        stored_ = stored_ + 1;
+    }
+    pulseCount_ = pulseCount_ + 1;
+    portEXIT_CRITICAL_ISR(&mux_);
+}
+
+void PulseChannel::sampleHardware(uint32_t nowMicros) {
+    const uint32_t pulses = readHardwareCount();
+    const uint32_t elapsed = nowMicros - lastTakeMicros_;
+    portENTER_CRITICAL(&mux_);
+    if (enabled_) {
+        pulseCount_ = pulseCount_ + pulses;
+    }
+    if (pulses > 0) {
+        lastPeriodMicros_ = elapsed / pulses;
+        lastTakeMicros_ = nowMicros;
+    } else if (config_.staleMicros == 0 || elapsed > config_.staleMicros) {
+        lastPeriodMicros_ = 0;
+        lastTakeMicros_ = nowMicros;
+    }
+    // Otherwise keep the window open so a slow input still averages over a
+    // whole pulse instead of flickering between 0 and a short-window rate.
+    portEXIT_CRITICAL(&mux_);
+}
+
+bool PulseChannel::isStale(uint32_t nowMicros, uint32_t lastEdgeMicros) const {
+    return config_.staleMicros > 0 && (nowMicros - lastEdgeMicros) > config_.staleMicros;
+}
+
+uint32_t PulseChannel::takePulseCount() {
+    if (usesHardwareCounter()) {
+        sampleHardware(micros());
+    }
+    portENTER_CRITICAL(&mux_);
+    const uint32_t pulses = pulseCount_;
+    pulseCount_ = 0;
+    portEXIT_CRITICAL(&mux_);
+    return pulses;
+}
+
+PulseChannel::Snapshot PulseChannel::snapshot() {
+    Snapshot snapshot{0, 0};
+    portENTER_CRITICAL(&mux_);
+    if (stored_ > 0) {
+        snapshot.lastEdgeMicros = timestamps_[(head_ + kHistory - 1) % kHistory];
+    } else if (usesHardwareCounter()) {
+        snapshot.lastEdgeMicros = lastTakeMicros_;
+    }
+    snapshot.lastPeriodMicros = lastPeriodMicros_;
+    portEXIT_CRITICAL(&mux_);
+    return snapshot;
+}
+
+uint32_t PulseChannel::periodMicros(uint8_t intervals) {
+    const uint32_t now = micros();
+    if (usesHardwareCounter()) {
+        if ((now - lastTakeMicros_) >= kHardwareSampleMicros) {
+            sampleHardware(now);
+        }
+        return lastPeriodMicros_;
+    }
+    portENTER_CRITICAL(&mux_);
+    const uint8_t available = stored_ > 0 ? stored_ - 1 : 0;
+    if (intervals > available) {
+        intervals = available;
+    }
+    uint32_t period = 0;
+    if (intervals > 0) {
+        const uint8_t newest = (head_ + kHistory - 1) % kHistory;
+        const uint8_t oldest = (newest + kHistory - intervals) % kHistory;
+        period = isStale(now, timestamps_[newest]) ? 0 : (timestamps_[newest] - timestamps_[oldest]) / intervals;
+    }
+    portEXIT_CRITICAL(&mux_);
+    return period;
+}
+
+float PulseChannel::frequencyHz(uint8_t intervals) {
+    const uint32_t period = periodMicros(intervals);
+    return period > 0 ? 1000000.0f / static_cast<float>(period) : 0.0f;
+}
+
+void PulseChannel::setEnabled(bool enabled) {
+    portENTER_CRITICAL(&mux_);
+    enabled_ = enabled;
+    portEXIT_CRITICAL(&mux_);
+    reset();
+}
+
+void PulseChannel::reset() {
+    portENTER_CRITICAL(&mux_);
+    head_ = 0;
+    stored_ = 0;
+    pulseCount_ = 0;
+    lastPeriodMicros_ = 0;
+    portEXIT_CRITICAL(&mux_);
+    if (usesHardwareCounter()) {
+        readHardwareCount();
+        lastTakeMicros_ = micros();
+    }
+}
@@ -4,19 +4,19 @@
 
 #include "esp32_dash/display/DisplayManager.h"
 #include "esp32_dash/display/pages/TachPage.h"
+#include "esp32_dash/sensors/PulseChannel.h"
 
-TachSensor *TachSensor::instance_ = nullptr;
+namespace {
+constexpr uint32_t kInstantRpmTimeoutMicros = 100000;  // < 300 rpm reads as stopped
+}
 
-TachSensor::TachSensor(const Config &config, TachPage &page, DisplayManager &displayManager)
-        : config_(config), page_(page), displayManager_(displayManager) {}
+TachSensor::TachSensor(const Config &config, PulseChannel &channel, TachPage &page, DisplayManager &displayManager)
+        : config_(config), channel_(channel), page_(page), displayManager_(displayManager) {}
 
 void TachSensor::begin() {
-    pinMode(config_.signalPin, INPUT);
-    instance_ = this;
-    attachInterrupt(digitalPinToInterrupt(config_.signalPin), TachSensor::handlePulse, RISING);
+    channel_.reset();
     lastUpdateMs_ = 0;
     lastRpm_ = 0.0f;
-    lastPulseMicros_ = 0;
     enabled_ = true;
 }
 
@@ -31,11 +31,7 @@ void TachSensor::update() {
     const uint32_t elapsed = now - lastUpdateMs_;
     lastUpdateMs_ = now;
 
-    uint32_t pulses = 0;
-    portENTER_CRITICAL(&mux_);
-    pulses = pulseCount_;
-    pulseCount_ = 0;
-    portEXIT_CRITICAL(&mux_);
+    const uint32_t pulses = channel_.takePulseCount();
 
     float rpm = 0.0f;
     if (elapsed > 0 && pulses > 0) {
@@ -51,49 +47,41 @@ void TachSensor::update() {
             page_.setStatusMessage(F("Engine off"));
         } else if (rpm < 1200.0f) {
             page_.setStatusMessage(F("Idle"));
-        } else if (rpm > 5500.0f) {
-            page_.setStatusMessage(F("Shift pls"));
         } else {
+            // Shift point and over-rev belong to the shift light and alarm table.
             page_.setStatusMessage("");
         }
         displayManager_.requestRefresh();
     }
 }
 
-void IRAM_ATTR TachSensor::handlePulse() {
-    if (instance_ != nullptr) {
-        instance_->recordPulse();
-    }
-}
-
-void TachSensor::recordPulse() {
-    portENTER_CRITICAL_ISR(&mux_);
+float TachSensor::instantRpm() {
     if (!enabled_) {
-        portEXIT_CRITICAL_ISR(&mux_);
-        return;
+        return 0.0f;
     }
-    const uint32_t now = micros();
-    if (lastPulseMicros_ != 0) {
-        const uint32_t delta = now - lastPulseMicros_;
-        if (delta < config_.minPulseIntervalMicros) {
-            portEXIT_CRITICAL_ISR(&mux_);
-            return;
-        }
+    const PulseChannel::Snapshot pulse = channel_.snapshot();
+    uint32_t period = pulse.lastPeriodMicros;
+    if (pulse.lastEdgeMicros == 0 || period == 0) {
+        return 0.0f;
+    }
+    // If the next pulse is already overdue the true period is at least the
+    // time since the last one, so RPM falls off smoothly when the engine stops.
+    const uint32_t sinceLast = micros() - pulse.lastEdgeMicros;
+    if (sinceLast > period) {
+        period = sinceLast;
+    }
+    if (period >= kInstantRpmTimeoutMicros) {
+        return 0.0f;
     }
-    lastPulseMicros_ = now;
-    pulseCount_++;
-    portEXIT_CRITICAL_ISR(&mux_);
+    return 60000000.0f / (static_cast<float>(period) * config_.pulsesPerRevolution);
 }
 
 void TachSensor::setEnabled(bool enabled) {
     if (enabled_ == enabled) {
         return;
     }
-    portENTER_CRITICAL(&mux_);
     enabled_ = enabled;
-    pulseCount_ = 0;
-    lastPulseMicros_ = 0;
-    portEXIT_CRITICAL(&mux_);
+    channel_.setEnabled(enabled);
     if (!enabled) {
         lastRpm_ = 0.0f;
         page_.setRpm(0.0f);
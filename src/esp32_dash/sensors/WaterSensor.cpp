@@ -2,6 +2,7 @@
 
 #include <math.h>
 
+#include "esp32_dash/diagnostics/LoopProfiler.h"
 #include "esp32_dash/display/DisplayManager.h"
 #include "esp32_dash/display/pages/WaterTempPage.h"
 
@@ -22,6 +23,7 @@ WaterSensor::WaterSensor(const Config &config, WaterTempPage &page, DisplayManag
 void WaterSensor::begin() {
     pinMode(config_.analogPin, INPUT);
     lastSampleMs_ = 0;
+    lastReadingMs_ = 0;
     lastTempC_ = NAN;
     enabled_ = true;
 }
@@ -37,11 +39,17 @@ void WaterSensor::update() {
     lastSampleMs_ = now;
 
     float tempC = NAN;
-    if (!readWaterTemp(tempC)) {
+    bool valid = false;
+    {
+        DASH_PROFILE_ZONE(WaterRead);
+        valid = readWaterTemp(tempC);
+    }
+    if (!valid) {
         page_.setStatusMessage(F("Sensor error"));
         displayManager_.requestRefresh();
         return;
     }
+    lastReadingMs_ = now;
 
     if (isnan(lastTempC_) || fabsf(tempC - lastTempC_) >= config_.changeThresholdC) {
         lastTempC_ = tempC;
@@ -91,14 +99,9 @@ float WaterSensor::interpolateWaterTemp(float resistance) {
     return kMiataTempCurve[kPoints - 1].tempC;
 }
 
-String WaterSensor::describeWaterStatus(float tempC) {
-    if (tempC < 80.0f) {
-        return F("Warming up");
-    }
-    if (tempC < 105.0f) {
-        return F("");
-    }
-    return F("Hot!");
+// Over-temperature is left to the alarm table, which owns those thresholds.
+const char *WaterSensor::describeWaterStatus(float tempC) {
+    return tempC < 80.0f ? "Warming up" : "";
 }
 
 void WaterSensor::setEnabled(bool enabled) {
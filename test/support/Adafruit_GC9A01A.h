@@ -2,64 +2,94 @@
 
 #include <stdint.h>
 
-class Adafruit_GC9A01A {
+#include "Adafruit_GFX.h"
+
+// Host stand-in for the GC9A01A driver. Drawing is discarded, but calls are
+// counted so widget redraw decisions and SPI bursts can be asserted.
+class Adafruit_GC9A01A : public Adafruit_GFX {
 public:
     explicit Adafruit_GC9A01A(uint8_t csPin = 0, uint8_t dcPin = 0, uint8_t rstPin = 0)
-            : width_(240), height_(240) {
+            : Adafruit_GFX(240, 240),
+              fillRectCalls(0),
+              fillTriangleCalls(0),
+              printCalls(0),
+              addrWindowCalls(0),
+              pixelsWritten(0) {
         (void) csPin;
         (void) dcPin;
         (void) rstPin;
     }
 
-    int16_t width() const { return width_; }
-    int16_t height() const { return height_; }
-
-    void setTextSize(uint8_t size) { (void) size; }
-    void setTextWrap(bool wrap) { (void) wrap; }
-    void setTextColor(uint16_t color, uint16_t background) {
-        (void) color;
-        (void) background;
-    }
-    void setCursor(int16_t x, int16_t y) {
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
         (void) x;
         (void) y;
+        (void) color;
     }
-
-    void fillScreen(uint16_t color) { (void) color; }
-    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    void fillScreen(uint16_t color) override { (void) color; }
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
         (void) x;
         (void) y;
         (void) w;
         (void) h;
         (void) color;
+        ++fillRectCalls;
+    }
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override {
+        (void) x0;
+        (void) y0;
+        (void) x1;
+        (void) y1;
+        (void) color;
+    }
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      int16_t x2, int16_t y2, uint16_t color) override {
+        (void) x0;
+        (void) y0;
+        (void) x1;
+        (void) y1;
+        (void) x2;
+        (void) y2;
+        (void) color;
+        ++fillTriangleCalls;
     }
 
-    void getTextBounds(const char *text,
-                       int16_t x,
-                       int16_t y,
-                       int16_t *x1,
-                       int16_t *y1,
-                       uint16_t *w,
-                       uint16_t *h) {
-        (void) text;
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
         (void) x;
         (void) y;
-        if (x1) *x1 = 0;
-        if (y1) *y1 = 0;
-        if (w) *w = 0;
-        if (h) *h = 0;
+        (void) w;
+        (void) h;
+        ++addrWindowCalls;
+    }
+    void writePixels(uint16_t *colors, uint32_t length) {
+        (void) colors;
+        pixelsWritten += length;
     }
 
-    void print(const char *text) { (void) text; }
-    void print(const class String &text) { (void) text; }
+    void print(const char *text) override {
+        (void) text;
+        ++printCalls;
+    }
+    void print(const class String &text) override {
+        (void) text;
+        ++printCalls;
+    }
 
     void setDimensions(int16_t width, int16_t height) {
-        width_ = width;
-        height_ = height;
+        _width = width;
+        _height = height;
     }
 
-private:
-    int16_t width_;
-    int16_t height_;
-};
+    void resetCounters() {
+        fillRectCalls = 0;
+        fillTriangleCalls = 0;
+        printCalls = 0;
+        addrWindowCalls = 0;
+        pixelsWritten = 0;
+    }
 
+    uint32_t fillRectCalls;
+    uint32_t fillTriangleCalls;
+    uint32_t printCalls;
+    uint32_t addrWindowCalls;
+    uint32_t pixelsWritten;
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Host stand-in for Adafruit_GFX. Primitives funnel into drawPixel/fillRect
+// like the real library, so off-screen canvases can be exercised; text is
+// measured with the classic 6x8 font metrics but not rasterized.
+class Adafruit_GFX {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h), textSize_(1) {}
+    virtual ~Adafruit_GFX() = default;
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void startWrite() {}
+    virtual void endWrite() {}
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        for (int16_t row = y; row < y + h; ++row) {
+            for (int16_t col = x; col < x + w; ++col) {
+                drawPixel(col, row, color);
+            }
+        }
+    }
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        const int16_t dx = static_cast<int16_t>(abs(x1 - x0));
+        const int16_t dy = static_cast<int16_t>(-abs(y1 - y0));
+        const int16_t sx = x0 < x1 ? 1 : -1;
+        const int16_t sy = y0 < y1 ? 1 : -1;
+        int error = dx + dy;
+        while (true) {
+            drawPixel(x0, y0, color);
+            if (x0 == x1 && y0 == y1) {
+                break;
+            }
+            const int twice = 2 * error;
+            if (twice >= dy) {
+                error += dy;
+                x0 = static_cast<int16_t>(x0 + sx);
+            }
+            if (twice <= dx) {
+                error += dx;
+                y0 = static_cast<int16_t>(y0 + sy);
+            }
+        }
+    }
+    virtual void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                              int16_t x2, int16_t y2, uint16_t color) {
+        (void) x0;
+        (void) y0;
+        (void) x1;
+        (void) y1;
+        (void) x2;
+        (void) y2;
+        (void) color;
+    }
+
+    void setTextSize(uint8_t size) { textSize_ = size ? size : 1; }
+    void setTextWrap(bool wrap) { (void) wrap; }
+    void setTextColor(uint16_t color) { (void) color; }
+    void setTextColor(uint16_t color, uint16_t background) {
+        (void) color;
+        (void) background;
+    }
+    void setCursor(int16_t x, int16_t y) {
+        (void) x;
+        (void) y;
+    }
+
+    void getTextBounds(const char *text,
+                       int16_t x,
+                       int16_t y,
+                       int16_t *x1,
+                       int16_t *y1,
+                       uint16_t *w,
+                       uint16_t *h) {
+        const size_t length = text ? strlen(text) : 0;
+        if (x1) *x1 = x;
+        if (y1) *y1 = y;
+        if (w) *w = static_cast<uint16_t>(length * 6 * textSize_);
+        if (h) *h = length ? static_cast<uint16_t>(8 * textSize_) : 0;
+    }
+
+    virtual void print(const char *text) { (void) text; }
+    virtual void print(const class String &text) { (void) text; }
+
+protected:
+    int16_t _width;
+    int16_t _height;
+    uint8_t textSize_;
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <stddef.h>
+
+// The native build replaces the global operator new/delete with counting
+// versions; tests reset the counter around the code under test.
+size_t allocationCount();
+void resetAllocationCount();
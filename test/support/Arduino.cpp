@@ -1,10 +1,20 @@
 #include "Arduino.h"
 
+#include "SimKernel.h"
+
 #include <cstddef>
+#include <map>
 #include <vector>
 
 namespace {
-unsigned long currentMillis = 0;
+unsigned long currentMicros = 0;
+struct Interrupt {
+    void (*handler)();
+    int mode;
+};
+
+std::map<int, Interrupt> interruptHandlers;
+std::map<int, int> digitalLevels;
 std::vector<int> analogValues;
 size_t analogIndex = 0;
 }
@@ -12,15 +22,27 @@ size_t analogIndex = 0;
 HardwareSerial Serial(0);
 
 unsigned long millis() {
-    return currentMillis;
+    return currentMicros / 1000UL;
+}
+
+unsigned long micros() {
+    return currentMicros;
 }
 
 void setMillis(unsigned long value) {
-    currentMillis = value;
+    currentMicros = value * 1000UL;
 }
 
 void advanceMillis(unsigned long delta) {
-    currentMillis += delta;
+    advanceMicros(delta * 1000UL);
+}
+
+void setMicros(unsigned long value) {
+    currentMicros = value;
+}
+
+void advanceMicros(unsigned long delta) {
+    sim::runUntil(currentMicros + delta);
 }
 
 int analogRead(uint8_t) {
@@ -36,3 +58,45 @@ void setAnalogReadSequence(const std::vector<int> &values) {
     analogValues = values;
     analogIndex = 0;
 }
+
+int digitalRead(uint8_t pin) {
+    const auto it = digitalLevels.find(pin);
+    return it == digitalLevels.end() ? LOW : it->second;
+}
+
+void setDigitalLevel(int pin, int level) {
+    digitalLevels[pin] = level;
+}
+
+void attachInterrupt(int interrupt, void (*handler)(), int mode) {
+    interruptHandlers[interrupt] = Interrupt{handler, mode};
+}
+
+void detachInterrupt(int interrupt) {
+    interruptHandlers.erase(interrupt);
+}
+
+bool triggerInterrupt(int pin) {
+    const auto it = interruptHandlers.find(digitalPinToInterrupt(pin));
+    if (it == interruptHandlers.end() || !it->second.handler) {
+        return false;
+    }
+    it->second.handler();
+    return true;
+}
+
+void driveLevel(int pin, int level) {
+    const int previous = digitalRead(static_cast<uint8_t>(pin));
+    setDigitalLevel(pin, level);
+    if (previous == level) {
+        return;
+    }
+    const auto it = interruptHandlers.find(digitalPinToInterrupt(pin));
+    if (it == interruptHandlers.end() || !it->second.handler) {
+        return;
+    }
+    const int mode = it->second.mode;
+    if (mode == CHANGE || (mode == RISING && level == HIGH) || (mode == FALLING && level == LOW)) {
+        it->second.handler();
+    }
+}
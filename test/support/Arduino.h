@@ -1,81 +1,174 @@
 #pragma once
 
+#include <math.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <deque>
 #include <string>
 #include <vector>
 
 using byte = uint8_t;
-using __FlashStringHelper = char;
+class __FlashStringHelper;
 
 #define IRAM_ATTR
 #define F(str_literal) reinterpret_cast<const __FlashStringHelper *>(str_literal)
 
+// Like Arduino's String, every non-empty value lives in its own heap
+// buffer, so the allocation counter sees exactly what the firmware would.
 class String {
 public:
     String() = default;
-    String(const char *cstr) : data_(cstr ? cstr : "") {}
-    String(const std::string &str) : data_(str) {}
-    String(const __FlashStringHelper *flashStr) : data_(flashStr ? reinterpret_cast<const char *>(flashStr) : "") {}
-
-    bool isEmpty() const { return data_.empty(); }
-    const char *c_str() const { return data_.c_str(); }
-
-    String &operator+=(const char *rhs) {
-        if (rhs) {
-            data_ += rhs;
+    String(const char *cstr) { assign(cstr); }
+    String(const std::string &str) { assign(str.c_str()); }
+    String(const __FlashStringHelper *flashStr) { assign(reinterpret_cast<const char *>(flashStr)); }
+    String(const String &other) { assign(other.data_); }
+    String(String &&other) noexcept : data_(other.data_) { other.data_ = nullptr; }
+    ~String() { delete[] data_; }
+
+    String &operator=(const String &rhs) {
+        if (this != &rhs) {
+            assign(rhs.data_);
         }
         return *this;
     }
 
-    String &operator+=(const String &rhs) {
-        data_ += rhs.data_;
+    String &operator=(String &&rhs) noexcept {
+        if (this != &rhs) {
+            delete[] data_;
+            data_ = rhs.data_;
+            rhs.data_ = nullptr;
+        }
         return *this;
     }
 
     String &operator=(const char *rhs) {
-        data_ = rhs ? rhs : "";
+        assign(rhs);
         return *this;
     }
 
+    bool isEmpty() const { return !data_ || data_[0] == '\0'; }
+    const char *c_str() const { return data_ ? data_ : ""; }
+
+    String &operator+=(const char *rhs) {
+        if (rhs && rhs[0] != '\0') {
+            assign((std::string(c_str()) + rhs).c_str());
+        }
+        return *this;
+    }
+
+    String &operator+=(const String &rhs) {
+        return *this += rhs.c_str();
+    }
+
     bool operator==(const char *rhs) const {
-        return data_ == (rhs ? rhs : "");
+        return std::string(c_str()) == (rhs ? rhs : "");
     }
 
     bool operator==(const String &rhs) const {
-        return data_ == rhs.data_;
+        return *this == rhs.c_str();
     }
 
-    std::string toStdString() const { return data_; }
+    std::string toStdString() const { return c_str(); }
 
 private:
-    std::string data_;
+    void assign(const char *cstr) {
+        char *next = nullptr;
+        if (cstr && cstr[0] != '\0') {
+            const size_t length = std::char_traits<char>::length(cstr);
+            next = new char[length + 1];
+            std::char_traits<char>::copy(next, cstr, length + 1);
+        }
+        delete[] data_;
+        data_ = next;
+    }
+
+    char *data_ = nullptr;
 };
 
+// Virtual clock. Advancing it runs any events scheduled with SimKernel.h
+// on the way; setting it jumps without running them.
 unsigned long millis();
+unsigned long micros();
 void setMillis(unsigned long value);
 void advanceMillis(unsigned long delta);
+void setMicros(unsigned long value);
+void advanceMicros(unsigned long delta);
 
 int analogRead(uint8_t pin);
 void setAnalogReadSequence(const std::vector<int> &values);
 
 inline void pinMode(int, int) {}
+// Pins read LOW until a test sets them.
+int digitalRead(uint8_t pin);
+void setDigitalLevel(int pin, int level);
 inline void delay(unsigned long ms) { advanceMillis(ms); }
-inline void delayMicroseconds(unsigned int) {}
-
+inline void delayMicroseconds(unsigned int us) { advanceMicros(us); }
+
+constexpr int RISING = 1;
+constexpr int FALLING = 2;
+constexpr int CHANGE = 3;
+
+inline int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(int interrupt, void (*handler)(), int mode);
+void detachInterrupt(int interrupt);
+// Runs the handler attached to \c pin, as if its edge had arrived.
+bool triggerInterrupt(int pin);
+// Moves \c pin to \c level and runs its handler if the attach mode
+// (RISING, FALLING or CHANGE) matches the transition.
+void driveLevel(int pin, int level);
+
+using portMUX_TYPE = int;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) (void) (mux)
+#define portEXIT_CRITICAL(mux) (void) (mux)
+#define portENTER_CRITICAL_ISR(mux) (void) (mux)
+#define portEXIT_CRITICAL_ISR(mux) (void) (mux)
+
+// Host UART. Received bytes come from \c receive (SimKernel schedules them
+// at the line rate); everything written is kept for assertions.
 class HardwareSerial {
 public:
     explicit HardwareSerial(int) {}
     void begin(int, int = 0, int = -1, int = -1) {}
-    void println(const char *) {}
-    void print(const char *) {}
-    bool available() const { return false; }
-    char read() { return 0; }
-    void write(char) {}
+    void println(const char *text) {
+        print(text);
+        write('\n');
+    }
+    void print(const char *text) { output_ += text; }
+    int available() const { return static_cast<int>(input_.size()); }
+    int read() {
+        if (input_.empty()) {
+            return -1;
+        }
+        const char c = input_.front();
+        input_.pop_front();
+        return static_cast<unsigned char>(c);
+    }
+    int availableForWrite() const { return 128; }
+    size_t write(char c) {
+        output_ += c;
+        return 1;
+    }
+    size_t write(const uint8_t *data, size_t length) {
+        output_.append(reinterpret_cast<const char *>(data), length);
+        return length;
+    }
+    void flush() {}
+
+    void receive(char c) { input_.push_back(c); }
+    const std::string &output() const { return output_; }
+    void clearOutput() { output_.clear(); }
+
+private:
+    std::deque<char> input_;
+    std::string output_;
 };
 
 extern HardwareSerial Serial;
 
 constexpr int INPUT = 0;
 constexpr int OUTPUT = 1;
+constexpr int INPUT_PULLUP = 2;
+constexpr int LOW = 0;
+constexpr int HIGH = 1;
 constexpr int SERIAL_8N1 = 0;
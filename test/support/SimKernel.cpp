@@ -0,0 +1,125 @@
+#include "SimKernel.h"
+
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace {
+struct Event {
+    unsigned long atMicros;
+    unsigned long long sequence;
+    std::function<void()> action;
+};
+
+struct Later {
+    bool operator()(const Event &a, const Event &b) const {
+        if (a.atMicros != b.atMicros) {
+            return a.atMicros > b.atMicros;
+        }
+        return a.sequence > b.sequence;
+    }
+};
+
+std::priority_queue<Event, std::vector<Event>, Later> events;
+unsigned long long nextSequence = 0;
+unsigned long long runCount = 0;
+
+void runEvent() {
+    Event event = events.top();
+    events.pop();
+    if (event.atMicros > micros()) {
+        setMicros(event.atMicros);
+    }
+    ++runCount;
+    event.action();
+}
+
+struct PulseTrain {
+    int pin;
+    unsigned long periodMicros;
+    unsigned long remaining;
+    unsigned long widthMicros;
+};
+
+void schedulePulse(const std::shared_ptr<PulseTrain> &train, unsigned long atMicros) {
+    sim::at(atMicros, [train, atMicros]() {
+        driveLevel(train->pin, HIGH);
+        sim::level(train->pin, atMicros + train->widthMicros, LOW);
+        if (--train->remaining > 0) {
+            schedulePulse(train, atMicros + train->periodMicros);
+        }
+    });
+}
+}
+
+namespace sim {
+
+void reset(unsigned long startMicros) {
+    events = {};
+    nextSequence = 0;
+    runCount = 0;
+    setMicros(startMicros);
+}
+
+void at(unsigned long atMicros, std::function<void()> action) {
+    events.push(Event{atMicros, nextSequence++, std::move(action)});
+}
+
+void level(int pin, unsigned long atMicros, int value) {
+    at(atMicros, [pin, value]() { driveLevel(pin, value); });
+}
+
+void pulseTrain(int pin, unsigned long firstMicros, unsigned long periodMicros,
+                unsigned long count, unsigned long widthMicros) {
+    if (count == 0) {
+        return;
+    }
+    schedulePulse(std::make_shared<PulseTrain>(PulseTrain{pin, periodMicros, count, widthMicros}), firstMicros);
+}
+
+void uart(HardwareSerial &port, unsigned long startMicros, const std::string &bytes, unsigned long baud) {
+    const unsigned long characterMicros = (10UL * 1000000UL + baud - 1) / baud;
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        const char c = bytes[i];
+        at(startMicros + (i + 1) * characterMicros, [&port, c]() { port.receive(c); });
+    }
+}
+
+size_t pending() {
+    return events.size();
+}
+
+bool nextEventMicros(unsigned long &atMicros) {
+    if (events.empty()) {
+        return false;
+    }
+    atMicros = events.top().atMicros;
+    return true;
+}
+
+bool runNext() {
+    if (events.empty()) {
+        return false;
+    }
+    runEvent();
+    return true;
+}
+
+void runUntil(unsigned long targetMicros) {
+    while (!events.empty() && events.top().atMicros <= targetMicros) {
+        runEvent();
+    }
+    if (targetMicros > micros()) {
+        setMicros(targetMicros);
+    }
+}
+
+void runFor(unsigned long deltaMicros) {
+    runUntil(micros() + deltaMicros);
+}
+
+unsigned long long eventsRun() {
+    return runCount;
+}
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "Arduino.h"
+
+/**
+ * Discrete-event simulation on the virtual clock behind micros().
+ *
+ * Events are scheduled at absolute microsecond times and run in time order,
+ * ties in the order they were scheduled, whenever the clock moves forward:
+ * through advanceMicros()/delay() in the code under test or through
+ * runUntil()/runNext() here. Each event runs with the clock at its own
+ * time, so ISRs it triggers timestamp themselves correctly. Nothing waits
+ * on the wall clock; a minute of driving runs in milliseconds.
+ */
+namespace sim {
+
+// Drops every pending event and sets the clock.
+void reset(unsigned long startMicros = 0);
+
+void at(unsigned long atMicros, std::function<void()> action);
+// Drives \c pin to \c level at \c atMicros, running its ISR if the edge matches.
+void level(int pin, unsigned long atMicros, int level);
+// \c count HIGH pulses of \c widthMicros, one every \c periodMicros. Each
+// pulse schedules the next, so long trains cost one pending event.
+void pulseTrain(int pin, unsigned long firstMicros, unsigned long periodMicros,
+                unsigned long count, unsigned long widthMicros);
+// Delivers \c bytes to \c port one character time (10 bits at \c baud) apart.
+void uart(HardwareSerial &port, unsigned long startMicros, const std::string &bytes, unsigned long baud);
+
+size_t pending();
+bool nextEventMicros(unsigned long &atMicros);
+// Jumps the clock to the next event and runs it. False when none is left.
+bool runNext();
+// Runs everything due up to \c targetMicros, then leaves the clock there.
+void runUntil(unsigned long targetMicros);
+void runFor(unsigned long deltaMicros);
+unsigned long long eventsRun();
+
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <deque>
+#include <vector>
+
+// Host stand-in for ESP-IDF's spi_master. Queued transactions complete in
+// order as their results are taken; every transaction is recorded with its
+// bytes so tests can check what would have gone out on the wire.
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_ERR_TIMEOUT 0x107
+#ifndef portMAX_DELAY
+#define portMAX_DELAY 0xFFFFFFFFu
+#endif
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+
+struct spi_transaction_t {
+    uint32_t flags;
+    uint16_t cmd;
+    uint64_t addr;
+    size_t length;  // bits
+    size_t rxlength;
+    void *user;
+    union {
+        const void *tx_buffer;
+        uint8_t tx_data[4];
+    };
+    union {
+        void *rx_buffer;
+        uint8_t rx_data[4];
+    };
+};
+
+struct spi_device_t;
+typedef spi_device_t *spi_device_handle_t;
+
+namespace fake_spi {
+struct Sent {
+    bool polled;
+    bool data;  // D/C level from transaction.user
+    const void *buffer;  // nullptr for SPI_TRANS_USE_TXDATA
+    std::vector<uint8_t> bytes;
+};
+
+struct Pending {
+    spi_transaction_t *transaction;
+    size_t sentIndex;
+};
+
+struct State {
+    std::deque<Pending> pending;
+    std::vector<Sent> sent;
+    uint32_t resultsTaken = 0;
+    size_t maxPending = 0;
+    uint32_t overwrittenInFlight = 0;  // tx_buffer changed between queueing and completion
+    uint32_t polledWhilePending = 0;   // spi_master forbids mixing the two
+};
+
+inline State state;
+
+inline void reset() { state = State(); }
+inline spi_device_handle_t device() { return reinterpret_cast<spi_device_handle_t>(&state); }
+
+inline void record(const spi_transaction_t *transaction, bool polled) {
+    Sent sent{polled, (reinterpret_cast<uintptr_t>(transaction->user) & 1) != 0, nullptr, {}};
+    const size_t bytes = transaction->length / 8;
+    const uint8_t *source = transaction->tx_data;
+    if (!(transaction->flags & SPI_TRANS_USE_TXDATA)) {
+        sent.buffer = transaction->tx_buffer;
+        source = static_cast<const uint8_t *>(transaction->tx_buffer);
+    }
+    sent.bytes.assign(source, source + bytes);
+    state.sent.push_back(sent);
+}
+}
+
+inline esp_err_t spi_device_queue_trans(spi_device_handle_t, spi_transaction_t *transaction, uint32_t) {
+    fake_spi::record(transaction, false);
+    fake_spi::state.pending.push_back({transaction, fake_spi::state.sent.size() - 1});
+    if (fake_spi::state.pending.size() > fake_spi::state.maxPending) {
+        fake_spi::state.maxPending = fake_spi::state.pending.size();
+    }
+    return ESP_OK;
+}
+
+inline esp_err_t spi_device_get_trans_result(spi_device_handle_t, spi_transaction_t **transaction, uint32_t) {
+    if (fake_spi::state.pending.empty()) {
+        *transaction = nullptr;
+        return ESP_ERR_TIMEOUT;
+    }
+    const fake_spi::Pending done = fake_spi::state.pending.front();
+    fake_spi::state.pending.pop_front();
+    // The DMA engine reads the buffer while the transaction is in flight, so
+    // it must still hold what was queued.
+    const fake_spi::Sent &sent = fake_spi::state.sent[done.sentIndex];
+    if (sent.buffer && memcmp(sent.buffer, sent.bytes.data(), sent.bytes.size()) != 0) {
+        ++fake_spi::state.overwrittenInFlight;
+    }
+    *transaction = done.transaction;
+    ++fake_spi::state.resultsTaken;
+    return ESP_OK;
+}
+
+inline esp_err_t spi_device_polling_transmit(spi_device_handle_t, spi_transaction_t *transaction) {
+    if (!fake_spi::state.pending.empty()) {
+        ++fake_spi::state.polledWhilePending;
+    }
+    fake_spi::record(transaction, true);
+    return ESP_OK;
+}
@@ -9,7 +9,30 @@ public:
     bool isSuspended() const { return suspended_; }
     bool isReady() const { return true; }
 
+    // Records the overlay instead of drawing it; timed messages lapse on the
+    // virtual clock like the real manager's do in loop().
+    void showTransientMessage(const String &message, uint32_t durationMs = 1000,
+                              uint16_t textColor = 0xFFFF, uint16_t backgroundColor = 0x0000) {
+        (void) textColor;
+        transientText = message;
+        transientDurationMs = durationMs;
+        transientBackground = backgroundColor;
+        transientShownAt = millis();
+        transientActive = !message.isEmpty();
+        ++transientCount;
+    }
+    bool hasTransient() const {
+        return transientActive && (transientDurationMs == 0 || millis() - transientShownAt < transientDurationMs);
+    }
+    void dropTransient() { transientActive = false; }
+
     bool refreshRequested = false;
+    String transientText;
+    uint32_t transientDurationMs = 0;
+    uint16_t transientBackground = 0;
+    uint32_t transientShownAt = 0;
+    bool transientActive = false;
+    uint32_t transientCount = 0;
 
 private:
     bool suspended_ = false;
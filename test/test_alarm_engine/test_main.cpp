@@ -0,0 +1,157 @@
+#include <unity.h>
+
+#include "esp32_dash/alarms/AlarmEngine.h"
+
+namespace {
+constexpr AlarmRule kRules[] = {
+        {"Coolant warm", AlarmSignal::CoolantC, AlarmKind::Above, AlarmSeverity::Warning, 105.0f, 102.0f, false, 0x80},
+        {"COOLANT HOT", AlarmSignal::CoolantC, AlarmKind::Above, AlarmSeverity::Critical, 110.0f, 106.0f, false, 0x81},
+        {"OVER-REV", AlarmSignal::Rpm, AlarmKind::Above, AlarmSeverity::Critical, 7200.0f, 6800.0f, true, 0xFF},
+        {"Coolant rising", AlarmSignal::CoolantC, AlarmKind::RisingFaster, AlarmSeverity::Warning, 1.0f, 0.2f, false, 0x40},
+        {"No coolant temp", AlarmSignal::CoolantC, AlarmKind::Stale, AlarmSeverity::Warning, 5000.0f, 0.0f, false, 0x20},
+};
+constexpr size_t kWarm = 0;
+constexpr size_t kHot = 1;
+constexpr size_t kOverRev = 2;
+constexpr size_t kRising = 3;
+constexpr size_t kStale = 4;
+}
+
+void test_threshold_trips_with_hysteresis() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+
+    engine.sample(AlarmSignal::CoolantC, 104.0f, 1000);
+    TEST_ASSERT_FALSE(engine.isActive(kWarm));
+    engine.sample(AlarmSignal::CoolantC, 105.0f, 11000);
+    TEST_ASSERT_TRUE(engine.isActive(kWarm));
+    TEST_ASSERT_TRUE(engine.takeChanged());
+
+    // Inside the hysteresis band the alarm holds and nothing is reported.
+    engine.sample(AlarmSignal::CoolantC, 103.0f, 21000);
+    TEST_ASSERT_TRUE(engine.isActive(kWarm));
+    TEST_ASSERT_FALSE(engine.takeChanged());
+
+    engine.sample(AlarmSignal::CoolantC, 102.0f, 31000);
+    TEST_ASSERT_FALSE(engine.isActive(kWarm));
+    TEST_ASSERT_TRUE(engine.takeChanged());
+}
+
+void test_critical_outranks_warning() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+    TEST_ASSERT_NULL(engine.highestActive());
+
+    engine.sample(AlarmSignal::CoolantC, 106.0f, 10000);
+    TEST_ASSERT_EQUAL_STRING("Coolant warm", engine.highestActive()->message);
+    engine.sample(AlarmSignal::CoolantC, 111.0f, 20000);
+    TEST_ASSERT_EQUAL_STRING("COOLANT HOT", engine.highestActive()->message);
+    TEST_ASSERT_EQUAL_HEX8(0x81, engine.ledMask());
+}
+
+void test_latching_alarm_holds_until_acknowledged() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+
+    engine.sample(AlarmSignal::Rpm, 7300.0f, 10);
+    engine.sample(AlarmSignal::Rpm, 3000.0f, 20);
+    TEST_ASSERT_TRUE(engine.isActive(kOverRev));
+    TEST_ASSERT_EQUAL_STRING("OVER-REV", engine.highestActive()->message);
+
+    engine.takeChanged();
+    engine.acknowledge();
+    TEST_ASSERT_FALSE(engine.isActive(kOverRev));
+    TEST_ASSERT_TRUE(engine.takeChanged());
+}
+
+void test_acknowledge_hides_tripping_alarm_but_keeps_leds() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+    engine.sample(AlarmSignal::Rpm, 7500.0f, 10);
+    engine.acknowledge();
+
+    TEST_ASSERT_TRUE(engine.isActive(kOverRev));
+    TEST_ASSERT_NULL(engine.highestActive());
+    TEST_ASSERT_EQUAL_HEX8(0xFF, engine.ledMask());
+
+    // Once acknowledged it does not latch; tripping again shows it afresh.
+    engine.sample(AlarmSignal::Rpm, 6000.0f, 20);
+    TEST_ASSERT_FALSE(engine.isActive(kOverRev));
+    engine.sample(AlarmSignal::Rpm, 7400.0f, 30);
+    TEST_ASSERT_EQUAL_STRING("OVER-REV", engine.highestActive()->message);
+}
+
+void test_rate_of_change_is_measured_over_the_window() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+    engine.sample(AlarmSignal::CoolantC, 80.0f, 1000);
+    // A 0.5 C step within half a second is quantisation, not a 1 C/s climb.
+    engine.sample(AlarmSignal::CoolantC, 80.5f, 1500);
+    TEST_ASSERT_FALSE(engine.isActive(kRising));
+    engine.sample(AlarmSignal::CoolantC, 84.0f, 6000);  // 0.8 C/s
+    TEST_ASSERT_FALSE(engine.isActive(kRising));
+    engine.sample(AlarmSignal::CoolantC, 90.0f, 11000);  // 1.2 C/s
+    TEST_ASSERT_TRUE(engine.isActive(kRising));
+    engine.sample(AlarmSignal::CoolantC, 90.5f, 16000);  // 0.1 C/s
+    TEST_ASSERT_FALSE(engine.isActive(kRising));
+}
+
+void test_stale_signal_trips_and_clears_on_next_sample() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+    engine.checkStale(4999);
+    TEST_ASSERT_FALSE(engine.isActive(kStale));
+    engine.checkStale(5000);
+    TEST_ASSERT_TRUE(engine.isActive(kStale));
+
+    engine.sample(AlarmSignal::CoolantC, 90.0f, 6000);
+    TEST_ASSERT_FALSE(engine.isActive(kStale));
+    engine.checkStale(10999);
+    TEST_ASSERT_FALSE(engine.isActive(kStale));
+    engine.checkStale(11000);
+    TEST_ASSERT_TRUE(engine.isActive(kStale));
+}
+
+void test_reset_drops_active_alarms() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+    engine.sample(AlarmSignal::CoolantC, 115.0f, 100);
+    engine.takeChanged();
+
+    engine.reset(200);
+    TEST_ASSERT_FALSE(engine.isActive(kHot));
+    TEST_ASSERT_EQUAL_HEX8(0x00, engine.ledMask());
+    TEST_ASSERT_TRUE(engine.takeChanged());
+}
+
+void test_warnings_add_to_the_shift_light_criticals_replace_it() {
+    AlarmEngine engine(kRules);
+    engine.reset(0);
+    engine.checkStale(6000);  // "No coolant temp" holds while the sender is open
+    TEST_ASSERT_EQUAL_HEX8(0x20, engine.ledMask(AlarmSeverity::Warning));
+    TEST_ASSERT_EQUAL_HEX8(0x00, engine.ledMask(AlarmSeverity::Critical));
+    const uint8_t shiftLeds = 0x0F;
+    TEST_ASSERT_EQUAL_HEX8(0x2F, composeAlarmLeds(shiftLeds, engine.ledMask(AlarmSeverity::Warning),
+                                                  engine.ledMask(AlarmSeverity::Critical)));
+
+    engine.sample(AlarmSignal::Rpm, 7300.0f, 6100);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, engine.ledMask(AlarmSeverity::Critical));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, composeAlarmLeds(0x01, engine.ledMask(AlarmSeverity::Warning),
+                                                  engine.ledMask(AlarmSeverity::Critical)));
+    TEST_ASSERT_EQUAL_HEX8(0x01, composeAlarmLeds(0x01, 0x00, 0x00));
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_threshold_trips_with_hysteresis);
+    RUN_TEST(test_critical_outranks_warning);
+    RUN_TEST(test_latching_alarm_holds_until_acknowledged);
+    RUN_TEST(test_acknowledge_hides_tripping_alarm_but_keeps_leds);
+    RUN_TEST(test_rate_of_change_is_measured_over_the_window);
+    RUN_TEST(test_stale_signal_trips_and_clears_on_next_sample);
+    RUN_TEST(test_reset_drops_active_alarms);
+    RUN_TEST(test_warnings_add_to_the_shift_light_criticals_replace_it);
+    return UNITY_END();
+}
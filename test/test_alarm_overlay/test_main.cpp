@@ -0,0 +1,106 @@
+#include <unity.h>
+
+#include "Arduino.h"
+#include "esp32_dash/alarms/AlarmEngine.h"
+#include "esp32_dash/alarms/AlarmOverlay.h"
+#include "esp32_dash/display/DisplayManager.h"
+
+namespace {
+constexpr AlarmRule kRules[] = {
+        {"OVER-REV", AlarmSignal::Rpm, AlarmKind::Above, AlarmSeverity::Critical, 7200.0f, 6800.0f, true, 0xFF},
+        {"Coolant warm", AlarmSignal::CoolantC, AlarmKind::Above, AlarmSeverity::Warning, 105.0f, 102.0f, false, 0x80},
+};
+
+constexpr AlarmOverlay::Config kConfig{
+        .warningMs = 3000,
+        .statusMs = 2000,
+        .criticalBackground = 0xF800,
+        .warningBackground = 0xFD20,
+};
+}
+
+void test_status_message_does_not_displace_critical_alarm() {
+    setMillis(0);
+    AlarmEngine engine(kRules);
+    DisplayManager display;
+    AlarmOverlay overlay(kConfig, engine, display);
+    engine.reset(0);
+
+    engine.sample(AlarmSignal::Rpm, 7300.0f, 10);
+    overlay.update(engine.takeChanged());
+    TEST_ASSERT_EQUAL_STRING("OVER-REV", display.transientText.c_str());
+    TEST_ASSERT_EQUAL_UINT32(0, display.transientDurationMs);
+    TEST_ASSERT_EQUAL_HEX16(0xF800, display.transientBackground);
+
+    // BLE reconnect, lights, unknown commands: none may cover the alarm.
+    TEST_ASSERT_FALSE(overlay.showStatus("Connected"));
+    TEST_ASSERT_FALSE(overlay.showStatus("Lights ON"));
+    TEST_ASSERT_EQUAL_STRING("OVER-REV", display.transientText.c_str());
+
+    advanceMillis(10000);
+    overlay.update(engine.takeChanged());
+    TEST_ASSERT_TRUE(display.hasTransient());
+    TEST_ASSERT_EQUAL_STRING("OVER-REV", display.transientText.c_str());
+}
+
+void test_dropped_critical_overlay_is_reasserted() {
+    setMillis(0);
+    AlarmEngine engine(kRules);
+    DisplayManager display;
+    AlarmOverlay overlay(kConfig, engine, display);
+    engine.reset(0);
+
+    engine.sample(AlarmSignal::Rpm, 7300.0f, 10);
+    overlay.update(engine.takeChanged());
+    display.dropTransient();  // e.g. cleared by a sleep/wake cycle
+
+    overlay.update(engine.takeChanged());
+    TEST_ASSERT_TRUE(display.hasTransient());
+    TEST_ASSERT_EQUAL_STRING("OVER-REV", display.transientText.c_str());
+}
+
+void test_status_messages_return_after_acknowledge() {
+    setMillis(0);
+    AlarmEngine engine(kRules);
+    DisplayManager display;
+    AlarmOverlay overlay(kConfig, engine, display);
+    engine.reset(0);
+
+    engine.sample(AlarmSignal::Rpm, 7300.0f, 10);
+    overlay.update(engine.takeChanged());
+    engine.acknowledge();
+    overlay.update(engine.takeChanged());
+    TEST_ASSERT_FALSE(overlay.criticalShown());
+    TEST_ASSERT_FALSE(display.hasTransient());
+
+    TEST_ASSERT_TRUE(overlay.showStatus("Awake"));
+    TEST_ASSERT_EQUAL_STRING("Awake", display.transientText.c_str());
+    TEST_ASSERT_EQUAL_UINT32(2000, display.transientDurationMs);
+}
+
+void test_status_replacing_warning_is_not_cut_short() {
+    setMillis(0);
+    AlarmEngine engine(kRules);
+    DisplayManager display;
+    AlarmOverlay overlay(kConfig, engine, display);
+    engine.reset(0);
+
+    engine.sample(AlarmSignal::CoolantC, 106.0f, 10);
+    overlay.update(engine.takeChanged());
+    TEST_ASSERT_EQUAL_STRING("Coolant warm", display.transientText.c_str());
+
+    TEST_ASSERT_TRUE(overlay.showStatus("Lights ON"));
+    engine.sample(AlarmSignal::CoolantC, 100.0f, 20);
+    overlay.update(engine.takeChanged());
+    TEST_ASSERT_EQUAL_STRING("Lights ON", display.transientText.c_str());
+    TEST_ASSERT_TRUE(display.hasTransient());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_status_message_does_not_displace_critical_alarm);
+    RUN_TEST(test_dropped_critical_overlay_is_reasserted);
+    RUN_TEST(test_status_messages_return_after_acknowledge);
+    RUN_TEST(test_status_replacing_warning_is_not_cut_short);
+    return UNITY_END();
+}
@@ -0,0 +1,103 @@
+#include <unity.h>
+
+#include "esp32_dash/TM1638/ButtonScanner.h"
+
+namespace {
+const ButtonScanner::Config kConfig{
+    .integratorSamples = 4,
+    .longPressMs = 800,
+};
+constexpr uint32_t kScanMs = 5;
+
+uint32_t feed(ButtonScanner &scanner, uint8_t raw, uint8_t samples, uint32_t nowMs) {
+    for (uint8_t i = 0; i < samples; ++i) {
+        scanner.sample(raw, nowMs);
+        nowMs += kScanMs;
+    }
+    return nowMs;
+}
+}
+
+void test_press_requires_stable_samples() {
+    ButtonScanner scanner(kConfig);
+    ButtonEvent event;
+
+    uint32_t now = feed(scanner, 0x01, 3, 0);
+    TEST_ASSERT_FALSE(scanner.poll(event));
+
+    feed(scanner, 0x01, 1, now);
+    TEST_ASSERT_TRUE(scanner.poll(event));
+    TEST_ASSERT_TRUE(event.type == ButtonEvent::Type::Press);
+    TEST_ASSERT_EQUAL_UINT8(0x01, event.mask);
+    TEST_ASSERT_EQUAL_UINT8(0x01, scanner.heldMask());
+}
+
+void test_bounce_is_filtered() {
+    ButtonScanner scanner(kConfig);
+    ButtonEvent event;
+    uint32_t now = 0;
+    for (int i = 0; i < 10; ++i) {
+        now = feed(scanner, 0x04, 1, now);
+        now = feed(scanner, 0x00, 1, now);
+    }
+    TEST_ASSERT_FALSE(scanner.poll(event));
+}
+
+void test_release_and_long_press() {
+    ButtonScanner scanner(kConfig);
+    ButtonEvent event;
+
+    uint32_t now = feed(scanner, 0x80, 4, 0);
+    TEST_ASSERT_TRUE(scanner.poll(event));
+    TEST_ASSERT_TRUE(event.type == ButtonEvent::Type::Press);
+
+    now = feed(scanner, 0x80, 200, now);
+    TEST_ASSERT_TRUE(scanner.poll(event));
+    TEST_ASSERT_TRUE(event.type == ButtonEvent::Type::LongPress);
+    TEST_ASSERT_EQUAL_UINT8(0x80, event.mask);
+    TEST_ASSERT_FALSE(scanner.poll(event));  // reported once
+
+    feed(scanner, 0x00, 4, now);
+    TEST_ASSERT_TRUE(scanner.poll(event));
+    TEST_ASSERT_TRUE(event.type == ButtonEvent::Type::Release);
+    TEST_ASSERT_EQUAL_UINT8(0x00, scanner.heldMask());
+}
+
+void test_simultaneous_presses_are_not_lost() {
+    ButtonScanner scanner(kConfig);
+    ButtonEvent event;
+
+    feed(scanner, 0x03, 4, 0);
+
+    uint8_t pressed = 0;
+    uint8_t chord = 0;
+    while (scanner.poll(event)) {
+        if (event.type == ButtonEvent::Type::Press) {
+            pressed |= event.mask;
+        } else if (event.type == ButtonEvent::Type::Chord) {
+            chord = event.mask;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(0x03, pressed);
+    TEST_ASSERT_EQUAL_UINT8(0x03, chord);
+}
+
+void test_full_queue_counts_dropped_events() {
+    ButtonScanner scanner(kConfig);
+    uint32_t now = 0;
+    for (int i = 0; i < 20; ++i) {
+        now = feed(scanner, 0x01, 4, now);
+        now = feed(scanner, 0x00, 4, now);
+    }
+    TEST_ASSERT_EQUAL_UINT32(40 - ButtonScanner::kEventQueueSize + 1, scanner.droppedEvents());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_press_requires_stable_samples);
+    RUN_TEST(test_bounce_is_filtered);
+    RUN_TEST(test_release_and_long_press);
+    RUN_TEST(test_simultaneous_presses_are_not_lost);
+    RUN_TEST(test_full_queue_counts_dropped_events);
+    return UNITY_END();
+}
@@ -0,0 +1,137 @@
+#include <unity.h>
+
+#include "esp32_dash/sensors/DigitalInputs.h"
+#include "Arduino.h"
+
+namespace {
+constexpr int kLightsPin = 36;
+constexpr int kHandbrakePin = 13;
+constexpr size_t kLights = 0;
+constexpr size_t kHandbrake = 1;
+
+const DigitalInputConfig kConfigs[2] = {
+    {.pin = kLightsPin, .mode = INPUT, .activeLow = false, .debounceMicros = 20000},
+    {.pin = kHandbrakePin, .mode = INPUT_PULLUP, .activeLow = true, .debounceMicros = 20000},
+};
+
+// Drives \c pin to \c level and fires its interrupt, as the edge would.
+void edge(int pin, int level) {
+    setDigitalLevel(pin, level);
+    triggerInterrupt(pin);
+}
+}
+
+void test_begin_reads_levels_without_events() {
+    setMicros(0);
+    setDigitalLevel(kLightsPin, HIGH);
+    setDigitalLevel(kHandbrakePin, LOW);
+    DigitalInputs<2> inputs(kConfigs);
+    inputs.begin();
+
+    TEST_ASSERT_TRUE(inputs.isActive(kLights));
+    TEST_ASSERT_TRUE(inputs.isActive(kHandbrake));  // active low
+    TEST_ASSERT_EQUAL_UINT32(0x3, inputs.states());
+    InputEvent event;
+    TEST_ASSERT_FALSE(inputs.poll(event, micros()));
+}
+
+void test_first_edge_updates_state_immediately() {
+    setMicros(1000);
+    setDigitalLevel(kLightsPin, LOW);
+    setDigitalLevel(kHandbrakePin, HIGH);
+    DigitalInputs<2> inputs(kConfigs);
+    inputs.begin();
+
+    edge(kLightsPin, HIGH);
+    TEST_ASSERT_TRUE(inputs.isActive(kLights));
+
+    InputEvent event;
+    TEST_ASSERT_TRUE(inputs.poll(event, micros()));
+    TEST_ASSERT_EQUAL_UINT8(kLights, event.input);
+    TEST_ASSERT_TRUE(event.active);
+    TEST_ASSERT_EQUAL_UINT32(1000, event.atMicros);
+    TEST_ASSERT_FALSE(inputs.poll(event, micros()));
+}
+
+void test_bounce_is_ignored_inside_the_window() {
+    setMicros(0);
+    setDigitalLevel(kLightsPin, HIGH);
+    setDigitalLevel(kHandbrakePin, HIGH);
+    DigitalInputs<2> inputs(kConfigs);
+    inputs.begin();
+
+    edge(kHandbrakePin, LOW);
+    advanceMicros(300);
+    edge(kHandbrakePin, HIGH);
+    advanceMicros(300);
+    edge(kHandbrakePin, LOW);
+    TEST_ASSERT_TRUE(inputs.isActive(kHandbrake));
+
+    advanceMicros(20000);
+    InputEvent event;
+    TEST_ASSERT_TRUE(inputs.poll(event, micros()));
+    TEST_ASSERT_TRUE(event.active);
+    TEST_ASSERT_FALSE(inputs.poll(event, micros()));  // no chatter from the bounce
+}
+
+void test_bounce_ending_on_the_other_level_is_settled() {
+    setMicros(0);
+    setDigitalLevel(kLightsPin, LOW);
+    setDigitalLevel(kHandbrakePin, HIGH);
+    DigitalInputs<2> inputs(kConfigs);
+    inputs.begin();
+
+    // A short glitch: the lights line blips high and falls back inside the window.
+    edge(kLightsPin, HIGH);
+    advanceMicros(500);
+    edge(kLightsPin, LOW);
+    TEST_ASSERT_TRUE(inputs.isActive(kLights));
+
+    InputEvent event;
+    TEST_ASSERT_TRUE(inputs.poll(event, micros()));
+    TEST_ASSERT_TRUE(event.active);
+    TEST_ASSERT_FALSE(inputs.poll(event, micros()));
+
+    advanceMicros(20000);
+    TEST_ASSERT_TRUE(inputs.poll(event, micros()));
+    TEST_ASSERT_FALSE(event.active);
+    TEST_ASSERT_FALSE(inputs.isActive(kLights));
+}
+
+void test_full_queue_keeps_newest_changes() {
+    setMicros(0);
+    setDigitalLevel(kLightsPin, LOW);
+    setDigitalLevel(kHandbrakePin, HIGH);
+    DigitalInputs<2> inputs(kConfigs);
+    inputs.begin();
+
+    const int toggles = DigitalInputs<2>::kQueueDepth + 2;
+    for (int i = 0; i < toggles; ++i) {
+        advanceMicros(25000);
+        edge(kLightsPin, (i % 2 == 0) ? HIGH : LOW);
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, inputs.droppedEvents());
+
+    InputEvent event;
+    uint32_t last = 0;
+    int received = 0;
+    while (inputs.poll(event, micros())) {
+        TEST_ASSERT_TRUE(event.atMicros > last);
+        last = event.atMicros;
+        ++received;
+    }
+    TEST_ASSERT_EQUAL_INT(DigitalInputs<2>::kQueueDepth, received);
+    TEST_ASSERT_EQUAL_UINT32(micros(), last);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_reads_levels_without_events);
+    RUN_TEST(test_first_edge_updates_state_immediately);
+    RUN_TEST(test_bounce_is_ignored_inside_the_window);
+    RUN_TEST(test_bounce_ending_on_the_other_level_is_settled);
+    RUN_TEST(test_full_queue_keeps_newest_changes);
+    return UNITY_END();
+}
@@ -0,0 +1,69 @@
+#include <unity.h>
+#include <string.h>
+
+#include "esp32_dash/diagnostics/LoopProfiler.h"
+#include "Arduino.h"
+
+void test_bucket_for_is_log2_scale() {
+    TEST_ASSERT_EQUAL_UINT8(0, LoopProfiler::bucketFor(0));
+    TEST_ASSERT_EQUAL_UINT8(1, LoopProfiler::bucketFor(1));
+    TEST_ASSERT_EQUAL_UINT8(2, LoopProfiler::bucketFor(3));
+    TEST_ASSERT_EQUAL_UINT8(11, LoopProfiler::bucketFor(1024));
+    TEST_ASSERT_EQUAL_UINT8(LoopProfiler::kBucketCount - 1, LoopProfiler::bucketFor(UINT32_MAX));
+}
+
+void test_record_tracks_count_and_max() {
+    LoopProfiler profiler;
+    profiler.record(ProfileZone::TachUpdate, 10);
+    profiler.record(ProfileZone::TachUpdate, 250);
+    profiler.record(ProfileZone::TachUpdate, 40);
+
+    const auto &stats = profiler.stats(ProfileZone::TachUpdate);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(250, stats.maxMicros);
+    TEST_ASSERT_EQUAL_UINT32(300, static_cast<uint32_t>(stats.totalMicros));
+    TEST_ASSERT_EQUAL_UINT32(0, profiler.stats(ProfileZone::Buttons).count);
+}
+
+void test_p99_ignores_rare_outlier() {
+    LoopProfiler profiler;
+    for (int i = 0; i < 999; ++i) {
+        profiler.record(ProfileZone::DisplayLoop, 100);
+    }
+    profiler.record(ProfileZone::DisplayLoop, 50000);
+
+    TEST_ASSERT_EQUAL_UINT32(127, profiler.percentileMicros(ProfileZone::DisplayLoop, 99));
+    TEST_ASSERT_EQUAL_UINT32(50000, profiler.percentileMicros(ProfileZone::DisplayLoop, 100));
+}
+
+void test_scoped_zone_measures_virtual_time() {
+    loopProfiler().reset();
+    setMicros(1000);
+    {
+        ScopedProfileZone zone(ProfileZone::Buttons);
+        advanceMicros(420);
+    }
+    TEST_ASSERT_EQUAL_UINT32(420, loopProfiler().stats(ProfileZone::Buttons).maxMicros);
+}
+
+void test_format_lists_only_sampled_zones() {
+    LoopProfiler profiler;
+    char buffer[256];
+    profiler.format(buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("No samples\n", buffer);
+
+    profiler.record(ProfileZone::WaterRead, 2000);
+    profiler.format(buffer, sizeof(buffer));
+    TEST_ASSERT_NOT_NULL(strstr(buffer, "waterRead n=1 avg=2000"));
+    TEST_ASSERT_NULL(strstr(buffer, "tach"));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bucket_for_is_log2_scale);
+    RUN_TEST(test_record_tracks_count_and_max);
+    RUN_TEST(test_p99_ignores_rare_outlier);
+    RUN_TEST(test_scoped_zone_measures_virtual_time);
+    RUN_TEST(test_format_lists_only_sampled_zones);
+    return UNITY_END();
+}
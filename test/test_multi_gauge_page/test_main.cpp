@@ -0,0 +1,137 @@
+#include <unity.h>
+
+#include "Arduino.h"
+#include "esp32_dash/display/pages/MultiGaugePage.h"
+
+namespace {
+const MultiGaugePage::Config kConfig = {
+        .frameBudgetBytes = 17408,
+        .rpmIntervalMs = 0,
+        .speedIntervalMs = 250,
+        .coolantIntervalMs = 1000,
+        .linkIntervalMs = 1000,
+};
+
+// Estimated region costs, mirrored from MultiGaugePage.cpp.
+constexpr uint32_t kRpmCost = 128u * 40u * 2u;
+constexpr uint32_t kSpeedCost = 144u * 24u * 2u;
+constexpr uint32_t kCoolantCost = 90u * 24u * 2u;
+
+// Draws the entry frame and lets the RPM tween settle.
+void settle(MultiGaugePage &page, Adafruit_GC9A01A &display) {
+    for (int frame = 0; frame < 200; ++frame) {
+        advanceMillis(33);
+        if (!page.tick(millis())) {
+            break;
+        }
+        page.render(display);
+    }
+}
+}
+
+void test_entry_frame_draws_every_region() {
+    Adafruit_GC9A01A display;
+    MultiGaugePage page(kConfig);
+    TEST_ASSERT_TRUE(page.tick(millis()));
+    page.render(display);
+    TEST_ASSERT_EQUAL_size_t(0, page.deferredRegions());
+    TEST_ASSERT_FALSE(page.tick(millis()));
+}
+
+void test_budget_defers_slow_regions_to_the_next_frame() {
+    Adafruit_GC9A01A display;
+    MultiGaugePage page(kConfig);
+    settle(page, display);
+
+    advanceMillis(2000);
+    page.setRpm(3000.0f);
+    page.setSpeed(88.0f);
+    page.setCoolantTemp(92.0f);
+    advanceMillis(33);
+    TEST_ASSERT_TRUE(page.tick(millis()));
+    page.render(display);
+    // RPM and speed fill the frame; coolant waits.
+    TEST_ASSERT_EQUAL_UINT32(kRpmCost + kSpeedCost, page.lastFrameBytes());
+    TEST_ASSERT_EQUAL_size_t(1, page.deferredRegions());
+
+    advanceMillis(33);
+    TEST_ASSERT_TRUE(page.tick(millis()));
+    page.render(display);
+    TEST_ASSERT_TRUE(page.lastFrameBytes() >= kCoolantCost);
+    TEST_ASSERT_TRUE(page.lastFrameBytes() <= kConfig.frameBudgetBytes);
+    TEST_ASSERT_EQUAL_size_t(0, page.deferredRegions());
+}
+
+void test_frame_cost_stays_within_budget_while_everything_moves() {
+    Adafruit_GC9A01A display;
+    MultiGaugePage page(kConfig);
+    settle(page, display);
+
+    for (int frame = 0; frame < 60; ++frame) {
+        page.setRpm(1000.0f + frame * 100.0f);
+        page.setSpeed(static_cast<float>(frame));
+        page.setCoolantTemp(70.0f + frame);
+        page.setLinkConnected(frame % 2 == 0);
+        advanceMillis(33);
+        if (page.tick(millis())) {
+            page.render(display);
+            TEST_ASSERT_TRUE(page.lastFrameBytes() <= kConfig.frameBudgetBytes);
+        }
+    }
+}
+
+void test_regions_respect_their_refresh_interval() {
+    Adafruit_GC9A01A display;
+    MultiGaugePage page(kConfig);
+    settle(page, display);
+
+    advanceMillis(2000);
+    page.setCoolantTemp(90.0f);
+    advanceMillis(33);
+    page.tick(millis());
+    page.render(display);
+    TEST_ASSERT_EQUAL_UINT32(kCoolantCost, page.lastFrameBytes());
+
+    // A new reading inside the coolant interval waits for it.
+    page.setCoolantTemp(91.0f);
+    advanceMillis(500);
+    TEST_ASSERT_FALSE(page.tick(millis()));
+    advanceMillis(500);
+    TEST_ASSERT_TRUE(page.tick(millis()));
+}
+
+void test_rpm_is_drawn_every_frame_ahead_of_carried_regions() {
+    // Tighter than RPM plus speed, so speed is carried every time it is due.
+    MultiGaugePage::Config tight = kConfig;
+    tight.frameBudgetBytes = kRpmCost + kSpeedCost - 1;
+    Adafruit_GC9A01A display;
+    MultiGaugePage page(tight);
+    page.setRpm(1000.0f);  // the first sample snaps; later ones animate
+    settle(page, display);
+    advanceMillis(2000);
+
+    // The RPM tween keeps the readout dirty every frame while speed moves.
+    page.setRpm(6000.0f);
+    for (int frame = 0; frame < 8; ++frame) {
+        page.setSpeed(40.0f + frame);
+        advanceMillis(33);
+        TEST_ASSERT_TRUE(page.tick(millis()));
+        display.resetCounters();
+        page.render(display);
+        // Only the RPM readout streams pixels (alpha font); the rest print.
+        TEST_ASSERT_TRUE(display.pixelsWritten > 0);
+        TEST_ASSERT_TRUE(page.lastFrameBytes() >= kRpmCost);
+    }
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_entry_frame_draws_every_region);
+    RUN_TEST(test_budget_defers_slow_regions_to_the_next_frame);
+    RUN_TEST(test_frame_cost_stays_within_budget_while_everything_moves);
+    RUN_TEST(test_regions_respect_their_refresh_interval);
+    RUN_TEST(test_rpm_is_drawn_every_frame_ahead_of_carried_regions);
+    return UNITY_END();
+}
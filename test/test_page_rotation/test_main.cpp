@@ -0,0 +1,149 @@
+#include <unity.h>
+
+#include "esp32_dash/display/PageRotation.h"
+
+namespace {
+const PageRotation::Config kConfig{
+        .dwellMs = 8000,
+        .maxDwellMs = 20000,
+        .settleMs = 2000,
+        .staleAfterMs = 5000,
+        .userPauseMs = 30000,
+        .maxSwitchDelayMs = 1000,
+};
+constexpr size_t kWater = 1;
+constexpr size_t kTach = 2;
+constexpr size_t kSweep = 3;
+
+void addPages(PageRotation &rotation) {
+    rotation.addPage(kWater, 1.0f);
+    rotation.addPage(kTach, 100.0f);
+    rotation.addPage(kSweep, 100.0f);
+}
+
+// Every page has fresh, unchanging data at \c nowMs.
+void feedSteady(PageRotation &rotation, uint32_t nowMs) {
+    rotation.noteValue(kWater, 90.0f, nowMs);
+    rotation.noteValue(kTach, 900.0f, nowMs);
+    rotation.noteValue(kSweep, 900.0f, nowMs);
+}
+}
+
+void test_switches_after_dwell_on_a_frame() {
+    PageRotation rotation(kConfig);
+    addPages(rotation);
+    size_t next = 0;
+    feedSteady(rotation, 0);
+    TEST_ASSERT_FALSE(rotation.poll(kWater, 0, true, next));
+
+    feedSteady(rotation, 7999);
+    TEST_ASSERT_FALSE(rotation.poll(kWater, 7999, true, next));
+    feedSteady(rotation, 8000);
+    TEST_ASSERT_TRUE(rotation.poll(kWater, 8000, true, next));
+    TEST_ASSERT_EQUAL_UINT32(kTach, next);
+}
+
+void test_due_switch_waits_for_a_frame() {
+    PageRotation rotation(kConfig);
+    addPages(rotation);
+    size_t next = 0;
+    rotation.poll(kWater, 0, true, next);
+
+    feedSteady(rotation, 8000);
+    TEST_ASSERT_FALSE(rotation.poll(kWater, 8000, false, next));
+    TEST_ASSERT_FALSE(rotation.poll(kWater, 8500, false, next));
+    TEST_ASSERT_TRUE(rotation.poll(kWater, 8600, true, next));
+
+    // With no frames at all the switch still goes out eventually.
+    feedSteady(rotation, 16600);
+    TEST_ASSERT_FALSE(rotation.poll(kTach, 16600, false, next));
+    TEST_ASSERT_TRUE(rotation.poll(kTach, 17600, false, next));
+    TEST_ASSERT_EQUAL_UINT32(kSweep, next);
+}
+
+void test_changing_values_extend_dwell_up_to_the_cap() {
+    PageRotation rotation(kConfig);
+    addPages(rotation);
+    size_t next = 0;
+    rotation.poll(kTach, 0, true, next);
+
+    uint32_t now = 0;
+    float rpm = 1000.0f;
+    for (; now <= 19000; now += 500) {
+        rpm += 200.0f;
+        feedSteady(rotation, now);
+        rotation.noteValue(kTach, rpm, now);
+        TEST_ASSERT_FALSE(rotation.poll(kTach, now, true, next));
+    }
+    rotation.noteValue(kTach, rpm + 200.0f, 20000);
+    feedSteady(rotation, 20000);
+    rotation.noteValue(kTach, rpm + 400.0f, 20000);
+    TEST_ASSERT_TRUE(rotation.poll(kTach, 20000, true, next));
+}
+
+void test_alarming_page_is_held() {
+    PageRotation rotation(kConfig);
+    addPages(rotation);
+    size_t next = 0;
+    rotation.poll(kWater, 0, true, next);
+    rotation.setAlarming(kWater, true);
+
+    feedSteady(rotation, 60000);
+    TEST_ASSERT_FALSE(rotation.poll(kWater, 60000, true, next));
+    rotation.setAlarming(kWater, false);
+    TEST_ASSERT_TRUE(rotation.poll(kWater, 60001, true, next));
+}
+
+void test_stale_pages_are_skipped() {
+    PageRotation rotation(kConfig);
+    addPages(rotation);
+    size_t next = 0;
+    rotation.poll(kWater, 0, true, next);
+
+    // Engine off: only the water page has data.
+    rotation.noteValue(kTach, 900.0f, 0);
+    rotation.noteValue(kWater, 90.0f, 8000);
+    TEST_ASSERT_FALSE(rotation.poll(kWater, 8000, true, next));
+
+    rotation.noteValue(kSweep, 900.0f, 9000);
+    TEST_ASSERT_TRUE(rotation.poll(kWater, 9000, true, next));
+    TEST_ASSERT_EQUAL_UINT32(kSweep, next);
+}
+
+void test_user_input_pauses_and_restarts_dwell() {
+    PageRotation rotation(kConfig);
+    addPages(rotation);
+    size_t next = 0;
+    rotation.poll(kWater, 0, true, next);
+
+    rotation.noteUserInput(5000);
+    feedSteady(rotation, 20000);
+    TEST_ASSERT_FALSE(rotation.poll(kTach, 20000, true, next));  // user moved to tach
+    feedSteady(rotation, 35000);
+    TEST_ASSERT_TRUE(rotation.poll(kTach, 35000, true, next));
+    TEST_ASSERT_EQUAL_UINT32(kSweep, next);
+}
+
+void test_pages_outside_the_rotation_are_kept() {
+    PageRotation rotation(kConfig);
+    addPages(rotation);
+    size_t next = 0;
+    rotation.poll(0, 0, true, next);
+
+    feedSteady(rotation, 60000);
+    TEST_ASSERT_FALSE(rotation.poll(0, 60000, true, next));
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_switches_after_dwell_on_a_frame);
+    RUN_TEST(test_due_switch_waits_for_a_frame);
+    RUN_TEST(test_changing_values_extend_dwell_up_to_the_cap);
+    RUN_TEST(test_alarming_page_is_held);
+    RUN_TEST(test_stale_pages_are_skipped);
+    RUN_TEST(test_user_input_pauses_and_restarts_dwell);
+    RUN_TEST(test_pages_outside_the_rotation_are_kept);
+    return UNITY_END();
+}
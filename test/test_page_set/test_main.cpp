@@ -0,0 +1,89 @@
+#include <unity.h>
+
+#include <type_traits>
+
+#include "AllocationCounter.h"
+#include "Arduino.h"
+#include "esp32_dash/display/PageSet.h"
+#include "esp32_dash/display/pages/TachPage.h"
+#include "esp32_dash/display/pages/WaterTempPage.h"
+
+namespace {
+// Plain page types: no DisplayPage base, no vtable.
+struct CountingPage {
+    int entered = 0;
+    int exited = 0;
+    int rendered = 0;
+    void onEnter(Adafruit_GC9A01A &) { ++entered; }
+    void onExit(Adafruit_GC9A01A &) { ++exited; }
+    void render(Adafruit_GC9A01A &) { ++rendered; }
+};
+
+struct RenderOnlyPage {
+    int rendered = 0;
+    void render(Adafruit_GC9A01A &) { ++rendered; }
+};
+}
+
+void test_dispatch_reaches_the_indexed_page() {
+    Adafruit_GC9A01A display;
+    PageSet<CountingPage, RenderOnlyPage, CountingPage> pages;
+
+    pages.render(1, display);
+    pages.enter(2, display);
+    pages.exit(0, display);
+    pages.render(2, display);
+
+    TEST_ASSERT_EQUAL_INT(1, pages.get<1>().rendered);
+    TEST_ASSERT_EQUAL_INT(0, pages.get<0>().rendered);
+    TEST_ASSERT_EQUAL_INT(1, pages.get<0>().exited);
+    TEST_ASSERT_EQUAL_INT(1, pages.get<2>().entered);
+    TEST_ASSERT_EQUAL_INT(1, pages.get<2>().rendered);
+}
+
+void test_missing_hooks_and_out_of_range_indices_are_ignored() {
+    Adafruit_GC9A01A display;
+    PageSet<RenderOnlyPage> pages;
+    pages.enter(0, display);
+    pages.exit(0, display);
+    pages.render(5, display);
+    TEST_ASSERT_EQUAL_INT(0, pages.get<RenderOnlyPage>().rendered);
+}
+
+void test_table_forwards_to_the_set() {
+    Adafruit_GC9A01A display;
+    PageSet<CountingPage, RenderOnlyPage> pages;
+    const PageTable &table = decltype(pages)::table();
+
+    TEST_ASSERT_EQUAL_size_t(2, table.count);
+    table.enter(&pages, 0, display);
+    table.render(&pages, 1, display);
+    TEST_ASSERT_EQUAL_INT(1, pages.get<0>().entered);
+    TEST_ASSERT_EQUAL_INT(1, pages.get<1>().rendered);
+}
+
+void test_real_pages_dispatch_without_allocating() {
+    static_assert(!std::is_polymorphic<CountingPage>::value, "plain pages carry no vtable");
+    Adafruit_GC9A01A display;
+    PageSet<WaterTempPage, TachPage> pages;
+    pages.enter(0, display);
+    pages.render(0, display);
+
+    resetAllocationCount();
+    for (int rpm = 1000; rpm < 3000; rpm += 100) {
+        pages.get<TachPage>().setRpm(static_cast<float>(rpm));
+        pages.render(1, display);
+    }
+    TEST_ASSERT_EQUAL_size_t(0, allocationCount());
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_dispatch_reaches_the_indexed_page);
+    RUN_TEST(test_missing_hooks_and_out_of_range_indices_are_ignored);
+    RUN_TEST(test_table_forwards_to_the_set);
+    RUN_TEST(test_real_pages_dispatch_without_allocating);
+    return UNITY_END();
+}
@@ -0,0 +1,185 @@
+#include <unity.h>
+
+#include "esp32_dash/power/PowerManager.h"
+
+namespace {
+const PowerManager::Config kConfig{
+        .sleepSliceMs = 250,
+        .minAwakeMs = 120,
+        .maxWakingMs = 500,
+};
+
+// Records what the state machine asked of the hardware. Each light sleep
+// advances the clock by the slice and ends with the scripted source.
+class FakePowerHal final : public PowerHal {
+public:
+    void setDisplayAsleep(bool asleep) override {
+        displayAsleep = asleep;
+        ++displayCommands;
+    }
+    void setSlowAdvertising(bool slow) override { slowAdvertising = slow; }
+
+    WakeSource lightSleep(uint32_t maxMs) override {
+        ++sleeps;
+        lastSleepMs = maxMs;
+        nowMicros += maxMs * 1000UL;
+        const WakeSource source = nextWake;
+        nextWake = WakeSource::Timer;
+        return source;
+    }
+    bool buttonsHeld() override { return buttons; }
+    uint32_t micros() override { return nowMicros; }
+
+    bool displayAsleep = false;
+    bool slowAdvertising = false;
+    bool buttons = false;
+    int displayCommands = 0;
+    int sleeps = 0;
+    uint32_t lastSleepMs = 0;
+    uint32_t nowMicros = 1000000;
+    WakeSource nextWake = WakeSource::Timer;
+};
+}
+
+void test_sleep_request_puts_hardware_to_sleep() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::None);
+
+    power.requestSleep();
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::Slept);
+    TEST_ASSERT_TRUE(power.state() == PowerState::Sleeping);
+    TEST_ASSERT_TRUE(hal.displayAsleep);
+    TEST_ASSERT_TRUE(hal.slowAdvertising);
+    TEST_ASSERT_EQUAL_INT(0, hal.sleeps);  // the caller suspends first
+}
+
+void test_timer_slices_keep_sleeping() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    power.requestSleep();
+    power.update();
+
+    for (int i = 0; i < 3; ++i) {
+        TEST_ASSERT_TRUE(power.update() == PowerTransition::None);
+    }
+    TEST_ASSERT_EQUAL_INT(3, hal.sleeps);
+    TEST_ASSERT_EQUAL_UINT32(250, hal.lastSleepMs);
+    TEST_ASSERT_EQUAL_UINT32(3, power.sleepSlices());
+    TEST_ASSERT_TRUE(power.state() == PowerState::Sleeping);
+}
+
+void test_tach_pulse_wakes_and_times_first_frame() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    power.requestSleep();
+    power.update();
+
+    hal.nextWake = WakeSource::TachPulse;
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::Woke);
+    TEST_ASSERT_TRUE(power.state() == PowerState::Waking);
+    TEST_ASSERT_TRUE(power.lastWakeSource() == WakeSource::TachPulse);
+    TEST_ASSERT_FALSE(hal.displayAsleep);
+    TEST_ASSERT_FALSE(hal.slowAdvertising);
+
+    // Waking holds until the first frame is out.
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::None);
+    hal.nowMicros += 18000;
+    power.noteFrameDrawn();
+    TEST_ASSERT_TRUE(power.state() == PowerState::Active);
+    TEST_ASSERT_EQUAL_UINT32(18000, power.lastWakeToFrameMicros());
+}
+
+void test_buttons_are_polled_between_slices() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    power.requestSleep();
+    power.update();
+
+    hal.buttons = true;
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::Woke);
+    TEST_ASSERT_TRUE(power.lastWakeSource() == WakeSource::Button);
+}
+
+void test_wake_request_skips_the_next_sleep() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    power.requestSleep();
+    power.update();
+
+    power.requestWake();
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::Woke);
+    TEST_ASSERT_TRUE(power.lastWakeSource() == WakeSource::Ble);
+    TEST_ASSERT_EQUAL_INT(0, hal.sleeps);
+}
+
+void test_panel_stays_awake_for_the_minimum_time() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    power.requestSleep();
+    power.update();
+    power.requestWake();
+    power.update();
+    power.noteFrameDrawn();
+
+    const int commands = hal.displayCommands;
+    power.requestSleep();
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::None);
+    TEST_ASSERT_EQUAL_INT(commands, hal.displayCommands);
+
+    // The request is kept and honoured once the panel may sleep again.
+    hal.nowMicros += 120000;
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::Slept);
+}
+
+void test_wake_request_while_active_is_dropped() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    power.requestWake();
+    power.update();
+
+    power.requestSleep();
+    power.update();
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::None);
+    TEST_ASSERT_EQUAL_INT(1, hal.sleeps);
+}
+
+void test_waking_gives_up_without_a_frame() {
+    FakePowerHal hal;
+    PowerManager power(kConfig, hal);
+    power.requestSleep();
+    power.update();
+    hal.nextWake = WakeSource::TachPulse;
+    power.update();
+
+    // The display never draws: Waking must not last forever.
+    hal.nowMicros += 499000;
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::None);
+    TEST_ASSERT_TRUE(power.state() == PowerState::Waking);
+    hal.nowMicros += 1000;
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::None);
+    TEST_ASSERT_TRUE(power.state() == PowerState::Active);
+    TEST_ASSERT_EQUAL_UINT32(1, power.wakeTimeouts());
+    TEST_ASSERT_EQUAL_UINT32(0, power.lastWakeToFrameMicros());
+
+    // A late frame changes nothing, and the next sleep still works.
+    power.noteFrameDrawn();
+    TEST_ASSERT_EQUAL_UINT32(0, power.lastWakeToFrameMicros());
+    power.requestSleep();
+    TEST_ASSERT_TRUE(power.update() == PowerTransition::Slept);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_sleep_request_puts_hardware_to_sleep);
+    RUN_TEST(test_timer_slices_keep_sleeping);
+    RUN_TEST(test_tach_pulse_wakes_and_times_first_frame);
+    RUN_TEST(test_buttons_are_polled_between_slices);
+    RUN_TEST(test_wake_request_skips_the_next_sleep);
+    RUN_TEST(test_panel_stays_awake_for_the_minimum_time);
+    RUN_TEST(test_wake_request_while_active_is_dropped);
+    RUN_TEST(test_waking_gives_up_without_a_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,112 @@
+#include <unity.h>
+
+#include "esp32_dash/sensors/PulseCapture.h"
+#include "Arduino.h"
+
+namespace {
+constexpr int kTachPin = 35;
+constexpr int kVssPin = 39;
+
+const PulseChannelConfig kConfigs[2] = {
+    {.pin = kTachPin, .edge = RISING, .debounceMicros = 2000, .backend = PulseBackend::GpioInterrupt},
+    {.pin = kVssPin, .edge = RISING, .debounceMicros = 500, .backend = PulseBackend::Pcnt, .staleMicros = 2000000},
+};
+
+// Fires \\c count edges on \\c pin, \\c periodMicros apart, starting one period from now.
+void pulseTrain(int pin, uint32_t periodMicros, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        advanceMicros(periodMicros);
+        triggerInterrupt(pin);
+    }
+}
+}
+
+void test_each_channel_gets_its_own_isr() {
+    setMicros(1000);
+    PulseCapture<2> capture(kConfigs);
+    capture.begin();
+
+    pulseTrain(kTachPin, 20000, 5);   // 50 Hz
+    pulseTrain(kVssPin, 4000, 12);    // 250 Hz, PCNT falls back to the ISR on host
+
+    TEST_ASSERT_EQUAL_UINT32(5, capture.channel(0).takePulseCount());
+    TEST_ASSERT_EQUAL_UINT32(12, capture.channel(1).takePulseCount());
+    TEST_ASSERT_FALSE(capture.channel(1).usesHardwareCounter());
+}
+
+void test_period_and_frequency_estimators() {
+    setMicros(5000);
+    PulseCapture<2> capture(kConfigs);
+    capture.begin();
+
+    pulseTrain(kTachPin, 10000, 10);
+    PulseChannel &tach = capture.channel(0);
+    TEST_ASSERT_EQUAL_UINT32(10000, tach.periodMicros());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, tach.frequencyHz());
+    TEST_ASSERT_EQUAL_UINT32(10000, tach.snapshot().lastPeriodMicros);
+
+    // The estimator averages over the history ring, so one late edge only
+    // moves the mean by a fraction of its error.
+    pulseTrain(kTachPin, 17000, 1);
+    TEST_ASSERT_EQUAL_UINT32(11000, tach.periodMicros());
+    TEST_ASSERT_EQUAL_UINT32(17000, tach.snapshot().lastPeriodMicros);
+}
+
+void test_debounce_rejects_edges_inside_window() {
+    setMicros(0);
+    PulseCapture<2> capture(kConfigs);
+    capture.begin();
+    PulseChannel &tach = capture.channel(0);
+
+    pulseTrain(kTachPin, 10000, 1);
+    pulseTrain(kTachPin, 300, 3);     // ringing right after the real edge
+    pulseTrain(kTachPin, 10000, 1);
+
+    TEST_ASSERT_EQUAL_UINT32(2, tach.takePulseCount());
+    TEST_ASSERT_EQUAL_UINT32(5, tach.edgeCount());
+    TEST_ASSERT_EQUAL_UINT32(3, tach.rejectedCount());
+}
+
+void test_disabled_channel_ignores_edges() {
+    setMicros(0);
+    PulseCapture<2> capture(kConfigs);
+    capture.begin();
+    PulseChannel &vss = capture.channel(1);
+
+    vss.setEnabled(false);
+    pulseTrain(kVssPin, 4000, 4);
+    TEST_ASSERT_EQUAL_UINT32(0, vss.takePulseCount());
+    TEST_ASSERT_EQUAL_UINT32(0, vss.periodMicros());
+}
+
+void test_period_expires_once_pulses_stop() {
+    setMicros(0);
+    PulseCapture<2> capture(kConfigs);
+    capture.begin();
+    PulseChannel &vss = capture.channel(1);
+
+    pulseTrain(kVssPin, 4000, 12);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 250.0f, vss.frequencyHz());
+
+    // Vehicle stops: the last period must not be reported forever.
+    advanceMicros(1900000);
+    TEST_ASSERT_EQUAL_UINT32(4000, vss.periodMicros());
+    advanceMicros(200000);
+    TEST_ASSERT_EQUAL_UINT32(0, vss.periodMicros());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, vss.frequencyHz());
+
+    // Channels without a timeout keep their last reading.
+    pulseTrain(kTachPin, 10000, 4);
+    advanceMicros(5000000);
+    TEST_ASSERT_EQUAL_UINT32(10000, capture.channel(0).periodMicros());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_each_channel_gets_its_own_isr);
+    RUN_TEST(test_period_and_frequency_estimators);
+    RUN_TEST(test_debounce_rejects_edges_inside_window);
+    RUN_TEST(test_disabled_channel_ignores_edges);
+    RUN_TEST(test_period_expires_once_pulses_stop);
+    return UNITY_END();
+}
@@ -0,0 +1,136 @@
+#include <unity.h>
+#include <string.h>
+
+#include "AllocationCounter.h"
+#include "Arduino.h"
+#include "esp32_dash/display/DisplayManager.h"
+#include "esp32_dash/display/pages/StaticTextPage.h"
+#include "esp32_dash/display/pages/TachPage.h"
+#include "esp32_dash/display/pages/WaterTempPage.h"
+#include "esp32_dash/sensors/PulseCapture.h"
+#include "esp32_dash/sensors/TachSensor.h"
+#include "esp32_dash/sensors/WaterSensor.h"
+
+namespace {
+constexpr int kTachPin = 35;
+
+const PulseChannelConfig kChannels[1] = {
+    {.pin = kTachPin, .edge = RISING, .debounceMicros = 2000, .backend = PulseBackend::GpioInterrupt},
+};
+}
+
+void test_counter_sees_heap_strings() {
+    resetAllocationCount();
+    String text("Hot!");
+    TEST_ASSERT_EQUAL_size_t(1, allocationCount());
+}
+
+void test_tach_page_frame_does_not_allocate() {
+    Adafruit_GC9A01A display;
+    TachPage page;
+    page.render(display);  // first frame draws the static layout
+
+    resetAllocationCount();
+    for (int rpm = 800; rpm <= 7000; rpm += 100) {
+        page.setRpm(static_cast<float>(rpm));
+        page.setStatusMessage(rpm < 1200 ? "Idle" : "");
+        advanceMillis(33);
+        page.tick(millis());
+        page.render(display);
+    }
+    TEST_ASSERT_EQUAL_size_t(0, allocationCount());
+}
+
+void test_water_page_frame_does_not_allocate() {
+    Adafruit_GC9A01A display;
+    WaterTempPage page;
+    page.render(display);
+
+    resetAllocationCount();
+    for (int temp = 20; temp <= 110; ++temp) {
+        page.setWaterTemp(static_cast<float>(temp));
+        advanceMillis(33);
+        page.tick(millis());
+        page.render(display);
+    }
+    TEST_ASSERT_EQUAL_size_t(0, allocationCount());
+}
+
+void test_static_text_page_frame_does_not_allocate() {
+    Adafruit_GC9A01A display;
+    StaticTextPage page("Miata", "setup 0 ms\nsensors 12 ms\ndisplay 180 ms\n");
+
+    resetAllocationCount();
+    page.render(display);
+    page.render(display);
+    TEST_ASSERT_EQUAL_size_t(0, allocationCount());
+}
+
+void test_tach_update_does_not_allocate() {
+    setMicros(1000000);
+    PulseCapture<1> capture(kChannels);
+    TachPage page;
+    DisplayManager display;
+    TachSensor tach({.updateIntervalMs = 250, .pulsesPerRevolution = 2.0f, .changeThresholdRpm = 25.0f},
+                    capture.channel(0), page, display);
+    capture.begin();
+    tach.begin();
+
+    // Redline, idle and a stopped engine: one profile step per status band,
+    // each held long enough for several update windows.
+    const float profileRpm[] = {6500.0f, 900.0f, 0.0f};
+    const char *const expectedStatus[] = {"", "Idle", "Engine off"};
+
+    resetAllocationCount();
+    for (size_t i = 0; i < sizeof(profileRpm) / sizeof(profileRpm[0]); ++i) {
+        const uint32_t periodMicros = profileRpm[i] > 0.0f
+                                          ? static_cast<uint32_t>(60000000.0f / (profileRpm[i] * 2.0f))
+                                          : 0;
+        for (uint32_t elapsed = 0; elapsed < 1500000; elapsed += 1000) {
+            advanceMicros(1000);
+            if (periodMicros > 0 && (elapsed % periodMicros) < 1000) {
+                triggerInterrupt(kTachPin);
+            }
+            tach.update();
+        }
+        TEST_ASSERT_EQUAL_STRING(expectedStatus[i], page.statusMessage());
+    }
+    TEST_ASSERT_EQUAL_size_t(0, allocationCount());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, page.rpm());
+}
+
+void test_water_update_does_not_allocate() {
+    setMillis(0);
+    WaterTempPage page;
+    DisplayManager display;
+    WaterSensor sensor({
+                           .analogPin = 1,
+                           .referenceVoltage = 3.3f,
+                           .adcResolution = 4095,
+                           .pullupResistorOhms = 4700.0f,
+                           .sampleIntervalMs = 500,
+                           .samples = 4,
+                           .changeThresholdC = 0.5f,
+                       }, page, display);
+    sensor.begin();
+    const std::vector<int> readings = {3000, 2500, 2000, 1500, 1000, 500, 200, 4095};
+    setAnalogReadSequence(readings);
+
+    resetAllocationCount();
+    for (int i = 0; i < 40; ++i) {
+        advanceMillis(500);
+        sensor.update();
+    }
+    TEST_ASSERT_EQUAL_size_t(0, allocationCount());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counter_sees_heap_strings);
+    RUN_TEST(test_tach_page_frame_does_not_allocate);
+    RUN_TEST(test_water_page_frame_does_not_allocate);
+    RUN_TEST(test_static_text_page_frame_does_not_allocate);
+    RUN_TEST(test_tach_update_does_not_allocate);
+    RUN_TEST(test_water_update_does_not_allocate);
+    return UNITY_END();
+}
@@ -0,0 +1,106 @@
+#include <unity.h>
+
+#include "Arduino.h"
+#include "esp32_dash/display/RleImage.h"
+#include "esp32_dash/display/images/BootLogo.h"
+
+namespace {
+const uint16_t kPalette[] = {0x0000, 0xF800, 0xFFFF};
+// run of 5 x red, literal [white, black, white], run of 2 x black
+const uint8_t kPaletteData[] = {0x84, 0x01, 0x02, 0x02, 0x00, 0x02, 0x81, 0x00};
+const RleImage kPaletteImage = {5, 2, kPalette, 3, kPaletteData, sizeof(kPaletteData)};
+
+// run of 3 x 0x1234, literal [0xABCD]
+const uint8_t kRawData[] = {0x82, 0x34, 0x12, 0x00, 0xCD, 0xAB};
+const RleImage kRawImage = {2, 2, nullptr, 0, kRawData, sizeof(kRawData)};
+}
+
+void test_palette_runs_and_literals_expand_in_order() {
+    RleDecoder decoder(kPaletteImage);
+    uint16_t pixels[10] = {};
+    TEST_ASSERT_EQUAL_size_t(10, decoder.read(pixels, 10));
+    const uint16_t expected[10] = {0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
+                                   0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000};
+    TEST_ASSERT_EQUAL_MEMORY(expected, pixels, sizeof(expected));
+    TEST_ASSERT_TRUE(decoder.done());
+}
+
+void test_reads_can_split_tokens() {
+    RleDecoder decoder(kPaletteImage);
+    uint16_t pixels[3];
+    TEST_ASSERT_EQUAL_size_t(3, decoder.read(pixels, 3));
+    TEST_ASSERT_EQUAL_size_t(3, decoder.read(pixels, 3));
+    TEST_ASSERT_EQUAL_HEX16(0xF800, pixels[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xF800, pixels[1]);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, pixels[2]);
+    TEST_ASSERT_EQUAL_size_t(3, decoder.read(pixels, 3));
+    TEST_ASSERT_EQUAL_size_t(1, decoder.read(pixels, 3));
+    TEST_ASSERT_EQUAL_size_t(0, decoder.read(pixels, 3));
+}
+
+void test_raw_rgb565_values_are_little_endian() {
+    RleDecoder decoder(kRawImage);
+    uint16_t pixels[4] = {};
+    TEST_ASSERT_EQUAL_size_t(4, decoder.read(pixels, 4));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, pixels[2]);
+    TEST_ASSERT_EQUAL_HEX16(0xABCD, pixels[3]);
+}
+
+void test_boot_logo_decodes_to_exactly_one_frame() {
+    const RleImage &logo = images::kBootLogo;
+    TEST_ASSERT_TRUE(logo.dataSize < logo.width * logo.height * 2u / 4u);
+
+    RleDecoder decoder(logo);
+    uint16_t line[240];
+    uint32_t total = 0;
+    for (uint16_t row = 0; row < logo.height; ++row) {
+        total += decoder.read(line, logo.width);
+    }
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(logo.width) * logo.height, total);
+    TEST_ASSERT_TRUE(decoder.done());
+}
+
+void test_draw_streams_through_one_window() {
+    Adafruit_GC9A01A display;
+    drawRleImage(display, images::kBootLogo, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32(1, display.addrWindowCalls);
+    TEST_ASSERT_EQUAL_UINT32(240u * 240u, display.pixelsWritten);
+
+    display.resetCounters();
+    drawRleImage(display, images::kBootLogo, 10, 0);  // would run off the panel
+    TEST_ASSERT_EQUAL_UINT32(0, display.pixelsWritten);
+}
+
+void test_encoder_round_trips_through_decoder() {
+    uint16_t source[700];
+    for (size_t i = 0; i < 700; ++i) {
+        // Long runs, single pixels and runs longer than one token.
+        source[i] = i < 300 ? 0x0000 : (i % 3 == 0 ? static_cast<uint16_t>(i) : 0x07E0);
+    }
+    std::vector<uint8_t> encoded;
+    RleEncoder encoder(encoded);
+    for (uint16_t pixel : source) {
+        encoder.push(pixel);
+    }
+    encoder.finish();
+
+    const RleImage image = {700, 1, nullptr, 0, encoded.data(), static_cast<uint32_t>(encoded.size())};
+    RleDecoder decoder(image);
+    uint16_t decoded[700] = {};
+    TEST_ASSERT_EQUAL_size_t(700, decoder.read(decoded, 700));
+    TEST_ASSERT_EQUAL_MEMORY(source, decoded, sizeof(source));
+    TEST_ASSERT_TRUE(decoder.done());
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_palette_runs_and_literals_expand_in_order);
+    RUN_TEST(test_reads_can_split_tokens);
+    RUN_TEST(test_raw_rgb565_values_are_little_endian);
+    RUN_TEST(test_boot_logo_decodes_to_exactly_one_frame);
+    RUN_TEST(test_draw_streams_through_one_window);
+    RUN_TEST(test_encoder_round_trips_through_decoder);
+    return UNITY_END();
+}
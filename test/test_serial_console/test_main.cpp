@@ -0,0 +1,186 @@
+#include <unity.h>
+
+#include <math.h>
+#include <string.h>
+#include <string>
+
+#include "esp32_dash/diagnostics/SerialConsole.h"
+#include "esp32_dash/diagnostics/TelemetryFrame.h"
+
+namespace {
+// Everything the console would hand the UART right now.
+std::string drain(SerialConsole &console) {
+    std::string out;
+    const uint8_t *chunk = nullptr;
+    while (size_t length = console.peekTx(chunk)) {
+        out.append(reinterpret_cast<const char *>(chunk), length);
+        console.consumeTx(length);
+    }
+    return out;
+}
+
+bool feedLine(SerialConsole &console, const char *line, ConsoleArgs &args) {
+    bool complete = false;
+    for (const char *c = line; *c; ++c) {
+        complete = console.feed(*c, args) || complete;
+    }
+    return complete;
+}
+}
+
+void test_ring_wraps_and_keeps_order() {
+    ByteRing<8> ring;
+    const uint8_t first[] = {1, 2, 3, 4, 5, 6};
+    TEST_ASSERT_TRUE(ring.push(first, sizeof(first)));
+    ring.pop(5);
+    const uint8_t second[] = {7, 8, 9, 10, 11};
+    TEST_ASSERT_TRUE(ring.push(second, sizeof(second)));
+    TEST_ASSERT_FALSE(ring.push(second, 3));  // all or nothing
+
+    const uint8_t *chunk = nullptr;
+    TEST_ASSERT_EQUAL_UINT32(3, ring.peek(chunk));  // up to the end of storage
+    TEST_ASSERT_EQUAL_UINT8(6, chunk[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, ring.peek(chunk, 3));
+    TEST_ASSERT_EQUAL_UINT8(9, chunk[0]);
+
+    ring.pushOverwrite(first, 4);
+    TEST_ASSERT_EQUAL_UINT32(8, ring.used());
+    ring.peek(chunk);
+    TEST_ASSERT_EQUAL_UINT8(8, chunk[0]);  // 6 and 7 were pushed out
+}
+
+void test_lines_split_in_place() {
+    SerialConsole console;
+    ConsoleArgs args;
+    TEST_ASSERT_FALSE(feedLine(console, "\r\n", args));
+    TEST_ASSERT_TRUE(feedLine(console, "  SIM  rpm 3000\r", args));
+    TEST_ASSERT_EQUAL_UINT32(3, args.count);
+    TEST_ASSERT_TRUE(args.matches("sim rpm", 1));
+    TEST_ASSERT_FALSE(args.matches("sim rpm"));
+    TEST_ASSERT_FALSE(args.matches("sim"));
+    uint32_t rpm = 0;
+    TEST_ASSERT_TRUE(args.uintAt(2, rpm));
+    TEST_ASSERT_EQUAL_UINT32(3000, rpm);
+    TEST_ASSERT_FALSE(args.uintAt(1, rpm));
+    TEST_ASSERT_FALSE(args.uintAt(3, rpm));
+
+    TEST_ASSERT_TRUE(feedLine(console, "stats reset\n", args));
+    TEST_ASSERT_TRUE(args.matches("stats reset"));
+    TEST_ASSERT_FALSE(args.matches("stats"));
+
+    // Overlong lines are cut at the buffer, not overrun.
+    std::string longLine(SerialConsole::kLineLength * 2, 'x');
+    longLine += "\n";
+    TEST_ASSERT_TRUE(feedLine(console, longLine.c_str(), args));
+    TEST_ASSERT_EQUAL_UINT32(SerialConsole::kLineLength - 1, strlen(args.words[0]));
+}
+
+void test_full_tx_ring_drops_instead_of_blocking() {
+    SerialConsole console;
+    std::string block(SerialConsole::kTxBytes - 4, 'a');
+    console.write(block.c_str(), block.size());
+    console.println("too long");
+    TEST_ASSERT_EQUAL_UINT32(9, console.droppedBytes());
+    console.print("ok");
+
+    const std::string out = drain(console);
+    TEST_ASSERT_EQUAL_UINT32(SerialConsole::kTxBytes - 2, out.size());
+    TEST_ASSERT_EQUAL_STRING("ok", out.substr(out.size() - 2).c_str());
+}
+
+void test_long_text_is_not_cut_at_the_format_buffer() {
+    SerialConsole console;
+    const std::string text(SerialConsole::kFormatBytes + 40, 'x');
+    console.println(text.c_str());
+    TEST_ASSERT_EQUAL_STRING((text + "\n").c_str(), drain(console).c_str());
+    TEST_ASSERT_EQUAL_UINT32(0, console.droppedBytes());
+
+    // printf still formats into the fixed buffer; what it cuts is counted.
+    console.printf("%s", text.c_str());
+    TEST_ASSERT_EQUAL_UINT32(SerialConsole::kFormatBytes - 1, drain(console).size());
+    TEST_ASSERT_EQUAL_UINT32(41, console.droppedBytes());
+}
+
+void test_streaming_keeps_text_out_of_the_stream() {
+    SerialConsole console;
+    const uint8_t frame[] = {0xA5, 0x5A, 1, 0};
+    TEST_ASSERT_FALSE(console.writeFrame(frame, sizeof(frame)));  // not streaming
+
+    console.setStreaming(true);
+    console.printf("rpm %d\n", 900);
+    TEST_ASSERT_TRUE(console.writeFrame(frame, sizeof(frame)));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(frame), drain(console).size());
+
+    console.setStreaming(false);
+    console.dumpLog();
+    TEST_ASSERT_EQUAL_STRING("rpm 900\n", drain(console).c_str());
+}
+
+void test_log_keeps_the_newest_text() {
+    SerialConsole console;
+    for (int i = 0; i < 200; ++i) {
+        console.printf("line %03d\n", i);
+    }
+    drain(console);
+    console.dumpLog();
+    const std::string log = drain(console);
+    TEST_ASSERT_EQUAL_UINT32(SerialConsole::kLogBytes, log.size());
+    TEST_ASSERT_EQUAL_STRING("line 199\n", log.substr(log.size() - 9).c_str());
+    console.dumpLog();
+    TEST_ASSERT_EQUAL_UINT32(SerialConsole::kLogBytes, drain(console).size());  // log left intact
+}
+
+void test_telemetry_frame_layout() {
+    const TelemetrySample sample = {
+            .ms = 0x01020304,
+            .rpm = 3000.4f,
+            .coolantC = 88.5f,
+            .speedKmh = 42.0f,
+            .page = 2,
+            .inputs = 0x05,
+            .alarmLeds = 0x80,
+            .droppedBytes = 100000,
+    };
+    uint8_t frame[kTelemetryFrameBytes];
+    TEST_ASSERT_EQUAL_UINT32(0, encodeTelemetryFrame(sample, frame, sizeof(frame) - 1));
+    TEST_ASSERT_EQUAL_UINT32(kTelemetryFrameBytes, encodeTelemetryFrame(sample, frame, sizeof(frame)));
+
+    TEST_ASSERT_EQUAL_HEX8(0xA5, frame[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x5A, frame[1]);
+    TEST_ASSERT_EQUAL_HEX8(kTelemetryTypeSample, frame[2]);
+    TEST_ASSERT_EQUAL_UINT8(kTelemetryPayloadBytes, frame[3]);
+    TEST_ASSERT_EQUAL_HEX8(0x04, frame[4]);                  // ms, little-endian
+    TEST_ASSERT_EQUAL_UINT16(3000, frame[8] | (frame[9] << 8));
+    TEST_ASSERT_EQUAL_UINT16(885, frame[10] | (frame[11] << 8));
+    TEST_ASSERT_EQUAL_UINT16(420, frame[12] | (frame[13] << 8));
+    TEST_ASSERT_EQUAL_UINT8(2, frame[14]);
+    TEST_ASSERT_EQUAL_HEX8(0x05, frame[15]);
+    TEST_ASSERT_EQUAL_HEX8(0x80, frame[16]);
+    TEST_ASSERT_EQUAL_UINT16(0xFFFF, frame[17] | (frame[18] << 8));  // saturated
+    TEST_ASSERT_EQUAL_HEX8(telemetryCrc8(frame + 2, kTelemetryFrameBytes - 3), frame[19]);
+
+    TelemetrySample unknown = sample;
+    unknown.coolantC = NAN;
+    encodeTelemetryFrame(unknown, frame, sizeof(frame));
+    TEST_ASSERT_EQUAL_UINT16(0x8000, frame[10] | (frame[11] << 8));
+}
+
+void test_crc8_check_value() {
+    const char *check = "123456789";
+    TEST_ASSERT_EQUAL_HEX8(0xF4, telemetryCrc8(reinterpret_cast<const uint8_t *>(check), 9));
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_wraps_and_keeps_order);
+    RUN_TEST(test_lines_split_in_place);
+    RUN_TEST(test_full_tx_ring_drops_instead_of_blocking);
+    RUN_TEST(test_long_text_is_not_cut_at_the_format_buffer);
+    RUN_TEST(test_streaming_keeps_text_out_of_the_stream);
+    RUN_TEST(test_log_keeps_the_newest_text);
+    RUN_TEST(test_telemetry_frame_layout);
+    RUN_TEST(test_crc8_check_value);
+    return UNITY_END();
+}
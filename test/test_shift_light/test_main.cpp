@@ -0,0 +1,39 @@
+#include <unity.h>
+
+#include "esp32_dash/TM1638/ShiftLight.h"
+
+namespace {
+const ShiftLight::Config kConfig{
+    .startRpm = 4500.0f,
+    .redlineRpm = 6500.0f,
+    .flashPeriodMs = 100,
+};
+}
+
+void test_inactive_below_start() {
+    ShiftLight light(kConfig);
+    TEST_ASSERT_FALSE(light.isActive(4499.0f));
+    TEST_ASSERT_EQUAL_HEX8(0x00, light.ledMask(3000.0f, 0));
+}
+
+void test_progressive_fill() {
+    ShiftLight light(kConfig);
+    TEST_ASSERT_EQUAL_HEX8(0x01, light.ledMask(4500.0f, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x0F, light.ledMask(5500.0f, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x7F, light.ledMask(6400.0f, 0));
+}
+
+void test_flashes_at_redline() {
+    ShiftLight light(kConfig);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, light.ledMask(6600.0f, 10));
+    TEST_ASSERT_EQUAL_HEX8(0x00, light.ledMask(6600.0f, 60));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, light.ledMask(6600.0f, 110));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_inactive_below_start);
+    RUN_TEST(test_progressive_fill);
+    RUN_TEST(test_flashes_at_redline);
+    return UNITY_END();
+}
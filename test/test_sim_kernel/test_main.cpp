@@ -0,0 +1,137 @@
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "esp32_dash/diagnostics/SerialConsole.h"
+#include "esp32_dash/sensors/DigitalInputs.h"
+#include "esp32_dash/sensors/PulseCapture.h"
+#include "Arduino.h"
+#include "SimKernel.h"
+
+namespace {
+constexpr int kTachPin = 35;
+constexpr int kVssPin = 39;
+constexpr int kHandbrakePin = 13;
+
+const PulseChannelConfig kPulseConfigs[2] = {
+    {.pin = kTachPin, .edge = RISING, .debounceMicros = 2000, .backend = PulseBackend::GpioInterrupt},
+    {.pin = kVssPin, .edge = RISING, .debounceMicros = 500, .backend = PulseBackend::Pcnt},
+};
+
+const DigitalInputConfig kInputConfigs[1] = {
+    {.pin = kHandbrakePin, .mode = INPUT_PULLUP, .activeLow = true, .debounceMicros = 20000},
+};
+
+std::vector<int> g_order;
+}
+
+void test_events_run_in_time_then_schedule_order() {
+    sim::reset();
+    g_order.clear();
+    sim::at(300, []() { g_order.push_back(3); });
+    sim::at(100, []() { g_order.push_back(1); });
+    sim::at(100, []() { g_order.push_back(2); });
+
+    unsigned long next = 0;
+    TEST_ASSERT_TRUE(sim::nextEventMicros(next));
+    TEST_ASSERT_EQUAL_UINT32(100, next);
+    TEST_ASSERT_TRUE(sim::runNext());
+    TEST_ASSERT_EQUAL_UINT32(100, micros());
+
+    sim::runUntil(1000);
+    TEST_ASSERT_EQUAL_UINT32(1000, micros());
+    TEST_ASSERT_EQUAL_UINT32(3, g_order.size());
+    TEST_ASSERT_EQUAL_INT(1, g_order[0]);
+    TEST_ASSERT_EQUAL_INT(2, g_order[1]);
+    TEST_ASSERT_EQUAL_INT(3, g_order[2]);
+    TEST_ASSERT_FALSE(sim::runNext());
+}
+
+void test_delay_runs_events_on_the_way() {
+    sim::reset(5000);
+    unsigned long seenAt = 0;
+    sim::at(7500, [&seenAt]() { seenAt = micros(); });
+    delay(2);
+    TEST_ASSERT_EQUAL_UINT32(7000, micros());
+    TEST_ASSERT_EQUAL_UINT32(0, seenAt);
+    delay(1);
+    TEST_ASSERT_EQUAL_UINT32(7500, seenAt);  // ran at its own time, not the end of the delay
+    TEST_ASSERT_EQUAL_UINT32(8000, micros());
+}
+
+void test_pulse_trains_drive_isrs_by_edge() {
+    sim::reset();
+    PulseCapture<2> capture(kPulseConfigs);
+    capture.begin();
+
+    // 6000 rpm on a two-pulse-per-rev tach for a simulated minute.
+    sim::pulseTrain(kTachPin, 5000, 5000, 12000, 100);
+    sim::pulseTrain(kVssPin, 1000, 2000, 100, 50);
+    sim::runFor(61UL * 1000000UL);
+
+    PulseChannel &tach = capture.channel(0);
+    TEST_ASSERT_EQUAL_UINT32(12000, tach.takePulseCount());  // falling edges ignored
+    TEST_ASSERT_EQUAL_UINT32(5000, tach.periodMicros());
+    TEST_ASSERT_EQUAL_UINT32(100, capture.channel(1).takePulseCount());
+    TEST_ASSERT_EQUAL_UINT32(0, sim::pending());
+    TEST_ASSERT_EQUAL_UINT32(2 * (12000 + 100), sim::eventsRun());
+}
+
+void test_scheduled_bounce_settles_through_change_isr() {
+    sim::reset();
+    setDigitalLevel(kHandbrakePin, HIGH);
+    DigitalInputs<1> inputs(kInputConfigs);
+    inputs.begin();
+
+    sim::level(kHandbrakePin, 1000, LOW);
+    sim::level(kHandbrakePin, 1300, HIGH);
+    sim::level(kHandbrakePin, 1600, LOW);
+    sim::level(kHandbrakePin, 1900, HIGH);  // bounce ends released
+    sim::runUntil(2000);
+    TEST_ASSERT_TRUE(inputs.isActive(0));
+
+    InputEvent event;
+    TEST_ASSERT_TRUE(inputs.poll(event, micros()));
+    TEST_ASSERT_TRUE(event.active);
+    TEST_ASSERT_EQUAL_UINT32(1000, event.atMicros);
+
+    sim::runFor(20000);
+    TEST_ASSERT_TRUE(inputs.poll(event, micros()));
+    TEST_ASSERT_FALSE(event.active);
+}
+
+void test_uart_bytes_arrive_at_line_rate() {
+    sim::reset();
+    HardwareSerial nanoSerial(2);
+    sim::uart(nanoSerial, 0, "page 3\n", 115200);
+
+    sim::runUntil(86);  // one character time at 115200 baud
+    TEST_ASSERT_EQUAL_INT(0, nanoSerial.available());
+    sim::runUntil(87);
+    TEST_ASSERT_EQUAL_INT(1, nanoSerial.available());
+
+    SerialConsole console;
+    ConsoleArgs args;
+    bool complete = false;
+    while (!complete && sim::runNext()) {
+        while (nanoSerial.available()) {
+            complete = console.feed(static_cast<char>(nanoSerial.read()), args) || complete;
+        }
+    }
+    TEST_ASSERT_TRUE(complete);
+    TEST_ASSERT_TRUE(args.matches("page", 1));
+    TEST_ASSERT_EQUAL_UINT32(7 * 87, micros());
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_events_run_in_time_then_schedule_order);
+    RUN_TEST(test_delay_runs_events_on_the_way);
+    RUN_TEST(test_pulse_trains_drive_isrs_by_edge);
+    RUN_TEST(test_scheduled_bounce_settles_through_change_isr);
+    RUN_TEST(test_uart_bytes_arrive_at_line_rate);
+    return UNITY_END();
+}
@@ -0,0 +1,161 @@
+#include <unity.h>
+
+#include "driver/spi_master.h"
+#include "esp32_dash/display/SpiDmaQueue.h"
+
+namespace {
+constexpr uint16_t kLinePixels = 8;
+constexpr int8_t kDcPin = 16;
+
+uint16_t g_line0[kLinePixels];
+uint16_t g_line1[kLinePixels];
+uint16_t *const kBuffers[2] = {g_line0, g_line1};
+
+void attach(SpiDmaQueue &queue, SpiTransferMode mode) {
+    fake_spi::reset();
+    queue.attach(fake_spi::device(), kDcPin, kBuffers, kLinePixels);
+    queue.setMode(mode);
+}
+
+size_t countCommands(uint8_t command) {
+    size_t count = 0;
+    for (const fake_spi::Sent &sent : fake_spi::state.sent) {
+        if (!sent.data && sent.bytes.size() == 1 && sent.bytes[0] == command) {
+            ++count;
+        }
+    }
+    return count;
+}
+}
+
+void test_window_cache_skips_repeated_ranges() {
+    SpiDmaQueue queue;
+    attach(queue, SpiTransferMode::Queued);
+
+    queue.setWindow(10, 20, 49, 20);
+    TEST_ASSERT_EQUAL_size_t(5, fake_spi::state.sent.size());  // CASET+args, PASET+args, RAMWR
+    const fake_spi::Sent &columns = fake_spi::state.sent[1];
+    TEST_ASSERT_TRUE(columns.data);
+    TEST_ASSERT_EQUAL_UINT8(10, columns.bytes[1]);
+    TEST_ASSERT_EQUAL_UINT8(49, columns.bytes[3]);
+
+    queue.setWindow(10, 20, 49, 20);
+    TEST_ASSERT_EQUAL_size_t(6, fake_spi::state.sent.size());  // RAMWR only
+
+    queue.setWindow(10, 21, 49, 21);  // next row, same columns
+    TEST_ASSERT_EQUAL_size_t(1, countCommands(0x2A));
+    TEST_ASSERT_EQUAL_size_t(2, countCommands(0x2B));
+    TEST_ASSERT_EQUAL_size_t(3, countCommands(0x2C));
+}
+
+void test_line_buffers_are_reused_only_after_completion() {
+    SpiDmaQueue queue;
+    attach(queue, SpiTransferMode::Queued);
+    uint16_t pixels[3 * kLinePixels];
+    for (uint16_t i = 0; i < 3 * kLinePixels; ++i) {
+        pixels[i] = 0x1200 + i;
+    }
+
+    queue.setWindow(0, 0, kLinePixels - 1, 2);
+    queue.pushPixels(pixels, 2 * kLinePixels);
+    // Both buffers in flight behind the five window transactions.
+    TEST_ASSERT_EQUAL_UINT8(1, queue.bufferUsers(0));
+    TEST_ASSERT_EQUAL_UINT8(1, queue.bufferUsers(1));
+    TEST_ASSERT_EQUAL_UINT8(7, queue.inFlight());
+    TEST_ASSERT_EQUAL_UINT32(0, fake_spi::state.resultsTaken);
+
+    // The third line needs buffer 0 back: everything up to and including
+    // its transaction is reaped in order, nothing after it.
+    queue.pushPixels(pixels + 2 * kLinePixels, kLinePixels);
+    TEST_ASSERT_EQUAL_UINT32(6, fake_spi::state.resultsTaken);
+    TEST_ASSERT_EQUAL_UINT8(1, queue.bufferUsers(0));
+    TEST_ASSERT_EQUAL_UINT8(1, queue.bufferUsers(1));
+    TEST_ASSERT_EQUAL_UINT8(2, queue.inFlight());
+    TEST_ASSERT_EQUAL_UINT32(0, fake_spi::state.overwrittenInFlight);
+
+    // Pixels go out big-endian.
+    const fake_spi::Sent &last = fake_spi::state.sent.back();
+    TEST_ASSERT_TRUE(last.buffer == g_line0);
+    TEST_ASSERT_EQUAL_UINT8(0x12, last.bytes[0]);
+    TEST_ASSERT_EQUAL_UINT8(2 * kLinePixels, last.bytes[1]);
+
+    queue.flush();
+    TEST_ASSERT_EQUAL_UINT8(0, queue.inFlight());
+    TEST_ASSERT_EQUAL_UINT8(0, queue.bufferUsers(0));
+    TEST_ASSERT_EQUAL_UINT8(0, queue.bufferUsers(1));
+}
+
+void test_queue_depth_is_never_exceeded() {
+    SpiDmaQueue queue;
+    attach(queue, SpiTransferMode::Queued);
+
+    queue.setWindow(0, 0, 239, 239);
+    queue.fill(0xF800, 240 * 240);
+    queue.flush();
+    TEST_ASSERT_EQUAL_size_t(SpiDmaQueue::kQueueDepth, fake_spi::state.maxPending);
+    TEST_ASSERT_EQUAL_UINT32(0, fake_spi::state.overwrittenInFlight);
+
+    // A fill reuses one buffer for every chunk; it only refills the other.
+    size_t chunks = 0;
+    for (const fake_spi::Sent &sent : fake_spi::state.sent) {
+        if (sent.buffer != nullptr) {
+            TEST_ASSERT_TRUE(sent.buffer == g_line0);
+            ++chunks;
+        }
+    }
+    TEST_ASSERT_EQUAL_size_t(240 * 240 / kLinePixels, chunks);
+}
+
+void test_small_primitives_poll_after_draining_queue() {
+    SpiDmaQueue queue;
+    attach(queue, SpiTransferMode::Auto);
+
+    queue.prepare(64 * 64);
+    queue.setWindow(0, 0, 63, 63);
+    queue.fill(0x001F, 64 * 64);
+    TEST_ASSERT_TRUE(queue.inFlight() > 0);
+    const uint32_t queued = queue.queuedTransactions();
+
+    // A single pixel waits for the fill, then goes out without the queue.
+    const uint16_t color = 0xFFFF;
+    queue.prepare(1);
+    TEST_ASSERT_EQUAL_UINT8(0, queue.inFlight());
+    queue.setWindow(5, 5, 5, 5);
+    queue.pushPixels(&color, 1);
+    TEST_ASSERT_EQUAL_UINT32(queued, queue.queuedTransactions());
+    TEST_ASSERT_EQUAL_UINT32(6, queue.polledTransactions());
+    TEST_ASSERT_EQUAL_UINT32(0, fake_spi::state.polledWhilePending);
+    TEST_ASSERT_TRUE(fake_spi::state.sent.back().polled);
+
+    // Large work goes back to the queue.
+    queue.prepare(240);
+    queue.setWindow(0, 6, 239, 6);
+    TEST_ASSERT_TRUE(queue.queuedTransactions() > queued);
+}
+
+void test_forced_modes_override_size() {
+    SpiDmaQueue queue;
+    attach(queue, SpiTransferMode::Polling);
+    queue.prepare(240 * 240);
+    queue.setWindow(0, 0, 239, 239);
+    queue.fill(0x0000, 240 * 240);
+    TEST_ASSERT_EQUAL_UINT32(0, queue.queuedTransactions());
+    TEST_ASSERT_EQUAL_size_t(0, fake_spi::state.maxPending);
+
+    SpiDmaQueue queued;
+    attach(queued, SpiTransferMode::Queued);
+    queued.prepare(1);
+    queued.setWindow(1, 1, 1, 1);
+    TEST_ASSERT_EQUAL_UINT32(0, queued.polledTransactions());
+    TEST_ASSERT_EQUAL_UINT8(5, queued.inFlight());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_window_cache_skips_repeated_ranges);
+    RUN_TEST(test_line_buffers_are_reused_only_after_completion);
+    RUN_TEST(test_queue_depth_is_never_exceeded);
+    RUN_TEST(test_small_primitives_poll_after_draining_queue);
+    RUN_TEST(test_forced_modes_override_size);
+    return UNITY_END();
+}
@@ -0,0 +1,109 @@
+#include <unity.h>
+
+#include "Arduino.h"
+#include "esp32_dash/display/StaticLayerCache.h"
+
+namespace {
+int g_drawCalls = 0;
+
+void drawPlainLayer(void *context, Adafruit_GFX &gfx) {
+    (void) context;
+    ++g_drawCalls;
+    gfx.fillScreen(0x0000);
+    gfx.fillRect(40, 100, 160, 40, 0xF800);
+}
+
+void drawNoiseLayer(void *context, Adafruit_GFX &gfx) {
+    (void) context;
+    for (int16_t y = 0; y < gfx.height(); ++y) {
+        for (int16_t x = 0; x < gfx.width(); ++x) {
+            gfx.drawPixel(x, y, static_cast<uint16_t>(x * 7 + y * 13));
+        }
+    }
+}
+
+// A black full-screen layer encodes to 450 three-byte runs.
+constexpr uint32_t kPlainLayerBytes = 1400;
+const StaticLayerCache::Config kSmallBudget = {.budgetBytes = 2 * kPlainLayerBytes + 200, .bandRows = 16};
+
+int a, b, c;  // owners
+}
+
+void test_capture_replays_draw_per_band_then_restores_in_one_burst() {
+    StaticLayerCache cache(kSmallBudget);
+    Adafruit_GC9A01A display;
+    g_drawCalls = 0;
+
+    TEST_ASSERT_FALSE(cache.restore(&a, display));
+    TEST_ASSERT_TRUE(cache.capture(&a, display, drawPlainLayer, nullptr));
+    TEST_ASSERT_EQUAL_INT(240 / 16, g_drawCalls);
+    TEST_ASSERT_EQUAL_UINT32(1, display.addrWindowCalls);
+
+    display.resetCounters();
+    TEST_ASSERT_TRUE(cache.restore(&a, display));
+    TEST_ASSERT_EQUAL_INT(240 / 16, g_drawCalls);
+    TEST_ASSERT_EQUAL_UINT32(1, display.addrWindowCalls);
+    TEST_ASSERT_EQUAL_UINT32(240u * 240u, display.pixelsWritten);
+    TEST_ASSERT_EQUAL_UINT32(1, cache.hits());
+    TEST_ASSERT_TRUE(cache.bytesUsed() < kPlainLayerBytes + 200);
+}
+
+void test_restore_or_capture_accepts_lambdas() {
+    StaticLayerCache cache(kSmallBudget);
+    Adafruit_GC9A01A display;
+    int bands = 0;
+    auto draw = [&bands](Adafruit_GFX &gfx) {
+        ++bands;
+        gfx.fillScreen(0x001F);
+    };
+    TEST_ASSERT_TRUE(cache.restoreOrCapture(&a, display, draw));
+    TEST_ASSERT_TRUE(cache.restoreOrCapture(&a, display, draw));
+    TEST_ASSERT_EQUAL_INT(15, bands);
+    TEST_ASSERT_EQUAL_UINT32(1, cache.misses());
+}
+
+void test_least_recently_used_layer_is_evicted() {
+    StaticLayerCache cache(kSmallBudget);
+    Adafruit_GC9A01A display;
+    cache.capture(&a, display, drawPlainLayer, nullptr);
+    cache.capture(&b, display, drawPlainLayer, nullptr);
+    cache.restore(&a, display);  // b is now the oldest
+
+    cache.capture(&c, display, drawPlainLayer, nullptr);
+    TEST_ASSERT_EQUAL_size_t(2, cache.entryCount());
+    TEST_ASSERT_TRUE(cache.restore(&a, display));
+    TEST_ASSERT_FALSE(cache.restore(&b, display));
+    TEST_ASSERT_TRUE(cache.restore(&c, display));
+    TEST_ASSERT_TRUE(cache.bytesUsed() <= kSmallBudget.budgetBytes);
+}
+
+void test_layers_over_budget_are_not_kept() {
+    StaticLayerCache cache(kSmallBudget);
+    Adafruit_GC9A01A display;
+    cache.capture(&a, display, drawPlainLayer, nullptr);
+
+    TEST_ASSERT_FALSE(cache.capture(&b, display, drawNoiseLayer, nullptr));
+    TEST_ASSERT_EQUAL_size_t(1, cache.entryCount());
+    TEST_ASSERT_TRUE(cache.restore(&a, display));
+}
+
+void test_invalidate_forces_a_new_capture() {
+    StaticLayerCache cache(kSmallBudget);
+    Adafruit_GC9A01A display;
+    cache.capture(&a, display, drawPlainLayer, nullptr);
+    cache.invalidate(&a);
+    TEST_ASSERT_EQUAL_UINT32(0, cache.bytesUsed());
+    TEST_ASSERT_FALSE(cache.restore(&a, display));
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_capture_replays_draw_per_band_then_restores_in_one_burst);
+    RUN_TEST(test_restore_or_capture_accepts_lambdas);
+    RUN_TEST(test_least_recently_used_layer_is_evicted);
+    RUN_TEST(test_layers_over_budget_are_not_kept);
+    RUN_TEST(test_invalidate_forces_a_new_capture);
+    return UNITY_END();
+}
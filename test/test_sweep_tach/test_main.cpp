@@ -0,0 +1,88 @@
+#include <unity.h>
+
+#include <math.h>
+
+#include "Arduino.h"
+#include "esp32_dash/display/pages/SweepTachPage.h"
+#include "esp32_dash/util/TrigTable.h"
+
+namespace {
+const SweepTachPage::Config kConfig = {.maxRpm = 8000.0f, .redlineRpm = 7000.0f};
+
+static_assert(trig::sinQ14(90) == trig::kOne, "table peaks at one");
+static_assert(trig::cosQ14(180) == -trig::kOne, "cosine wraps through the quarter table");
+static_assert(trig::sinQ14(-30) == -trig::sinQ14(30), "negative angles mirror");
+
+// Runs frames at ~30 FPS until the tweened value settles; returns the
+// number of wedge triangles drawn on the way.
+uint32_t animate(SweepTachPage &page, Adafruit_GC9A01A &display) {
+    display.resetCounters();
+    for (int frame = 0; frame < 200; ++frame) {
+        advanceMillis(33);
+        if (!page.tick(millis())) {
+            break;
+        }
+        page.render(display);
+    }
+    return display.fillTriangleCalls;
+}
+}
+
+void test_trig_table_matches_libm() {
+    for (int degrees = -360; degrees <= 720; ++degrees) {
+        const float radians = degrees * 3.14159265f / 180.0f;
+        TEST_ASSERT_INT_WITHIN(1, lroundf(sinf(radians) * trig::kOne), trig::sinQ14(degrees));
+        TEST_ASSERT_INT_WITHIN(1, lroundf(cosf(radians) * trig::kOne), trig::cosQ14(degrees));
+    }
+}
+
+void test_polar_to_screen_uses_clockwise_from_up() {
+    int16_t x, y;
+    trig::polarToScreen(120, 120, 100, 0, x, y);
+    TEST_ASSERT_EQUAL_INT16(120, x);
+    TEST_ASSERT_EQUAL_INT16(20, y);
+    trig::polarToScreen(120, 120, 100, 90, x, y);
+    TEST_ASSERT_EQUAL_INT16(220, x);
+    TEST_ASSERT_EQUAL_INT16(120, y);
+}
+
+void test_idle_frame_draws_nothing() {
+    Adafruit_GC9A01A display;
+    SweepTachPage page(kConfig);
+    page.setRpm(3000.0f);
+    page.render(display);
+    TEST_ASSERT_FALSE(page.needsRender());
+
+    page.setRpm(3000.4f);
+    TEST_ASSERT_EQUAL_UINT32(0, animate(page, display));
+    TEST_ASSERT_EQUAL_UINT32(0, display.printCalls);
+}
+
+void test_frame_cost_tracks_rpm_delta() {
+    Adafruit_GC9A01A display;
+    SweepTachPage page(kConfig);
+    page.setRpm(2000.0f);
+    page.render(display);
+
+    page.setRpm(2300.0f);  // ~10 degrees of sweep
+    const uint32_t smallStep = animate(page, display);
+
+    page.setRpm(5300.0f);  // ~100 degrees of sweep
+    const uint32_t largeStep = animate(page, display);
+
+    // Frames split the wedge, but the total area painted is the delta.
+    TEST_ASSERT_TRUE(smallStep > 0);
+    TEST_ASSERT_TRUE(smallStep < 24);
+    TEST_ASSERT_UINT32_WITHIN(smallStep * 3, smallStep * 10, largeStep);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_trig_table_matches_libm);
+    RUN_TEST(test_polar_to_screen_uses_clockwise_from_up);
+    RUN_TEST(test_idle_frame_draws_nothing);
+    RUN_TEST(test_frame_cost_tracks_rpm_delta);
+    return UNITY_END();
+}
@@ -0,0 +1,220 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "esp32_dash/sensors/PulseCapture.h"
+#include "esp32_dash/sensors/TachSensor.h"
+#include "esp32_dash/display/DisplayManager.h"
+#include "esp32_dash/display/pages/TachPage.h"
+#include "Arduino.h"
+
+namespace {
+constexpr int kTachPin = 35;
+constexpr float kPulsesPerRevolution = 2.0f;
+
+const PulseChannelConfig kChannels[1] = {
+    {.pin = kTachPin, .edge = RISING, .debounceMicros = 2000, .backend = PulseBackend::GpioInterrupt},
+};
+
+const TachSensor::Config kConfig{
+    .updateIntervalMs = 250,
+    .pulsesPerRevolution = kPulsesPerRevolution,
+    .changeThresholdRpm = 25.0f,
+};
+
+struct Scenario {
+    const char *name;
+    float (*rpmAt)(uint32_t ms);
+    float jitterFraction;          // +/- fraction of the period, uniform
+    float dropProbability;         // chance a real pulse never arrives
+    uint32_t noiseEveryMs;         // 0 disables ignition noise bursts
+    uint8_t noiseEdges;            // spurious edges per burst
+    uint32_t noiseSpacingMicros;   // below the debounce window
+    float scoreFromRpm = 0.0f;     // relative error is meaningless near 0 rpm
+};
+
+struct Result {
+    float meanAbsErrorPct = 0.0f;       // windowed lastRpm() vs. true rpm
+    float maxAbsErrorPct = 0.0f;
+    float instantMeanAbsErrorPct = 0.0f;
+    float isrPerSecond = 0.0f;
+    uint32_t rejectedEdges = 0;
+};
+
+// Deterministic so failures reproduce.
+uint32_t g_rng = 0x12345678;
+float uniform() {
+    g_rng ^= g_rng << 13;
+    g_rng ^= g_rng >> 17;
+    g_rng ^= g_rng << 5;
+    return static_cast<float>(g_rng) / 4294967296.0f;
+}
+
+float idle(uint32_t) { return 850.0f; }
+float cruise(uint32_t) { return 3000.0f; }
+float sweep(uint32_t ms) { return 7000.0f * (static_cast<float>(ms) / 10000.0f); }
+
+// Below cranking speed the engine is treated as stopped: no ignition pulses.
+constexpr float kCrankingRpm = 50.0f;
+
+// Drives pulses and update() on the virtual clock for \c durationMs and
+// scores every update after \c warmupMs.
+Result run(const Scenario &scenario, uint32_t durationMs, uint32_t warmupMs) {
+    g_rng = 0x12345678;
+    setMicros(1000000);
+    const uint32_t startMicros = micros();
+
+    PulseCapture<1> capture(kChannels);
+    TachPage page;
+    DisplayManager display;
+    TachSensor tach(kConfig, capture.channel(0), page, display);
+    capture.begin();
+    tach.begin();
+
+    Result result;
+    uint32_t samples = 0;
+    uint32_t nextPulse = startMicros;
+    uint32_t nextNoiseMs = scenario.noiseEveryMs;
+
+    for (uint32_t ms = 0; ms < durationMs; ++ms) {
+        const uint32_t sliceEnd = startMicros + (ms + 1) * 1000;
+        while (static_cast<int32_t>(sliceEnd - nextPulse) > 0) {
+            const float rpm = scenario.rpmAt(ms);
+            if (rpm < kCrankingRpm) {
+                nextPulse = sliceEnd;
+                break;
+            }
+            setMicros(nextPulse);
+            if (uniform() >= scenario.dropProbability) {
+                triggerInterrupt(kTachPin);
+            }
+            if (scenario.noiseEveryMs > 0 && ms >= nextNoiseMs) {
+                nextNoiseMs += scenario.noiseEveryMs;
+                for (uint8_t i = 0; i < scenario.noiseEdges; ++i) {
+                    advanceMicros(scenario.noiseSpacingMicros);
+                    triggerInterrupt(kTachPin);
+                }
+            }
+            const float period = 60000000.0f / (rpm * kPulsesPerRevolution);
+            const float jitter = (uniform() * 2.0f - 1.0f) * scenario.jitterFraction;
+            nextPulse += static_cast<uint32_t>(period * (1.0f + jitter));
+        }
+        setMicros(sliceEnd);
+        tach.update();
+
+        const float truth = scenario.rpmAt(ms);
+        if (ms >= warmupMs && (ms % kConfig.updateIntervalMs) == 0 && truth >= scenario.scoreFromRpm) {
+            const float error = fabsf(tach.lastRpm() - truth) / truth * 100.0f;
+            const float instantError = fabsf(tach.instantRpm() - truth) / truth * 100.0f;
+            result.meanAbsErrorPct += error;
+            result.instantMeanAbsErrorPct += instantError;
+            if (error > result.maxAbsErrorPct) {
+                result.maxAbsErrorPct = error;
+            }
+            samples++;
+        }
+    }
+
+    if (samples > 0) {
+        result.meanAbsErrorPct /= samples;
+        result.instantMeanAbsErrorPct /= samples;
+    }
+    result.isrPerSecond = capture.channel(0).edgeCount() * 1000.0f / durationMs;
+    result.rejectedEdges = capture.channel(0).rejectedCount();
+
+    char line[160];
+    snprintf(line, sizeof(line),
+             "%s: window err mean %.1f%% max %.1f%%, instant err mean %.1f%%, %.0f ISR/s, %lu rejected",
+             scenario.name, result.meanAbsErrorPct, result.maxAbsErrorPct,
+             result.instantMeanAbsErrorPct, result.isrPerSecond,
+             static_cast<unsigned long>(result.rejectedEdges));
+    TEST_MESSAGE(line);
+    return result;
+}
+
+// Time from a step in true rpm until lastRpm() is within 5 % of it.
+uint32_t stepResponseLagMs(float fromRpm, float toRpm) {
+    setMicros(1000000);
+    const uint32_t startMicros = micros();
+
+    PulseCapture<1> capture(kChannels);
+    TachPage page;
+    DisplayManager display;
+    TachSensor tach(kConfig, capture.channel(0), page, display);
+    capture.begin();
+    tach.begin();
+
+    constexpr uint32_t kStepAtMs = 2000;
+    uint32_t nextPulse = startMicros;
+    for (uint32_t ms = 0; ms < 5000; ++ms) {
+        const float rpm = ms < kStepAtMs ? fromRpm : toRpm;
+        const uint32_t sliceEnd = startMicros + (ms + 1) * 1000;
+        while (static_cast<int32_t>(sliceEnd - nextPulse) > 0) {
+            setMicros(nextPulse);
+            triggerInterrupt(kTachPin);
+            nextPulse += static_cast<uint32_t>(60000000.0f / (rpm * kPulsesPerRevolution));
+        }
+        setMicros(sliceEnd);
+        tach.update();
+        if (ms >= kStepAtMs && fabsf(tach.lastRpm() - toRpm) <= toRpm * 0.05f) {
+            return ms - kStepAtMs;
+        }
+    }
+    return UINT32_MAX;
+}
+}
+
+void test_idle_accuracy() {
+    const Result r = run({"idle", idle, 0.0f, 0.0f, 0, 0, 0}, 5000, 500);
+    // 850 rpm is only ~7 pulses per 250 ms window, so the windowed value
+    // is quantized to ~14 %; the period-based estimate is exact.
+    TEST_ASSERT_LESS_THAN(15.0f, r.maxAbsErrorPct);
+    TEST_ASSERT_LESS_THAN(0.5f, r.instantMeanAbsErrorPct);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 28.3f, r.isrPerSecond);
+}
+
+void test_full_sweep_tracks_rpm() {
+    // Starts from a stopped engine; scoring begins at the idle floor.
+    const Result r = run({"sweep 0-7000", sweep, 0.0f, 0.0f, 0, 0, 0, 700.0f}, 10000, 500);
+    TEST_ASSERT_LESS_THAN(8.0f, r.meanAbsErrorPct);
+    TEST_ASSERT_LESS_THAN(1.0f, r.instantMeanAbsErrorPct);
+}
+
+void test_jitter_is_averaged_out() {
+    const Result r = run({"cruise jitter 5%", cruise, 0.05f, 0.0f, 0, 0, 0}, 5000, 500);
+    TEST_ASSERT_LESS_THAN(4.0f, r.meanAbsErrorPct);
+}
+
+void test_dropped_pulses_read_low_by_drop_rate() {
+    const Result r = run({"cruise 5% dropped", cruise, 0.0f, 0.05f, 0, 0, 0}, 5000, 500);
+    TEST_ASSERT_LESS_THAN(10.0f, r.meanAbsErrorPct);
+}
+
+void test_noise_bursts_are_rejected() {
+    const Result r = run({"cruise noise", cruise, 0.0f, 0.0f, 100, 4, 150}, 5000, 500);
+    // A burst every 100 ms from t=100 ms: 49 bursts of 4 edges in 5 s
+    constexpr uint32_t kNoiseEdges = 49 * 4;
+    TEST_ASSERT_EQUAL_UINT32(kNoiseEdges, r.rejectedEdges);
+    TEST_ASSERT_LESS_THAN(3.0f, r.meanAbsErrorPct);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 100.0f + kNoiseEdges / 5.0f, r.isrPerSecond);
+}
+
+void test_step_response_lag() {
+    const uint32_t lagMs = stepResponseLagMs(1000.0f, 5000.0f);
+    char line[64];
+    snprintf(line, sizeof(line), "step 1000->5000 rpm: lag %lu ms", static_cast<unsigned long>(lagMs));
+    TEST_MESSAGE(line);
+    // One full update window is needed before the new rate is visible.
+    TEST_ASSERT_LESS_OR_EQUAL(2 * kConfig.updateIntervalMs, lagMs);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_accuracy);
+    RUN_TEST(test_full_sweep_tracks_rpm);
+    RUN_TEST(test_jitter_is_averaged_out);
+    RUN_TEST(test_dropped_pulses_read_low_by_drop_rate);
+    RUN_TEST(test_noise_bursts_are_rejected);
+    RUN_TEST(test_step_response_lag);
+    return UNITY_END();
+}
@@ -0,0 +1,93 @@
+#include <unity.h>
+
+#include "Arduino.h"
+#include "esp32_dash/display/ValueTween.h"
+#include "esp32_dash/display/pages/TachPage.h"
+
+namespace {
+const ValueTween::Config kConfig = {.timeConstantMs = 100.0f, .settleEpsilon = 0.5f};
+constexpr uint32_t kFrameMs = 33;
+}
+
+void test_first_sample_is_shown_immediately() {
+    ValueTween tween(kConfig);
+    tween.setTarget(850.0f, 0);
+    TEST_ASSERT_TRUE(tween.isSettled());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 850.0f, tween.value());
+    TEST_ASSERT_FALSE(tween.step(kFrameMs));
+}
+
+void test_follows_step_without_overshoot_and_settles() {
+    ValueTween tween(kConfig);
+    tween.setTarget(1000.0f, 0);
+    tween.setTarget(3000.0f, 0);
+
+    float previous = tween.value();
+    uint32_t now = 0;
+    int frames = 0;
+    while (tween.step(now += kFrameMs)) {
+        TEST_ASSERT_TRUE(tween.value() >= previous);
+        TEST_ASSERT_TRUE(tween.value() <= 3000.0f);
+        previous = tween.value();
+        ++frames;
+        TEST_ASSERT_TRUE(frames < 100);
+    }
+    TEST_ASSERT_TRUE(tween.isSettled());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 3000.0f, tween.value());
+    // Roughly a second of animation for a 2000 rpm jump, then silence.
+    TEST_ASSERT_TRUE(frames > 10);
+    TEST_ASSERT_FALSE(tween.step(now + kFrameMs));
+}
+
+void test_irregular_frame_gaps_stay_stable() {
+    ValueTween tween(kConfig);
+    tween.setTarget(0.0f, 0);
+    tween.setTarget(100.0f, 0);
+    tween.step(5);
+    tween.step(900);  // long stall, e.g. a blocking BLE callback
+    TEST_ASSERT_TRUE(tween.value() <= 100.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 100.0f, tween.value());
+}
+
+void test_idle_gap_before_new_target_does_not_jump() {
+    ValueTween tween(kConfig);
+    tween.setTarget(0.0f, 0);
+    tween.setTarget(100.0f, 60000);
+    tween.step(60000 + kFrameMs);
+    // Integration starts at the sample, not at the last frame a minute ago.
+    TEST_ASSERT_TRUE(tween.value() < 50.0f);
+}
+
+void test_tach_page_requests_frames_only_while_moving() {
+    setMillis(0);
+    TachPage page;
+    Adafruit_GC9A01A display;
+    page.setRpm(900.0f);
+    page.render(display);
+    TEST_ASSERT_FALSE(page.tick(millis()));
+
+    page.setRpm(2500.0f);
+    int frames = 0;
+    for (int i = 0; i < 200; ++i) {
+        advanceMillis(kFrameMs);
+        if (page.tick(millis())) {
+            page.render(display);
+            ++frames;
+        }
+    }
+    TEST_ASSERT_TRUE(frames > 5);
+    TEST_ASSERT_TRUE(frames < 60);
+    TEST_ASSERT_FALSE(page.tick(millis() + kFrameMs));
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_first_sample_is_shown_immediately);
+    RUN_TEST(test_follows_step_without_overshoot_and_settles);
+    RUN_TEST(test_irregular_frame_gaps_stay_stable);
+    RUN_TEST(test_idle_gap_before_new_target_does_not_jump);
+    RUN_TEST(test_tach_page_requests_frames_only_while_moving);
+    return UNITY_END();
+}
@@ -32,9 +32,9 @@ void test_interpolate_between_points() {
 }
 
 void test_describe_water_status_ranges() {
-    TEST_ASSERT_TRUE(WaterSensor::describeWaterStatus(75.0f) == "Warming up");
-    TEST_ASSERT_TRUE(WaterSensor::describeWaterStatus(85.0f) == "");
-    TEST_ASSERT_TRUE(WaterSensor::describeWaterStatus(110.0f) == "Hot!");
+    TEST_ASSERT_EQUAL_STRING("Warming up", WaterSensor::describeWaterStatus(75.0f));
+    TEST_ASSERT_EQUAL_STRING("", WaterSensor::describeWaterStatus(85.0f));
+    TEST_ASSERT_EQUAL_STRING("", WaterSensor::describeWaterStatus(110.0f));  // alarm table's job
 }
 
 void test_set_enabled_updates_status_and_refresh() {
@@ -45,7 +45,7 @@ void test_set_enabled_updates_status_and_refresh() {
     sensor.setEnabled(false);
 
     TEST_ASSERT_TRUE(display.refreshRequested);
-    TEST_ASSERT_TRUE(page.lastStatusMessage == "Sleeping");
+    TEST_ASSERT_EQUAL_STRING("Sleeping", page.statusMessage());
 }
 
 int main(int argc, char **argv) {
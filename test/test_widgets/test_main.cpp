@@ -0,0 +1,160 @@
+#include <unity.h>
+
+#include "Arduino.h"
+#include "esp32_dash/display/AlphaText.h"
+#include "esp32_dash/display/fonts/ReadoutFont.h"
+#include "esp32_dash/display/widgets/Arc.h"
+#include "esp32_dash/display/widgets/Bar.h"
+#include "esp32_dash/display/widgets/Label.h"
+#include "esp32_dash/display/widgets/NumericValue.h"
+
+void test_label_draws_once_until_text_changes() {
+    Adafruit_GC9A01A display;
+    Label label(100, 2, 0xFFFF, 0x0000);
+
+    label.setText("Hello");
+    label.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(1, display.printCalls);
+
+    label.setText("Hello");
+    label.draw(display);
+    label.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(1, display.printCalls);
+    TEST_ASSERT_FALSE(label.isDirty());
+}
+
+void test_label_only_clears_strips_left_by_shorter_text() {
+    Adafruit_GC9A01A display;
+    Label label(100, 2, 0xFFFF, 0x0000);
+    label.setText("8888");
+    label.draw(display);
+    display.resetCounters();
+
+    // Same width: opaque glyphs cover the old text, nothing to erase.
+    label.setText("1234");
+    label.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(0, display.fillRectCalls);
+
+    // Narrower centred text leaves a strip on either side.
+    label.setText("12");
+    label.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(2, display.fillRectCalls);
+}
+
+void test_label_does_not_erase_after_invalidate() {
+    Adafruit_GC9A01A display;
+    Label label(100, 2, 0xFFFF, 0x0000);
+    label.setText("8888");
+    label.draw(display);
+
+    label.invalidate();
+    label.setText("1");
+    display.resetCounters();
+    label.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(0, display.fillRectCalls);
+    TEST_ASSERT_EQUAL_UINT32(1, display.printCalls);
+}
+
+void test_numeric_value_ignores_fractional_changes() {
+    Adafruit_GC9A01A display;
+    NumericValue value(100, 6, 0xF800, 0x0000, " C");
+    value.setValue(85.2f);
+    value.draw(display);
+    TEST_ASSERT_EQUAL_STRING("85 C", value.text());
+
+    value.setValue(85.9f);
+    TEST_ASSERT_FALSE(value.isDirty());
+    value.setValue(86.0f);
+    TEST_ASSERT_TRUE(value.isDirty());
+}
+
+void test_bar_repaints_only_the_changed_span() {
+    Adafruit_GC9A01A display;
+    Bar bar(0, 0, 100, 8, 0.0f, 100.0f, 0x07E0, 0x2104);
+    bar.setValue(50.0f);
+    bar.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(2, display.fillRectCalls);  // fill + track
+
+    display.resetCounters();
+    bar.setValue(60.0f);
+    bar.draw(display);
+    bar.setValue(40.0f);
+    bar.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(2, display.fillRectCalls);
+
+    display.resetCounters();
+    bar.setValue(40.2f);
+    bar.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(0, display.fillRectCalls);
+}
+
+void test_arc_redraws_only_the_delta_wedge() {
+    Adafruit_GC9A01A display;
+    Arc arc(120, 120, 100, 115, -135, 270, 0.0f, 270.0f, 0xF800, 0x2104);
+    arc.setValue(100.0f);
+    arc.draw(display);
+    const uint32_t fullSweep = display.fillTriangleCalls;
+    TEST_ASSERT_EQUAL_UINT32(270, fullSweep);  // two triangles per 2 degree step
+
+    display.resetCounters();
+    arc.setValue(110.0f);
+    arc.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(10, display.fillTriangleCalls);
+
+    display.resetCounters();
+    arc.setValue(111.0f);  // below the wedge step
+    arc.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(0, display.fillTriangleCalls);
+}
+
+void test_alpha_text_streams_one_window_per_string() {
+    Adafruit_GC9A01A display;
+    const int16_t width = alphaTextWidth(fonts::kReadout, "1234");
+    TEST_ASSERT_EQUAL_INT(4 * fonts::kReadoutGlyphs[4].xAdvance, width);
+
+    drawAlphaText(display, fonts::kReadout, "1234", 60, 90, 0xFFFF, 0x0000);
+    TEST_ASSERT_EQUAL_UINT32(1, display.addrWindowCalls);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(width) * fonts::kReadout.lineHeight,
+                             display.pixelsWritten);
+    TEST_ASSERT_EQUAL_UINT32(0, display.fillRectCalls);
+}
+
+void test_alpha_text_skips_unknown_glyphs_and_clips_to_panel() {
+    Adafruit_GC9A01A display;
+    TEST_ASSERT_EQUAL_INT(alphaTextWidth(fonts::kReadout, "88"), alphaTextWidth(fonts::kReadout, "8x8"));
+
+    drawAlphaText(display, fonts::kReadout, "8888", 220, 0, 0xFFFF, 0x0000);
+    TEST_ASSERT_EQUAL_UINT32(20u * fonts::kReadout.lineHeight, display.pixelsWritten);
+}
+
+void test_label_with_alpha_font_clears_only_uncovered_strips() {
+    Adafruit_GC9A01A display;
+    NumericValue value(90, 6, 0xF800, 0x0000);
+    value.setFont(&fonts::kReadout);
+    value.setValue(1000.0f);
+    value.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(0, display.printCalls);
+    TEST_ASSERT_EQUAL_UINT32(1, display.addrWindowCalls);
+
+    display.resetCounters();
+    value.setValue(900.0f);
+    value.draw(display);
+    TEST_ASSERT_EQUAL_UINT32(1, display.addrWindowCalls);
+    TEST_ASSERT_EQUAL_UINT32(2, display.fillRectCalls);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_label_draws_once_until_text_changes);
+    RUN_TEST(test_label_only_clears_strips_left_by_shorter_text);
+    RUN_TEST(test_label_does_not_erase_after_invalidate);
+    RUN_TEST(test_numeric_value_ignores_fractional_changes);
+    RUN_TEST(test_bar_repaints_only_the_changed_span);
+    RUN_TEST(test_arc_redraws_only_the_delta_wedge);
+    RUN_TEST(test_alpha_text_streams_one_window_per_string);
+    RUN_TEST(test_alpha_text_skips_unknown_glyphs_and_clips_to_panel);
+    RUN_TEST(test_label_with_alpha_font_clears_only_uncovered_strips);
+    return UNITY_END();
+}
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Convert an image into a run-length encoded RGB565 asset header.
+
+Token stream, read front to back and continuing across rows:
+    0x80 | (n - 1), value        run of n (1..128) identical pixels
+    0x00 | (n - 1), value * n    n (1..128) literal pixels
+A value is one palette index when the asset has a palette, otherwise a
+little-endian RGB565 word.
+
+Usage:
+    python3 tools/convert_rle_image.py assets/boot_logo.png --name BootLogo \\
+        --output include/esp32_dash/display/images/BootLogo.h
+
+Pass --max-colors 0 to keep full RGB565 instead of quantizing to a palette.
+Needs Pillow (pip install pillow).
+"""
+
+import argparse
+import os
+
+from PIL import Image
+
+MAX_TOKEN = 128
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def encode(values, value_bytes):
+    def emit_value(out, value):
+        if value_bytes == 1:
+            out.append(value)
+        else:
+            out += bytes((value & 0xFF, value >> 8))
+
+    # A run token only pays off once it replaces more than one literal.
+    min_run = 3 if value_bytes == 1 else 2
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_TOKEN]
+            del literal[:MAX_TOKEN]
+            out.append(len(chunk) - 1)
+            for value in chunk:
+                emit_value(out, value)
+
+    i = 0
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and run < MAX_TOKEN and values[i + run] == values[i]:
+            run += 1
+        if run >= min_run:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            emit_value(out, values[i])
+            i += run
+        else:
+            literal.append(values[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image")
+    parser.add_argument("--name", required=True)
+    parser.add_argument("--max-colors", type=int, default=16,
+                        help="palette size (<= 256), 0 for raw RGB565")
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args()
+
+    image = Image.open(args.image).convert("RGB")
+    width, height = image.size
+
+    if args.max_colors:
+        quantized = image.quantize(colors=min(args.max_colors, 256), dither=Image.Dither.NONE)
+        flat = quantized.getpalette()[:3 * 256]
+        indices = list(quantized.tobytes())
+        used = max(indices) + 1
+        palette = [rgb565(*flat[3 * i:3 * i + 3]) for i in range(used)]
+        data = encode(indices, 1)
+    else:
+        palette = []
+        raw = image.tobytes()
+        data = encode([rgb565(*raw[i:i + 3]) for i in range(0, len(raw), 3)], 2)
+
+    name = args.name
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by tools/convert_rle_image.py from %s." % os.path.basename(args.image),
+        "// Do not edit by hand; re-run the script instead.",
+        "",
+        '#include "esp32_dash/display/RleImage.h"',
+        "",
+        "namespace images {",
+        "",
+    ]
+    if palette:
+        lines.append("inline constexpr uint16_t k%sPalette[] = {" % name)
+        for offset in range(0, len(palette), 8):
+            lines.append("        " + ", ".join("0x%04X" % c for c in palette[offset:offset + 8]) + ",")
+        lines.append("};")
+        lines.append("")
+    lines.append("inline constexpr uint8_t k%sData[] = {" % name)
+    for offset in range(0, len(data), 16):
+        lines.append("        " + ", ".join("0x%02X" % b for b in data[offset:offset + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("inline constexpr RleImage k%s = {" % name)
+    lines.append("        %d," % width)
+    lines.append("        %d," % height)
+    lines.append("        %s," % (("k%sPalette" % name) if palette else "nullptr"))
+    lines.append("        %d," % len(palette))
+    lines.append("        k%sData," % name)
+    lines.append("        %d," % len(data))
+    lines.append("};")
+    lines.append("")
+    lines.append("}")
+    lines.append("")
+
+    os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    with open(args.output, "w") as out:
+        out.write("\n".join(lines))
+    print("%s: %dx%d, %d colours, %d bytes (raw RGB565 %d bytes)"
+          % (args.output, width, height, len(palette) or 65536, len(data), width * height * 2))
+
+
+if __name__ == "__main__":
+    main()
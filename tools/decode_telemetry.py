@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Decode the dash's binary telemetry stream into CSV.
+
+Send `stream on` on the USB console first (`stream off` to stop). Frames:
+    0xA5 0x5A, type 0x01, length 15, payload, CRC-8 (poly 0x07)
+The CRC covers type, length and payload; see TelemetryFrame.h.
+
+Usage:
+    python3 tools/decode_telemetry.py /dev/ttyUSB0 > drive.csv
+    python3 tools/decode_telemetry.py capture.bin --file > drive.csv
+
+Reading a port needs pyserial (pip install pyserial).
+"""
+
+import argparse
+import struct
+import sys
+
+SYNC = b"\xA5\x5A"
+TYPE_SAMPLE = 0x01
+PAYLOAD = struct.Struct("<IHhHBBBH")
+COOLANT_UNKNOWN = -32768
+
+
+def crc8(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def frames(chunks):
+    """Yields payload tuples, resynchronising on the sync bytes after noise."""
+    buffer = bytearray()
+    for chunk in chunks:
+        buffer += chunk
+        while True:
+            start = buffer.find(SYNC)
+            if start < 0:
+                del buffer[:-1]
+                break
+            del buffer[:start]
+            if len(buffer) < 4:
+                break
+            kind, length = buffer[2], buffer[3]
+            end = 4 + length + 1
+            if len(buffer) < end:
+                break
+            if kind != TYPE_SAMPLE or length != PAYLOAD.size or crc8(buffer[2:end - 1]) != buffer[end - 1]:
+                del buffer[:1]
+                continue
+            yield PAYLOAD.unpack(bytes(buffer[4:end - 1]))
+            del buffer[:end]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", help="serial port, or a capture file with --file")
+    parser.add_argument("--file", action="store_true", help="read a raw capture file")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.file:
+        source = open(args.source, "rb")
+        chunks = iter(lambda: source.read(4096), b"")
+    else:
+        import serial
+        port = serial.Serial(args.source, args.baud, timeout=1)
+        chunks = iter(lambda: port.read(port.in_waiting or 1), None)
+
+    print("ms,rpm,coolant_c,speed_kmh,page,inputs,alarm_leds,dropped_bytes")
+    for ms, rpm, coolant, speed, page, inputs, leds, dropped in frames(chunks):
+        coolant_text = "" if coolant == COOLANT_UNKNOWN else "%.1f" % (coolant / 10.0)
+        print("%d,%d,%s,%.1f,%d,0x%02X,0x%02X,%d"
+              % (ms, rpm, coolant_text, speed / 10.0, page, inputs, leds, dropped))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
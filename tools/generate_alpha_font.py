@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Rasterize a TTF into a 4-bit alpha atlas header for the ESP32 dash.
+
+Each glyph is stored as packed 4-bit coverage (two pixels per byte, rows
+padded to a whole byte) together with its box, bearing and advance. Kerning
+pairs are taken from the font's own layout and emitted as a sorted table.
+
+Usage:
+    python3 tools/generate_alpha_font.py Lato-Regular.ttf 56 \\
+        --chars " -.0123456789C" --name Readout \\
+        --output include/esp32_dash/display/fonts/ReadoutFont.h
+
+Needs Pillow (pip install pillow). The generated header is checked in, so
+firmware builds do not depend on Python or the TTF.
+"""
+
+import argparse
+import os
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+
+def quantize(value):
+    return (value * 15 + 127) // 255
+
+
+def ink_box(font, char):
+    """Returns the inked box of \a char relative to the pen origin at the
+    top of the line, or None for blank glyphs."""
+    ascent, descent = font.getmetrics()
+    pad = font.size
+    canvas = Image.new("L", (int(font.getlength(char)) + 2 * pad, ascent + descent + 2 * pad), 0)
+    ImageDraw.Draw(canvas).text((pad, pad), char, font=font, fill=255)
+    box = canvas.getbbox()
+    if box is None:
+        return None, canvas
+    x0, y0, x1, y1 = box
+    return (x0 - pad, y0 - pad, x1 - pad, y1 - pad), canvas.crop(box)
+
+
+def pack(image):
+    width, height = image.size
+    pixels = image.load()
+    rows = []
+    for y in range(height):
+        row = [quantize(pixels[x, y]) for x in range(width)]
+        if len(row) % 2:
+            row.append(0)
+        rows.append(bytes((row[i] << 4) | row[i + 1] for i in range(0, len(row), 2)))
+    return b"".join(rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("ttf")
+    parser.add_argument("size", type=int, help="pixel size")
+    parser.add_argument("--chars", default=" -.0123456789C")
+    parser.add_argument("--name", default="Readout")
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args()
+
+    font = ImageFont.truetype(args.ttf, args.size)
+    ascent, _ = font.getmetrics()
+    chars = sorted(set(args.chars))
+
+    boxes = {char: ink_box(font, char) for char in chars}
+    inked = [box for box, _ in boxes.values() if box]
+    if not inked:
+        sys.exit("no inked glyphs in the character set")
+    # Trim the line to the ink of this character set so readout cells are
+    # no taller than the digits themselves.
+    top = min(box[1] for box in inked)
+    bottom = max(box[3] for box in inked)
+
+    bitmap = bytearray()
+    glyphs = []
+    for char in chars:
+        box, image = boxes[char]
+        advance = int(round(font.getlength(char)))
+        if box is None:
+            glyphs.append((ord(char), len(bitmap), 0, 0, 0, 0, advance, char))
+            continue
+        x0, y0, x1, y1 = box
+        glyphs.append((ord(char), len(bitmap), x1 - x0, y1 - y0, x0, y0 - top, advance, char))
+        bitmap += pack(image)
+        if len(bitmap) > 0xFFFF:
+            sys.exit("atlas exceeds 64 KiB; reduce the size or character set")
+
+    kerning = []
+    for left in chars:
+        for right in chars:
+            pair = font.getlength(left + right) - font.getlength(left) - font.getlength(right)
+            adjust = int(round(pair))
+            if adjust:
+                kerning.append((ord(left), ord(right), adjust))
+
+    name = args.name
+    guard_comment = os.path.basename(args.ttf)
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by tools/generate_alpha_font.py from %s at %d px." % (guard_comment, args.size),
+        "// Do not edit by hand; re-run the script instead.",
+        "",
+        '#include "esp32_dash/display/AlphaFont.h"',
+        "",
+        "namespace fonts {",
+        "",
+        "inline constexpr uint8_t k%sBitmap[] = {" % name,
+    ]
+    for offset in range(0, len(bitmap), 16):
+        chunk = bitmap[offset:offset + 16]
+        lines.append("        " + ", ".join("0x%02X" % b for b in chunk) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("inline constexpr AlphaGlyph k%sGlyphs[] = {" % name)
+    for code, offset, width, height, x0, y0, advance, char in glyphs:
+        lines.append("        {0x%02X, %d, %d, %d, %d, %d, %d},  // '%s'"
+                     % (code, offset, width, height, x0, y0, advance, char))
+    lines.append("};")
+    lines.append("")
+    lines.append("inline constexpr AlphaKerning k%sKerning[] = {" % name)
+    for left, right, adjust in kerning:
+        lines.append("        {0x%02X, 0x%02X, %d},  // '%s%s'" % (left, right, adjust, chr(left), chr(right)))
+    if not kerning:
+        lines.append("        {0, 0, 0},  // no pairs; count below is zero")
+    lines.append("};")
+    lines.append("")
+    lines.append("inline constexpr AlphaFont k%s = {" % name)
+    lines.append("        k%sBitmap," % name)
+    lines.append("        k%sGlyphs," % name)
+    lines.append("        %d," % len(glyphs))
+    lines.append("        k%sKerning," % name)
+    lines.append("        %d," % len(kerning))
+    lines.append("        %d,  // line height" % (bottom - top))
+    lines.append("        %d,  // baseline" % (ascent - top))
+    lines.append("};")
+    lines.append("")
+    lines.append("}")
+    lines.append("")
+
+    os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    with open(args.output, "w") as out:
+        out.write("\n".join(lines))
+    print("%s: %d glyphs, %d bitmap bytes, %d kerning pairs"
+          % (args.output, len(glyphs), len(bitmap), len(kerning)))
+
+
+if __name__ == "__main__":
+    main()